@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+
+#include "AnimationClip.h"
+#include "AnimatorController.h"
+#include "AssetId.h"
+
+// Cache of immutable, shareable animation data (owned by the AssetManager).
+// Most sprites play one run of sheet frames in a single state; that clip + controller pair is
+// built once per (sheet, frame range, fps, loop, state name) and handed out as
+// shared_ptr<const AnimatorController>, so spawning another instance is a hash lookup with no allocation.
+// Entries for a sheet are dropped when the AssetManager unloads or evicts it. Animators retain
+// the sheets of the controllers they play, so eviction never takes a sheet an Animator still uses.
+class AnimationLibrary {
+public:
+	// frameCount value meaning "from firstFrame to the end of the sheet".
+	static constexpr int kAllFrames = -1;
+
+	// Single-state controller whose clip plays frameCount sheet frames starting at firstFrame.
+	// The state and the clip are both called stateName (use it with Animator::Play).
+	// Returns null if the sheet is invalid.
+	std::shared_ptr<const AnimatorController> GetSheetController(SpriteSheet* sheet, float fps, bool loop = true,
+		std::string_view stateName = "Loop", int firstFrame = 0, int frameCount = kAllFrames);
+
+	// Drops every entry built from this sheet. Animators still holding one keep it alive.
+	void ForgetSheet(const SpriteSheet* sheet);
+	void Clear() { m_entries.clear(); }
+	size_t Size() const { return m_entries.size(); }
+
+private:
+	// Clip and controller share one allocation; callers get an aliasing pointer to the controller.
+	struct SheetAnimation {
+		const SpriteSheet* sheet = nullptr;
+		AnimationClip clip;
+		AnimatorController controller;
+	};
+
+	std::unordered_map<AssetId, std::shared_ptr<SheetAnimation>> m_entries;
+};
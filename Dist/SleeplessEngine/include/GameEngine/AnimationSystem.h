@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Animator;
+class AnimationClip;
+class JobSystem;
+class SpriteRenderer;
+
+// What an Animator does while its SpriteRenderer is out of view (SpriteRenderer::IsInView).
+// Triggers are evaluated on the frame they are set either way, so gameplay events are never lost.
+enum class AnimatorCullingMode : std::uint8_t {
+	AlwaysAnimate,  // full update regardless of visibility
+	CullUpdate,     // time keeps running but transitions and sprite writes wait; caught up when seen again
+	CullCompletely, // frozen until seen again
+};
+
+// Advances every enabled Animator in one pass per frame; SleeplessEngine::Run ticks it between
+// Update and LateUpdate, so gameplay parameters set this frame are seen and LateUpdate sees the result.
+// Playback state (clip, time, speed, sampled frame) lives here in parallel arrays indexed by the
+// Animator's slot. Enabled Animators are kept packed at the front, so every pass is a plain loop:
+//   1. visibility + advance time              (split across jobs for large batches)
+//   2. transitions + trigger reset            (main thread, only controllers that have them)
+//   3. sample the clip's local frame          (split across jobs for large batches)
+//   4. push changed frames to SpriteRenderers (main thread)
+// Culled slots (see AnimatorCullingMode) skip everything but the cheap time advance.
+class AnimationSystem {
+public:
+	static AnimationSystem& Get();
+
+	AnimationSystem(const AnimationSystem&) = delete;
+	AnimationSystem& operator=(const AnimationSystem&) = delete;
+
+	// An Animator holds a slot from construction to destruction; only enabled ones are advanced.
+	void Register(Animator* animator);
+	void Unregister(Animator* animator);
+	void SetActive(Animator* animator, bool active);
+
+	// Runs the four passes. Passes 1 and 3 are split across 'jobs' once at least minParallelCount
+	// Animators are enabled (0 = always on the calling thread).
+	void Update(float deltaTime, JobSystem* jobs, int minParallelCount);
+
+	size_t Size() const { return m_animators.size(); }
+	size_t GetActiveCount() const { return m_activeCount; }
+
+private:
+	friend class Animator;
+
+	enum SlotFlags : std::uint8_t {
+		kTimeOverridden = 1 << 0, // SeekNormalized this frame: skip the time advance
+		kClipChanged = 1 << 1,    // sprite needs the new clip's texture + frame size
+		kHasLogic = 1 << 2,       // controller has transitions or triggers to evaluate
+		kTriggerPending = 1 << 3, // a trigger was set since the last state machine step
+		kCulled = 1 << 4,         // out of view this frame (culling mode != AlwaysAnimate)
+		kCatchUp = 1 << 5,        // visible again after CullUpdate: replay skipped transitions
+	};
+
+	AnimationSystem() = default;
+
+	// Swaps two slots in every array and fixes up the Animators' slot indices.
+	void SwapSlots(size_t a, size_t b);
+	void PushFrames();
+
+	// --- Slot access for Animator ---
+	void SetClip(int slot, const AnimationClip* clip, bool restart);
+	void SetTime(int slot, float time) { m_times[static_cast<size_t>(slot)] = time; }
+	float GetTime(int slot) const { return m_times[static_cast<size_t>(slot)]; }
+	void SetSpeed(int slot, float speed) { m_speeds[static_cast<size_t>(slot)] = speed; }
+	float GetSpeed(int slot) const { return m_speeds[static_cast<size_t>(slot)]; }
+	void SetSprite(int slot, SpriteRenderer* sprite);
+	void SetCullingMode(int slot, AnimatorCullingMode mode) { m_cullingModes[static_cast<size_t>(slot)] = mode; }
+	AnimatorCullingMode GetCullingMode(int slot) const { return m_cullingModes[static_cast<size_t>(slot)]; }
+	void SetFlag(int slot, SlotFlags flag, bool on);
+	bool HasFlag(int slot, SlotFlags flag) const { return (m_flags[static_cast<size_t>(slot)] & flag) != 0; }
+
+	std::vector<Animator*> m_animators;
+	std::vector<SpriteRenderer*> m_sprites;
+	std::vector<const AnimationClip*> m_clips;
+	std::vector<float> m_times; // seconds in the current state
+	std::vector<float> m_speeds; // playback rate multiplier
+	std::vector<int> m_localFrames; // sampled by pass 3, -1 = nothing to show
+	std::vector<int> m_appliedFrames; // last local frame pushed to the sprite
+	std::vector<std::uint8_t> m_flags;
+	std::vector<AnimatorCullingMode> m_cullingModes;
+	size_t m_activeCount = 0; // slots [0, m_activeCount) are enabled
+};
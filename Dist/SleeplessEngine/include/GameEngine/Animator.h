@@ -1,47 +1,81 @@
 #pragma once
 
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <vector>
 #include <memory>
 
+#include "AssetHandle.h"
 #include "MonoBehaviour.h"
 #include "Time.hpp"
 
 #include "AnimatorController.h"
 #include "AnimationClip.h"
+#include "AnimationSystem.h"
 
 class SpriteRenderer;
 
 // Animator component: plays back AnimationClips based on an AnimatorController graph.
+// It has no Update of its own: AnimationSystem advances all enabled Animators in one pass,
+// after every behaviour's Update, and owns their playback state (clip, time, speed).
 class Animator final : public MonoBehaviour {
 public:
 	Animator();
-	~Animator() override = default;
+	~Animator() override;
 
 	void Awake() override;
-	void Update() override;
+	void OnEnable() override;
+	void OnDisable() override;
 
 	/// Assign a controller (graph asset). Resets params to defaults if missing,
 	/// and enters the controller's entry state.
+	/// The raw pointer overload does not take ownership: keep the controller alive yourself.
+	/// It compiles the controller if needed (call Compile() yourself after editing a compiled one).
 	void SetController(AnimatorController* controller);
-	AnimatorController* GetController() const { return m_controller; }
+	/// Shared controller (e.g. from AnimationLibrary); the Animator keeps it alive.
+	void SetController(std::shared_ptr<const AnimatorController> controller);
+	const AnimatorController* GetController() const { return m_controller; }
 
 	// Parameter API
-	void SetFloat(const std::string& name, float v);
-	void SetInt(const std::string& name, int v);
-	void SetBool(const std::string& name, bool v);
-	void SetTrigger(const std::string& name);
-
-	float GetFloat(const std::string& name) const;
-	int GetInt(const std::string& name) const;
-	bool GetBool(const std::string& name) const;
-	bool GetTrigger(const std::string& name) const;
+	// Ids come from GetParameterId (or AnimatorController::FindParameterId) and stay valid for the
+	// controller's lifetime; resolve them once instead of passing names every frame.
+	// Unknown ids/names are ignored by setters and read as 0/false.
+	AnimParamId GetParameterId(std::string_view name) const;
+
+	void SetFloat(AnimParamId id, float v);
+	void SetInt(AnimParamId id, int v);
+	void SetBool(AnimParamId id, bool v);
+	void SetTrigger(AnimParamId id);
+
+	float GetFloat(AnimParamId id) const;
+	int GetInt(AnimParamId id) const;
+	bool GetBool(AnimParamId id) const;
+	bool GetTrigger(AnimParamId id) const;
+
+	// Name overloads (one lookup per call)
+	void SetFloat(const std::string& name, float v) { SetFloat(GetParameterId(name), v); }
+	void SetInt(const std::string& name, int v) { SetInt(GetParameterId(name), v); }
+	void SetBool(const std::string& name, bool v) { SetBool(GetParameterId(name), v); }
+	void SetTrigger(const std::string& name) { SetTrigger(GetParameterId(name)); }
+
+	float GetFloat(const std::string& name) const { return GetFloat(GetParameterId(name)); }
+	int GetInt(const std::string& name) const { return GetInt(GetParameterId(name)); }
+	bool GetBool(const std::string& name) const { return GetBool(GetParameterId(name)); }
+	bool GetTrigger(const std::string& name) const { return GetTrigger(GetParameterId(name)); }
 
 	/// Force a state by name (ignores transition rules).
 	void Play(const std::string& stateName, bool restart = true);
 
 	std::string GetCurrentStateName() const;
-	float GetStateTime() const { return m_stateTime; }
+	float GetStateTime() const;
+
+	/// Playback rate multiplier for all states (1 = authored fps, 0 = frozen).
+	void SetSpeed(float speed);
+	float GetSpeed() const;
+
+	/// What to skip while the SpriteRenderer is out of view (default AlwaysAnimate).
+	void SetCullingMode(AnimatorCullingMode mode);
+	AnimatorCullingMode GetCullingMode() const;
 
 	/// Scrub the current state's clip toward a normalized target [0..1] at the given speed
 	/// (normalized units per second). For condition based frames like turning the ship
@@ -50,43 +84,50 @@ public:
 	std::shared_ptr<Component> Clone() const override;
 
 private:
-
-	// Ensure all parameters have values, using controller defaults if needed.
-	void EnsureDefaultsFromController();
-	// Evaluate transitions from the current state, and apply the first valid one.
-	void EvaluateAndApplyTransitions();
-	// Check if a transition can be taken.
-	bool CanTakeTransition(const AnimTransition& tr) const;
+	friend class AnimationSystem;
+
+	// Pass 2 of AnimationSystem::Update: transitions, then the per-frame trigger reset.
+	// catchUp replays the exit-time transitions skipped while culled, carrying the leftover time.
+	void StepStateMachine(bool catchUp);
+	SpriteRenderer* FindSprite();
+
+	// Rebuilds parameter storage and enters the entry state of m_controller.
+	void EnterController(const AnimatorController* previous);
+	// Retains the sprite sheet of every clip the controller can play, so none is evicted under it
+	void RetainClipSheets();
+	// Sizes m_params for the controller: values carry over by name + type from the previous
+	// controller, everything else starts at the controller defaults.
+	void RebindParameters(const AnimatorController* previous);
+	// Evaluate transitions from the current state, and apply the first valid one; returns true if one was taken.
+	bool EvaluateAndApplyTransitions(bool carryOvershoot);
+	// Take a compiled transition if it passes; returns true if taken.
+	// carryOvershoot starts the next state at the time played past the exit time instead of 0.
+	bool TryTakeTransition(const AnimCompiledTransition& tr, bool carryOvershoot);
 	// Check if the conditions for a transition are met.
-	bool ConditionsMet(const AnimTransition& tr) const;
-	// Check if the exit time condition for a transition is met.
-	bool ExitTimeMet(const AnimTransition& tr) const;
+	bool ConditionsMet(const AnimCompiledTransition& tr) const;
+	// Check if the current clip has played past the exit time.
+	bool ExitTimeMet(float exitTimeNormalized) const;
 
-	// Switch to a new state by ID.
-	void SwitchState(int newStateId, bool restartTime);
+	// Switch to a new state by dense index (see AnimatorController::FindStateIndexById).
+	void SwitchState(int newStateIndex, bool restartTime);
 	const AnimState* CurrentState() const;
 
-	void ApplyCurrentClipFrame();
-
-	void ConsumeTriggersUsedBy(const AnimTransition& tr);
+	void ConsumeTriggersUsedBy(const AnimCompiledTransition& tr);
 	void ClearAllTriggers();
 
 private:
-	AnimatorController* m_controller = nullptr;
-
-	std::unordered_map<std::string, float> m_floats;
-	std::unordered_map<std::string, int> m_ints;
-	std::unordered_map<std::string, bool> m_bools;
-	std::unordered_map<std::string, bool> m_triggers;
-
-	int m_stateId = -1; // Current state ID
-	float m_stateTime = 0.0f; // Time spent in current state
-
-	SpriteRenderer* m_sprite = nullptr; // Cached SpriteRenderer
-	Texture* m_lastTexture = nullptr; // To detect texture changes
-	Vector2i m_lastFrameSize = Vector2i::Zero(); // To detect frame size changes
-
-	bool m_timeOverriddenThisFrame = false; // True if SeekNormalized was called this frame
-
-	int m_prevLocalFrame = -1; // To avoid redundant frame sets
+	const AnimatorController* m_controller = nullptr;
+	std::shared_ptr<const AnimatorController> m_sharedController; // keeps shared controllers alive
+	std::vector<AssetHandle<SpriteSheet>> m_sheetHandles;
+
+	// One slot per controller parameter, indexed by AnimParamId; the field used depends on the type.
+	struct ParamValue {
+		float f = 0.0f;
+		int i = 0;
+		bool b = false; // Bool and Trigger
+	};
+	std::vector<ParamValue> m_params;
+
+	int m_stateIndex = -1; // Current state (dense index into the controller's states)
+	int m_slot = -1; // AnimationSystem slot holding clip, state time, speed and the applied frame
 };
@@ -1,10 +1,19 @@
 #pragma once
 
+#include <cstdint>
+#include <functional>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 class AnimationClip;
 
+/// Index of a parameter in AnimatorController::parameters (see FindParameterId).
+using AnimParamId = int;
+constexpr AnimParamId kInvalidAnimParam = -1;
+
 /// Parameter types used by AnimatorController.
 enum class AnimParamType { Float, Int, Bool, Trigger };
 
@@ -55,10 +64,30 @@ struct AnimTransition {
 struct AnimState {
 	int id = -1;
 	std::string name;
-	AnimationClip* clip = nullptr;
+	const AnimationClip* clip = nullptr;
+};
+
+// Compiled condition: the parameter is already an index into the Animator's value array.
+struct AnimCompiledCondition {
+	AnimCondOp op = AnimCondOp::BoolTrue;
+	AnimParamId param = kInvalidAnimParam;
+	float f = 0.0f;
+	int i = 0;
+};
+
+// Compiled transition: target is a dense state index, conditions are a range of the flat condition array.
+struct AnimCompiledTransition {
+	int toIndex = -1;
+	float exitTimeNormalized = -1.0f; // < 0 = no exit time
+	uint32_t conditionBegin = 0;
+	uint32_t conditionCount = 0;
+	bool usesTriggers = false; // any TriggerSet condition to consume when taken
 };
 
 // Immutable graph asset: states + transitions + parameter defaults.
+// Fill the public vectors, then Compile() once: the Animator only reads the compiled tables
+// (dense state indices, per-state transition ranges, flat conditions), which also make state
+// lookups by id or name O(1). Editing the vectors afterwards needs another Compile().
 class AnimatorController {
 public:
 	// Parameter definitions.
@@ -68,19 +97,72 @@ public:
 	std::vector<AnimTransition> transitions;
 	int entryState = -1;
 
+	// Builds the compiled tables. Transitions whose states do not exist are dropped.
+	void Compile();
+	bool IsCompiled() const { return m_compiled; }
+
+	// Parameter id for a name, to cache and pass to the Animator's id overloads.
+	// Returns kInvalidAnimParam if not declared.
+	AnimParamId FindParameterId(std::string_view n) const {
+		for (size_t i = 0; i < parameters.size(); ++i) {
+			if (parameters[i].name == n) return static_cast<AnimParamId>(i);
+		}
+		return kInvalidAnimParam;
+	}
+
 	// Find state by its unique id. Returns nullptr if not found.
 	const AnimState* FindStateById(int id) const {
-		for (const auto& s : states) {
-			if (s.id == id) return &s;
-		}
-		return nullptr;
+		const int index = FindStateIndexById(id);
+		return index >= 0 ? &states[static_cast<size_t>(index)] : nullptr;
 	}
 
 	// Find state id by its unique name. Returns -1 if not found.
-	int FindStateIdByName(const std::string& n) const {
-		for (const auto& s : states) {
-			if (s.name == n) return s.id;
-		}
-		return -1;
+	int FindStateIdByName(std::string_view n) const {
+		const int index = FindStateIndexByName(n);
+		return index >= 0 ? states[static_cast<size_t>(index)].id : -1;
+	}
+
+	// --- Dense state indices (positions in 'states') ---
+	// O(1) once compiled; linear scans before that.
+	int FindStateIndexById(int id) const;
+	int FindStateIndexByName(std::string_view n) const;
+	int GetEntryStateIndex() const { return m_compiled ? m_entryIndex : FindStateIndexById(entryState); }
+
+	// --- Compiled tables (empty until Compile) ---
+	std::span<const AnimCompiledTransition> GetAnyStateTransitions() const {
+		return std::span<const AnimCompiledTransition>(m_transitions.data(), m_anyStateTransitionCount);
 	}
+	std::span<const AnimCompiledTransition> GetTransitionsFrom(int stateIndex) const {
+		if (stateIndex < 0 || static_cast<size_t>(stateIndex) + 1 >= m_transitionStart.size()) return {};
+		const uint32_t begin = m_transitionStart[static_cast<size_t>(stateIndex)];
+		const uint32_t end = m_transitionStart[static_cast<size_t>(stateIndex) + 1];
+		return std::span<const AnimCompiledTransition>(m_transitions.data() + begin, end - begin);
+	}
+	bool HasTransitions() const { return !m_transitions.empty(); }
+	std::span<const AnimCompiledCondition> GetConditions(const AnimCompiledTransition& tr) const {
+		return std::span<const AnimCompiledCondition>(m_conditions.data() + tr.conditionBegin, tr.conditionCount);
+	}
+
+private:
+	struct NameHash {
+		using is_transparent = void;
+		size_t operator()(std::string_view n) const { return std::hash<std::string_view>{}(n); }
+	};
+
+	// Id -> index from the tables below (valid during and after Compile).
+	int IndexOfId(int id) const;
+
+	bool m_compiled = false;
+	bool m_useIdTable = false;
+	int m_entryIndex = -1;
+	// Any-state transitions first, then each state's transitions contiguously.
+	std::vector<AnimCompiledTransition> m_transitions;
+	size_t m_anyStateTransitionCount = 0;
+	// m_transitions range of state i: [m_transitionStart[i], m_transitionStart[i + 1])
+	std::vector<uint32_t> m_transitionStart;
+	std::vector<AnimCompiledCondition> m_conditions;
+	// State id -> index: a direct table when ids are small and dense, otherwise a hash map.
+	std::vector<int> m_indexByIdTable;
+	std::unordered_map<int, int> m_indexByIdMap;
+	std::unordered_map<std::string, int, NameHash, std::equal_to<>> m_indexByName;
 };
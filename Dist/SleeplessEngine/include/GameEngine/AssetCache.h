@@ -0,0 +1,130 @@
+#pragma once
+
+#include "AssetId.h"
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Open-addressing (linear probing) map from AssetId to an owned asset.
+// IDs are already well-mixed hashes, so the slot index is just the low bits.
+// Assets are heap-owned, so pointers handed out stay valid across rehashes until the entry is erased.
+template<typename T>
+class AssetCache {
+public:
+	T* Find(AssetId id) const {
+		if (m_count == 0) return nullptr;
+		for (size_t i = IndexFor(id);; i = (i + 1) & m_mask) {
+			const Slot& slot = m_slots[i];
+			if (!slot.value) return nullptr;
+			if (slot.id == id) return slot.value.get();
+		}
+	}
+
+	bool Contains(AssetId id) const { return Find(id) != nullptr; }
+
+	// Stores 'value' under 'id' (replacing any previous entry) and returns it.
+	T* Insert(AssetId id, std::unique_ptr<T> value) {
+		if (!value) return nullptr;
+		if ((m_count + 1) * 2 > m_slots.size()) {
+			Rehash(m_slots.empty() ? kInitialCapacity : m_slots.size() * 2);
+		}
+
+		size_t i = IndexFor(id);
+		while (m_slots[i].value && m_slots[i].id != id) {
+			i = (i + 1) & m_mask;
+		}
+		if (!m_slots[i].value) {
+			++m_count;
+		}
+		m_slots[i].id = id;
+		m_slots[i].value = std::move(value);
+		return m_slots[i].value.get();
+	}
+
+	// Removes and returns the entry (null if absent), so callers can clean up before it is freed.
+	std::unique_ptr<T> Extract(AssetId id) {
+		if (m_count == 0) return nullptr;
+
+		size_t i = IndexFor(id);
+		while (m_slots[i].value && m_slots[i].id != id) {
+			i = (i + 1) & m_mask;
+		}
+		if (!m_slots[i].value) return nullptr;
+
+		std::unique_ptr<T> removed = std::move(m_slots[i].value);
+		--m_count;
+
+		// Backward-shift deletion keeps probe chains intact without tombstones.
+		size_t hole = i;
+		for (size_t j = (hole + 1) & m_mask; m_slots[j].value; j = (j + 1) & m_mask) {
+			const size_t home = IndexFor(m_slots[j].id);
+			const bool movable = (j > hole) ? (home <= hole || home > j) : (home <= hole && home > j);
+			if (movable) {
+				m_slots[hole] = std::move(m_slots[j]);
+				hole = j;
+			}
+		}
+		m_slots[hole].value.reset();
+		return removed;
+	}
+
+	bool Erase(AssetId id) { return Extract(id) != nullptr; }
+
+	// fn(AssetId, T&) for every entry. Do not insert or erase from inside fn.
+	template<typename Fn>
+	void ForEach(Fn&& fn) const {
+		for (const Slot& slot : m_slots) {
+			if (slot.value) fn(slot.id, *slot.value);
+		}
+	}
+
+	// Erases every entry for which pred(AssetId, T&) is true. Returns the number erased.
+	template<typename Pred>
+	size_t EraseIf(Pred&& pred) {
+		std::vector<AssetId> doomed;
+		ForEach([&](AssetId id, T& value) {
+			if (pred(id, value)) doomed.push_back(id);
+		});
+		for (AssetId id : doomed) {
+			Erase(id);
+		}
+		return doomed.size();
+	}
+
+	void Clear() {
+		m_slots.clear();
+		m_count = 0;
+		m_mask = 0;
+	}
+
+	size_t Size() const { return m_count; }
+	bool IsEmpty() const { return m_count == 0; }
+
+private:
+	static constexpr size_t kInitialCapacity = 64;
+
+	struct Slot {
+		AssetId id = 0;
+		std::unique_ptr<T> value; // null = empty slot
+	};
+
+	size_t IndexFor(AssetId id) const {
+		return static_cast<size_t>(id ^ (id >> 32)) & m_mask;
+	}
+
+	void Rehash(size_t capacity) {
+		std::vector<Slot> old = std::move(m_slots);
+		m_slots = std::vector<Slot>(capacity);
+		m_mask = capacity - 1;
+		m_count = 0;
+		for (Slot& slot : old) {
+			if (slot.value) Insert(slot.id, std::move(slot.value));
+		}
+	}
+
+	std::vector<Slot> m_slots;
+	size_t m_count = 0;
+	size_t m_mask = 0;
+};
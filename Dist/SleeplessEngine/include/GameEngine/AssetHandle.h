@@ -0,0 +1,64 @@
+#pragma once
+
+#include "AssetResidency.h"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+// Counted reference to an AssetManager asset (see AssetManager::Retain). While any handle is alive
+// the asset is never evicted by the memory budget. Sprite sheet and font handles pin their texture.
+// Releasing a handle after its AssetManager is gone, or after the asset was explicitly unloaded,
+// is a harmless no-op.
+template<typename T>
+class AssetHandle {
+public:
+	AssetHandle() = default;
+
+	AssetHandle(const AssetHandle& other)
+		: m_residency(other.m_residency), m_resident(other.m_resident), m_generation(other.m_generation), m_asset(other.m_asset) {
+		if (m_residency) m_residency->Retain(m_resident, m_generation);
+	}
+
+	AssetHandle(AssetHandle&& other) noexcept
+		: m_residency(std::move(other.m_residency))
+		, m_resident(std::exchange(other.m_resident, nullptr))
+		, m_generation(std::exchange(other.m_generation, 0))
+		, m_asset(std::exchange(other.m_asset, nullptr)) {}
+
+	AssetHandle& operator=(AssetHandle other) noexcept {
+		std::swap(m_residency, other.m_residency);
+		std::swap(m_resident, other.m_resident);
+		std::swap(m_generation, other.m_generation);
+		std::swap(m_asset, other.m_asset);
+		return *this;
+	}
+
+	~AssetHandle() { Reset(); }
+
+	void Reset() {
+		if (m_residency) m_residency->Release(m_resident, m_generation);
+		m_residency.reset();
+		m_resident = nullptr;
+		m_generation = 0;
+		m_asset = nullptr;
+	}
+
+	T* Get() const { return m_asset; }
+	T* operator->() const { return m_asset; }
+	T& operator*() const { return *m_asset; }
+	explicit operator bool() const { return m_asset != nullptr; }
+
+private:
+	friend class AssetManager;
+
+	AssetHandle(std::shared_ptr<AssetResidency> residency, const void* resident, T* asset)
+		: m_residency(std::move(residency)), m_resident(resident), m_asset(asset) {
+		if (m_residency) m_generation = m_residency->Retain(m_resident);
+	}
+
+	std::shared_ptr<AssetResidency> m_residency;
+	const void* m_resident = nullptr; // the asset that owns the memory (texture for sheets / fonts)
+	std::uint64_t m_generation = 0; // residency record the reference was counted on
+	T* m_asset = nullptr;
+};
@@ -6,89 +6,270 @@
 #include "Types.hpp"
 #include "Logger.h"
 #include "AudioClip.h"
+#include "AssetId.h"
+#include "AssetCache.h"
+#include "AssetHandle.h"
+#include "AssetManifest.h"
+#include "AnimationLibrary.h"
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <memory>
+#include <deque>
+#include <functional>
+#include <future>
+#include <vector>
 #include "BitmapFont.h"
 
+class JobSystem;
+class AssetPack;
+
+// Timing recorded for every texture / audio clip the AssetManager loads.
+struct AssetLoadStats {
+	AssetId id = 0;
+	std::string key; // relative path
+	std::string type; // "Texture" or "AudioClip"
+	bool async = false;
+	double decodeMs = 0.0; // file read + decode (worker thread for async loads)
+	double uploadMs = 0.0; // main-thread part: texture creation / cache insert
+	double totalMs = 0.0; // request until the asset was usable (includes queueing and budget waits)
+	size_t bytes = 0; // decoded pixel / PCM size
+};
+
+// Resident asset memory as tracked by the AssetManager.
+struct AssetMemoryUsage {
+	size_t textureBytes = 0; // bytes per pixel x width x height
+	size_t audioBytes = 0; // decoded PCM
+	size_t textureCount = 0;
+	size_t audioClipCount = 0;
+	size_t spriteSheetCount = 0;
+	size_t fontCount = 0;
+	size_t peakBytes = 0; // highest TotalBytes() since start / ResetPeakMemoryUsage()
+	size_t budgetBytes = 0; // 0 = unlimited
+	size_t evictedCount = 0;
+
+	size_t TotalBytes() const { return textureBytes + audioBytes; }
+};
+
+using TextureHandle = AssetHandle<Texture>;
+using SpriteSheetHandle = AssetHandle<SpriteSheet>;
+using BitmapFontHandle = AssetHandle<BitmapFont>;
+using AudioClipHandle = AssetHandle<AudioClip>;
+
+// Result of AssetManager::Preload: keeps every preloaded asset resident (see Retain) until destroyed.
+struct AssetPreload {
+	std::vector<TextureHandle> textures;
+	std::vector<SpriteSheetHandle> spriteSheets;
+	std::vector<BitmapFontHandle> fonts;
+	std::vector<AudioClipHandle> audioClips;
+	size_t failedCount = 0; // entries that could not be loaded (already logged)
+	double elapsedMs = 0.0;
+
+	size_t Size() const { return textures.size() + spriteSheets.size() + fonts.size() + audioClips.size(); }
+};
 
 class AssetManager {
 public:
-	AssetManager(Renderer& renderer);
+	// jobs: worker pool used by the *Async loaders. Without one, async loads decode on the calling thread.
+	AssetManager(Renderer& renderer, JobSystem* jobs = nullptr);
+	~AssetManager();
 
 	void SetBasePath(const std::string& basePath);
 
+	// Optional memory-mapped pack (see AssetPackFormat.h). Packed entries are read in place
+	// (keyed by the same relative paths); anything not in the pack falls back to loose files under the base path.
+	bool MountPack(const std::string& packPath);
+	void UnmountPack();
+	bool IsPackMounted() const { return m_pack != nullptr; }
+
 	// Default filtering applied to textures when they are loaded.
 	void SetDefaultTextureScaleMode(TextureScaleMode mode);
 	TextureScaleMode GetDefaultTextureScaleMode() const { return m_defaultTextureScaleMode; }
 
 
-	Texture* LoadTexture(const std::string& relativePath);
-	Texture* LoadTexture(const std::string& relativePath, const Vector3i& colorKey);
+	Texture* LoadTexture(std::string_view relativePath);
+	Texture* LoadTexture(std::string_view relativePath, const Vector3i& colorKey);
 
 	// per-texture override.
 	//If the texture is already loaded, this will APPLY the requested mode
 	// to the cached texture and return it.
-	Texture* LoadTexture(const std::string& relativePath, TextureScaleMode scaleModeOverride);
-	Texture* LoadTexture(const std::string& relativePath, const Vector3i& colorKey, TextureScaleMode scaleModeOverride);
+	Texture* LoadTexture(std::string_view relativePath, TextureScaleMode scaleModeOverride);
+	Texture* LoadTexture(std::string_view relativePath, const Vector3i& colorKey, TextureScaleMode scaleModeOverride);
 
 
+	// Every cache is keyed by a 64-bit AssetId (see AssetId.h) hashed straight from the arguments,
+	// so a repeat load is a hash plus an open-addressing probe, with no string building or allocation.
+
 	// Sprite sheets are cached assets (Texture + frame size) so multiple Animators can share them.
-	SpriteSheet* LoadSpriteSheet(const std::string& textureRelativePath, const Vector2i& frameSize);
-	SpriteSheet* LoadSpriteSheet(const std::string& sheetKey, const std::string& textureRelativePath, const Vector2i& frameSize);
+	SpriteSheet* LoadSpriteSheet(std::string_view textureRelativePath, const Vector2i& frameSize);
+	SpriteSheet* LoadSpriteSheet(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize);
 
 	// Sprite sheets with a color key 
-	SpriteSheet* LoadSpriteSheet(const std::string& textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey);
-	SpriteSheet* LoadSpriteSheet(const std::string& sheetKey, const std::string& textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey);
+	SpriteSheet* LoadSpriteSheet(std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey);
+	SpriteSheet* LoadSpriteSheet(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey);
 
 	// Overloads to apply a scale mode override to the
 	// underlying texture used by the sprite sheet.
-	SpriteSheet* LoadSpriteSheet(const std::string& textureRelativePath, const Vector2i& frameSize, TextureScaleMode textureScaleModeOverride);
-	SpriteSheet* LoadSpriteSheet(const std::string& sheetKey, const std::string& textureRelativePath, const Vector2i& frameSize, TextureScaleMode textureScaleModeOverride);
+	SpriteSheet* LoadSpriteSheet(std::string_view textureRelativePath, const Vector2i& frameSize, TextureScaleMode textureScaleModeOverride);
+	SpriteSheet* LoadSpriteSheet(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize, TextureScaleMode textureScaleModeOverride);
 
 	// Color key + scale mode override.
-	SpriteSheet* LoadSpriteSheet(const std::string& textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride);
-	SpriteSheet* LoadSpriteSheet(const std::string& sheetKey, const std::string& textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride);
-	SpriteSheet* GetSpriteSheet(const std::string& sheetKey);
-	bool IsSpriteSheetLoaded(const std::string& sheetKey) const;
-	void UnloadSpriteSheet(const std::string& sheetKey);
+	SpriteSheet* LoadSpriteSheet(std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride);
+	SpriteSheet* LoadSpriteSheet(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride);
+	SpriteSheet* GetSpriteSheet(std::string_view sheetKey);
+	// Lookup by a precomputed AssetIds::FromKey(sheetKey)
+	SpriteSheet* GetSpriteSheet(AssetId sheetId) const;
+	bool IsSpriteSheetLoaded(std::string_view sheetKey) const;
+	void UnloadSpriteSheet(std::string_view sheetKey);
 	void UnloadAllSpriteSheets();
 
-	Texture* GetTexture(const std::string& relativePath) const;
-	bool IsTextureLoaded(const std::string& relativePath) const;
-	void UnloadTexture(const std::string& relativePath);
+	// Shared single-state animations built from cached sprite sheets (see AnimationLibrary).
+	AnimationLibrary& GetAnimationLibrary() { return m_animations; }
+
+	Texture* GetTexture(std::string_view relativePath) const;
+	bool IsTextureLoaded(std::string_view relativePath) const;
+	void UnloadTexture(std::string_view relativePath);
 	void UnloadAllTextures();
 
 	// --- Audio ---
-	AudioClip* LoadAudioClip(const std::string& relativePath);
-	AudioClip* GetAudioClip(const std::string& relativePath) const;
-	bool IsAudioClipLoaded(const std::string& relativePath) const;
-	void UnloadAudioClip(const std::string& relativePath);
+	AudioClip* LoadAudioClip(std::string_view relativePath);
+	AudioClip* GetAudioClip(std::string_view relativePath) const;
+	bool IsAudioClipLoaded(std::string_view relativePath) const;
+	void UnloadAudioClip(std::string_view relativePath);
 	void UnloadAllAudioClips();
 
 	// --- Bitmap fonts ---
-	BitmapFont* LoadFont(const std::string& relativePath, const Vector2i& glyphSize, unsigned char firstChar = 32);
-	BitmapFont* LoadFont(const std::string& relativePath, const Vector2i& glyphSize, const Vector3i& colorKey, unsigned char firstChar = 32);
-	BitmapFont* LoadFont(const std::string& relativePath, const Vector2i& glyphSize, unsigned char firstChar, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride);
+	BitmapFont* LoadFont(std::string_view relativePath, const Vector2i& glyphSize, unsigned char firstChar = 32);
+	BitmapFont* LoadFont(std::string_view relativePath, const Vector2i& glyphSize, const Vector3i& colorKey, unsigned char firstChar = 32);
+	BitmapFont* LoadFont(std::string_view relativePath, const Vector2i& glyphSize, unsigned char firstChar, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride);
 
-	BitmapFont* LoadFont(const std::string& fontKey, const std::string& relativePath, const Vector2i& glyphSize, unsigned char firstChar = 32);
-	BitmapFont* LoadFont(const std::string& fontKey, const std::string& relativePath, const Vector2i& glyphSize, const Vector3i& colorKey, unsigned char firstChar = 32);
-	BitmapFont* LoadFont(const std::string& fontKey, const std::string& relativePath, const Vector2i& glyphSize, unsigned char firstChar, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride);
+	BitmapFont* LoadFont(std::string_view fontKey, std::string_view relativePath, const Vector2i& glyphSize, unsigned char firstChar = 32);
+	BitmapFont* LoadFont(std::string_view fontKey, std::string_view relativePath, const Vector2i& glyphSize, const Vector3i& colorKey, unsigned char firstChar = 32);
+	BitmapFont* LoadFont(std::string_view fontKey, std::string_view relativePath, const Vector2i& glyphSize, unsigned char firstChar, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride);
 
-	BitmapFont* GetFont(const std::string& keyOrRelativePath) const;
-	bool IsFontLoaded(const std::string& keyOrRelativePath) const;
-	void UnloadFont(const std::string& keyOrRelativePath);
+	BitmapFont* GetFont(std::string_view keyOrRelativePath) const;
+	bool IsFontLoaded(std::string_view keyOrRelativePath) const;
+	void UnloadFont(std::string_view keyOrRelativePath);
 	void UnloadAllFonts();
 
+	// --- Async loading ---
+	// File I/O and decoding run on the JobSystem; the final texture upload and cache insert happen
+	// in Update() on the main thread. Futures become ready during Update(), so never block on one
+	// from the main thread before the load has finished (poll it, or call WaitForPendingLoads()).
+	// Loads of an asset that is already cached or already in flight share the same result.
+	std::shared_future<Texture*> LoadTextureAsync(std::string_view relativePath);
+	std::shared_future<Texture*> LoadTextureAsync(std::string_view relativePath, const Vector3i& colorKey);
+	std::shared_future<Texture*> LoadTextureAsync(std::string_view relativePath, const Vector3i& colorKey, TextureScaleMode scaleModeOverride);
+
+	std::shared_future<SpriteSheet*> LoadSpriteSheetAsync(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize);
+	std::shared_future<SpriteSheet*> LoadSpriteSheetAsync(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey);
+
+	std::shared_future<BitmapFont*> LoadFontAsync(std::string_view fontKey, std::string_view relativePath, const Vector2i& glyphSize, const Vector3i& colorKey, unsigned char firstChar = 32);
+
+	std::shared_future<AudioClip*> LoadAudioClipAsync(std::string_view relativePath);
+
+	// Called once per frame on the main thread: finishes decoded loads. At most
+	// 'upload budget' bytes of texture data are uploaded per call (always at least one texture).
+	void Update();
+
+	// Blocks until every queued async load has finished, ignoring the upload budget.
+	void WaitForPendingLoads();
+
+	void SetUploadBudgetBytes(size_t bytesPerFrame) { m_uploadBudgetBytes = bytesPerFrame; }
+	size_t GetUploadBudgetBytes() const { return m_uploadBudgetBytes; }
+
+	bool IsLoading() const { return GetPendingLoadCount() > 0; }
+	size_t GetPendingLoadCount() const;
+
+	// --- Preloading ---
+	// Issues every manifest entry through the async loaders (decoding in parallel on the JobSystem),
+	// then blocks until all of them are resident. Entries already cached cost a lookup.
+	AssetPreload Preload(const AssetManifest& manifest);
+
+	// While enabled, a synchronous Load* that has to read from disk logs a warning: it is a
+	// first-use stall that the active scene's manifest should have covered.
+	void SetReportLazyLoads(bool enabled) { m_reportLazyLoads = enabled; }
+	bool IsReportingLazyLoads() const { return m_reportLazyLoads; }
+
+	const std::vector<AssetLoadStats>& GetLoadStats() const { return m_loadStats; }
+	void ClearLoadStats() { m_loadStats.clear(); }
+
+	// --- Memory budget ---
+	// With a budget set, Update() evicts unreferenced textures and audio clips, least recently used
+	// first, until usage fits. An asset counts as used when it is loaded or retained, and is only
+	// considered once a later frame has begun, so a pointer from Load* stays valid for the current
+	// frame. Keep anything you hold across frames alive with a handle from Retain(); the engine
+	// components do this for what they are given (SpriteRenderer, UIImage: texture; TextRenderer,
+	// UILabel: font; AudioSource: clip; Animator: the sheets of its controller's clips).
+	// Sprite sheets and fonts built on an evicted texture are dropped with it.
+	TextureHandle Retain(Texture* texture);
+	SpriteSheetHandle Retain(SpriteSheet* sheet);
+	BitmapFontHandle Retain(BitmapFont* font);
+	AudioClipHandle Retain(AudioClip* clip);
+
+	void SetMemoryBudgetBytes(size_t bytes) { m_memoryBudgetBytes = bytes; }
+	size_t GetMemoryBudgetBytes() const { return m_memoryBudgetBytes; }
+	// Evicts down to the budget now (Update() does this every frame). Returns the bytes freed.
+	size_t EnforceMemoryBudget();
+
+	AssetMemoryUsage GetMemoryUsage() const;
+	void ResetPeakMemoryUsage();
+
 private:
-	Texture* LoadTextureInternal(const std::string& relativePath, const Vector3i* colorKey, const TextureScaleMode* scaleModeOverride);
-	std::string BuildDefaultSpriteSheetKey(const std::string& textureRelativePath, const Vector2i& frameSize) const;
+	struct AsyncTextureLoad;
+	struct AsyncAudioLoad;
+	struct LoadInbox;
+
+	std::shared_future<Texture*> LoadTextureAsyncInternal(std::string_view relativePath, const Vector3i* colorKey, const TextureScaleMode* scaleModeOverride);
+	std::shared_future<SpriteSheet*> LoadSpriteSheetAsyncInternal(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i* colorKey);
+	SpriteSheet* LoadSpriteSheetInternal(AssetId sheetId, std::string_view sheetName, std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i* colorKey, const TextureScaleMode* scaleModeOverride);
+	BitmapFont* LoadFontInternal(std::string_view fontKey, std::string_view relativePath, const Vector2i& glyphSize, unsigned char firstChar, const Vector3i* colorKey, const TextureScaleMode* scaleModeOverride);
+	// Removes sprite sheets and fonts built on this texture.
+	void DropTextureDependents(const Texture* texture);
+	// Finishes decoded loads and resolves dependents (Update() without the per-frame budget work).
+	void PumpLoads();
+	// Residency bookkeeping for a newly cached asset; updates the peak.
+	void TrackResident(const void* asset, AssetKind kind, AssetId id, size_t bytes);
+	bool Evict(const void* asset);
+	void ReportLazyLoad(const char* type, const std::string& path) const;
+	void FinishTextureLoad(AsyncTextureLoad& load);
+	void FinishAudioLoad(AsyncAudioLoad& load);
+	// Runs sprite sheet / font creation whose texture has resolved.
+	void ResolveDependents();
+	void RunJob(std::function<void()> job);
+
+private:
+	Texture* LoadTextureInternal(std::string_view relativePath, const Vector3i* colorKey, const TextureScaleMode* scaleModeOverride);
 
 	Renderer& m_renderer;
+	JobSystem* m_jobs = nullptr;
+	std::shared_ptr<const AssetPack> m_pack;
 	std::string m_basePath;
 	TextureScaleMode m_defaultTextureScaleMode = TextureScaleMode::Linear;
-	std::unordered_map<std::string, std::unique_ptr<Texture>> m_textures;
-	std::unordered_map<std::string, std::unique_ptr<BitmapFont>> m_fonts;
-	std::unordered_map<std::string, SpriteSheet> m_spriteSheets;
-	std::unordered_map<std::string, std::unique_ptr<AudioClip>> m_audioClips;
+	AssetCache<Texture> m_textures; // path (+ color key)
+	AssetCache<BitmapFont> m_fonts; // font key
+	AssetCache<SpriteSheet> m_spriteSheets; // sheet key, or path + frame size (+ color key)
+	AnimationLibrary m_animations; // built from m_spriteSheets; forgets a sheet when it goes
+	AssetCache<AudioClip> m_audioClips; // path
+
+	// Async state (main thread only, except the inbox which workers push into)
+	std::shared_ptr<LoadInbox> m_inbox;
+	std::unordered_map<AssetId, std::shared_ptr<AsyncTextureLoad>> m_pendingTextures;
+	std::unordered_map<AssetId, std::shared_ptr<AsyncAudioLoad>> m_pendingAudioClips;
+	std::unordered_map<AssetId, std::shared_future<SpriteSheet*>> m_pendingSpriteSheets;
+	std::unordered_map<AssetId, std::shared_future<BitmapFont*>> m_pendingFonts;
+	std::deque<std::shared_ptr<AsyncTextureLoad>> m_decodedTextures; // decoded, waiting for upload budget
+	// Sprite sheet / font creation waiting on a texture; returns true once resolved.
+	// abandon = true resolves the promise to nullptr without building anything (teardown).
+	std::vector<std::function<bool(bool abandon)>> m_dependents;
+	size_t m_uploadBudgetBytes = 8 * 1024 * 1024;
+	std::vector<AssetLoadStats> m_loadStats;
+	bool m_reportLazyLoads = false;
+
+	// Memory budget (shared with handles, which release into it)
+	std::shared_ptr<AssetResidency> m_residency;
+	size_t m_memoryBudgetBytes = 0;
+	size_t m_peakBytes = 0;
+	size_t m_evictedCount = 0;
+	std::uint64_t m_frame = 0;
 };
\ No newline at end of file
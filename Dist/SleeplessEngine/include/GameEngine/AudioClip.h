@@ -8,6 +8,7 @@
 
 // A loaded piece of PCM audio data (currently WAV via SDL_LoadWAV).
 // This is an engine asset (owned/cached by AssetManager).
+// AssetManager converts the PCM to Audio::GetMixSpec() on load so the mixer can read it directly.
 struct AudioClip {
 	std::string name;                   // cache key / debug name
 	SDL_AudioSpec spec{};               // format of the PCM data
@@ -1,12 +1,14 @@
 #pragma once
 
+#include "AssetHandle.h"
 #include "MonoBehaviour.h"
 
-#include <SDL3/SDL.h>
+#include <cstdint>
 
 struct AudioClip;
 
-// AudioSource component: plays back an AudioClip with adjustable gain/pitch/looping.
+// AudioSource component: plays back an AudioClip with adjustable gain/pitch/pan/looping.
+// Playback runs on a mixer voice; every call here only posts a command to the audio thread.
 class AudioSource : public MonoBehaviour {
 public:
 	AudioSource();
@@ -15,7 +17,7 @@ public:
 	void SetClip(AudioClip* clip);
 	AudioClip* GetClip() const { return m_clip; }
 
-	void SetLoop(bool loop) { m_loop = loop; }
+	void SetLoop(bool loop);
 	bool GetLoop() const { return m_loop; }
 
 	void SetGain(float gain);
@@ -24,28 +26,34 @@ public:
 	void SetPitch(float ratio);
 	float GetPitch() const { return m_pitch; }
 
+	// -1 = left, 0 = centre, 1 = right
+	void SetPan(float pan);
+	float GetPan() const { return m_pan; }
+
 	void Play();
 	void Play(AudioClip* clip, bool loop = false);
 	void Stop();
 
-	bool IsPlaying() const { return m_stream != nullptr; }
+	bool IsPlaying() const;
 
 	std::shared_ptr<Component> Clone() const override;
 
 protected:
-	void Update() override;
 	void OnDisable() override;
 	void OnDestroy() override;
 
 private:
-	void CreateStreamIfNeeded(); // creates m_stream from m_clip
-	void DestroyStream();
-	void QueueFullClip();
+	void AcquireVoiceIfNeeded(); // reserves a mixer voice for this source
+	void ReleaseVoice();
 
 private:
 	AudioClip* m_clip = nullptr;
-	SDL_AudioStream* m_stream = nullptr;
+	// Keeps an AssetManager clip from being evicted while this source can play it
+	AssetHandle<AudioClip> m_clipHandle;
+	int m_voice = -1; // Audio::kInvalidVoice
+	std::uint32_t m_playSerial = 0; // 0 = not playing
 	bool m_loop = false;
 	float m_gain = 1.0f;
 	float m_pitch = 1.0f;
+	float m_pan = 0.0f;
 };
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <vector>
+
+// GPU-ready texture produced offline by AssetPacker --bake-color-key and stored in an asset pack:
+//
+//   Header
+//   pixels   height rows of 'pitch' bytes, RGBA8 (R first in memory), color key already turned into alpha 0
+//
+// AssetManager uploads these directly with SDL_UpdateTexture, skipping BMP decode and format conversion.
+// The pack entry ID is AssetIds::BakedTexture(texture ID), so a texture and its baked form can live in one pack.
+namespace BakedTextureFormat {
+	constexpr std::uint32_t kMagic = 0x58544C53; // "SLTX"
+	constexpr std::uint32_t kVersion = 1;
+
+	enum Flags : std::uint32_t {
+		kPremultipliedAlpha = 1u << 0,
+	};
+
+	struct Header {
+		std::uint32_t magic = kMagic;
+		std::uint32_t version = kVersion;
+		std::uint32_t width = 0;
+		std::uint32_t height = 0;
+		std::uint32_t pitch = 0;
+		std::uint32_t flags = 0;
+		std::uint32_t reserved[2] = {};
+	};
+	static_assert(sizeof(Header) == 32, "Baked texture header layout changed");
+
+	// Returns the header if 'blob' is a complete baked texture, otherwise null. Pixels follow the header.
+	inline const Header* Parse(std::span<const std::uint8_t> blob) {
+		if (blob.size() < sizeof(Header)) return nullptr;
+		const Header* header = reinterpret_cast<const Header*>(blob.data());
+		if (header->magic != kMagic || header->version != kVersion) return nullptr;
+		if (header->width == 0 || header->height == 0 || header->pitch < header->width * 4) return nullptr;
+		const std::uint64_t pixelBytes = static_cast<std::uint64_t>(header->pitch) * header->height;
+		if (pixelBytes > blob.size() - sizeof(Header)) return nullptr;
+		return header;
+	}
+
+	inline const std::uint8_t* Pixels(const Header* header) {
+		return reinterpret_cast<const std::uint8_t*>(header) + sizeof(Header);
+	}
+
+	// The runtime color key semantics: pixels whose RGB equals the key become fully transparent.
+	inline void ApplyColorKey(std::uint8_t* rgba, std::size_t pixelCount, std::uint8_t r, std::uint8_t g, std::uint8_t b) {
+		for (std::size_t i = 0; i < pixelCount; ++i, rgba += 4) {
+			if (rgba[0] == r && rgba[1] == g && rgba[2] == b) {
+				rgba[3] = 0;
+			}
+		}
+	}
+
+	inline void PremultiplyAlpha(std::uint8_t* rgba, std::size_t pixelCount) {
+		for (std::size_t i = 0; i < pixelCount; ++i, rgba += 4) {
+			const unsigned a = rgba[3];
+			if (a == 255) continue;
+			// Rounded x * a / 255
+			for (int c = 0; c < 3; ++c) {
+				const unsigned v = rgba[c] * a + 128;
+				rgba[c] = static_cast<std::uint8_t>((v + (v >> 8)) >> 8);
+			}
+		}
+	}
+
+	// Uncompressed 1/4/8-bit palettized and 24-bit BMPs (what the game ships) to tightly packed RGBA8.
+	// Anything else is reported in 'error' and left to the runtime BMP path.
+	inline bool DecodeBmp(std::span<const std::uint8_t> bmp, std::vector<std::uint8_t>& rgba, std::uint32_t& width, std::uint32_t& height, std::string& error) {
+		if (bmp.size() < 54 || bmp[0] != 'B' || bmp[1] != 'M') {
+			error = "not a BMP";
+			return false;
+		}
+
+		const auto read32 = [&bmp](std::size_t offset) { std::uint32_t v; std::memcpy(&v, bmp.data() + offset, sizeof(v)); return v; };
+		const std::uint32_t pixelOffset = read32(10);
+		const std::uint32_t dibSize = read32(14);
+		const std::int32_t w = static_cast<std::int32_t>(read32(18));
+		const std::int32_t h = static_cast<std::int32_t>(read32(22));
+		const std::uint16_t bpp = static_cast<std::uint16_t>(bmp[28] | (bmp[29] << 8));
+		const std::uint32_t compression = read32(30);
+		const std::uint32_t colorsUsed = read32(46);
+
+		if (dibSize < 40 || compression != 0 || w <= 0 || h == 0 || (bpp != 1 && bpp != 4 && bpp != 8 && bpp != 24)) {
+			error = "unsupported BMP variant (" + std::to_string(bpp) + " bpp, compression " + std::to_string(compression) + ")";
+			return false;
+		}
+
+		width = static_cast<std::uint32_t>(w);
+		height = static_cast<std::uint32_t>(h < 0 ? -h : h);
+		const bool topDown = h < 0;
+		const std::size_t stride = ((static_cast<std::size_t>(width) * bpp + 31) / 32) * 4;
+		if (pixelOffset > bmp.size() || stride * height > bmp.size() - pixelOffset) {
+			error = "truncated pixel data";
+			return false;
+		}
+
+		const std::size_t paletteOffset = 14 + static_cast<std::size_t>(dibSize);
+		const std::size_t paletteCount = bpp <= 8 ? (colorsUsed ? colorsUsed : (std::size_t{ 1 } << bpp)) : 0;
+		if (paletteOffset + paletteCount * 4 > bmp.size()) {
+			error = "truncated palette";
+			return false;
+		}
+		const std::uint8_t* palette = bmp.data() + paletteOffset;
+
+		rgba.resize(static_cast<std::size_t>(width) * height * 4);
+		for (std::uint32_t y = 0; y < height; ++y) {
+			const std::uint32_t srcRow = topDown ? y : height - 1 - y;
+			const std::uint8_t* src = bmp.data() + pixelOffset + srcRow * stride;
+			std::uint8_t* dst = rgba.data() + static_cast<std::size_t>(y) * width * 4;
+
+			for (std::uint32_t x = 0; x < width; ++x, dst += 4) {
+				if (bpp == 24) {
+					dst[0] = src[x * 3 + 2];
+					dst[1] = src[x * 3 + 1];
+					dst[2] = src[x * 3 + 0];
+				}
+				else {
+					const std::size_t bit = static_cast<std::size_t>(x) * bpp;
+					const unsigned index = (src[bit / 8] >> (8 - bpp - bit % 8)) & ((1u << bpp) - 1);
+					if (index >= paletteCount) {
+						error = "palette index out of range";
+						return false;
+					}
+					dst[0] = palette[index * 4 + 2];
+					dst[1] = palette[index * 4 + 1];
+					dst[2] = palette[index * 4 + 0];
+				}
+				dst[3] = 255;
+			}
+		}
+		return true;
+	}
+
+	// The whole baked entry for a BMP (header, then pixels keyed and optionally premultiplied), as
+	// AssetPacker stores it.
+	inline bool Bake(std::span<const std::uint8_t> bmp, std::uint8_t keyR, std::uint8_t keyG, std::uint8_t keyB, bool premultiply, std::vector<std::uint8_t>& blob, std::string& error) {
+		std::vector<std::uint8_t> rgba;
+		Header header;
+		if (!DecodeBmp(bmp, rgba, header.width, header.height, error)) {
+			return false;
+		}
+
+		const std::size_t pixelCount = static_cast<std::size_t>(header.width) * header.height;
+		ApplyColorKey(rgba.data(), pixelCount, keyR, keyG, keyB);
+		if (premultiply) {
+			PremultiplyAlpha(rgba.data(), pixelCount);
+		}
+		header.pitch = header.width * 4;
+		header.flags = premultiply ? static_cast<std::uint32_t>(kPremultipliedAlpha) : 0u;
+
+		blob.resize(sizeof(header) + rgba.size());
+		std::memcpy(blob.data(), &header, sizeof(header));
+		std::memcpy(blob.data() + sizeof(header), rgba.data(), rgba.size());
+		return true;
+	}
+}
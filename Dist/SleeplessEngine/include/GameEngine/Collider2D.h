@@ -1,20 +1,35 @@
 #pragma once
 
 #include <box2d/box2d.h>
+#include <cstdint>
 #include <memory>
+#include <string_view>
+#include "CollisionLayers.h"
 #include "Component.h"
+#include "ContactCache.h"
 #include "Types.hpp"
 
 class Rigidbody2D;
 
 // Base collider component that owns a Box2D shape
 class Collider2D : public Component {
+	friend class Physics2DWorld;
+
 public:
-	// Creates a collider component with default settings
-	Collider2D() = default;
+	// Concrete collider type, so callers can switch on it without RTTI
+	enum class ShapeType : std::uint8_t {
+		Box,
+		Circle
+	};
+
+	// Creates a collider component of the given shape with default settings
+	explicit Collider2D(ShapeType shapeType) : m_shapeType(shapeType) {}
 	// Releases collider resources.
 	~Collider2D() override = default;
 
+	// Returns the concrete collider type
+	ShapeType GetShapeType() const { return m_shapeType; }
+
 	// Initializes the collider and creates its physics shape
 	void Initialize();
 	// Shuts down the collider and releases physics resources
@@ -32,6 +47,15 @@ public:
 	bool ShouldSensorEvent() const { return m_shouldSensorEvent; }
 	void SetShouldSensorEvent(bool shouldEvent) { m_shouldSensorEvent = shouldEvent; }
 
+	// Returns the collision layer (see CollisionLayerMatrix)
+	int GetLayer() const { return m_layer; }
+	// Moves the collider to another collision layer
+	void SetLayer(int layer);
+	// Moves the collider to a layer by name; throws if the physics world has no such layer
+	void SetLayer(std::string_view layerName);
+	// Reapplies the layer's category/mask bits to the live shape
+	void RefreshFilter();
+
 	// Sets the local offset of the collider shape
 	void SetOffset(const Vector2f& offset);
 	// Returns the local offset of the collider shape
@@ -55,6 +79,8 @@ public:
 protected:
 	// Creates the Box2D shape for this collider type.
 	virtual b2ShapeId CreateShape(b2BodyId bodyId, const b2ShapeDef& shapeDef) = 0;
+	// Gives a recycled Box2D shape this collider's geometry.
+	virtual void SetShapeGeometry(b2ShapeId shapeId) = 0;
 	// Tears down collider resources when destroyed.
 	void DestroyImmediateInternal() override;
 
@@ -65,13 +91,16 @@ protected:
 	// Returns the body to attach shapes to (requires Rigidbody2D).
 	b2BodyId ResolveBody() const;
 
+	const ShapeType m_shapeType; // Concrete collider type
 	b2ShapeId m_shapeId = b2_nullShapeId; // Box2D shape handle
 	Rigidbody2D* m_attachedBody = nullptr; // Attached rigidbody (if any)
+	std::uint32_t m_contactId = ContactCache::kInvalidId; // Assigned by Physics2DWorld::RegisterCollider
 
 	Vector2f m_offset = Vector2f::Zero(); // Local shape offset
 	float m_density = 1.0f; // Shape density for mass calculation
 	float m_friction = 0.3f; // Shape friction
 	float m_restitution = 0.0f; // Shape restitution (bounciness)
+	int m_layer = CollisionLayerMatrix::kDefaultLayer; // Collision layer
 	bool m_isTrigger = false; // Whether the collider is a trigger
 	bool m_shouldSensorEvent = true; // Whether sensor events should be generated
 };
@@ -79,6 +108,8 @@ protected:
 /// Box-shaped collider component.
 class BoxCollider2D : public Collider2D {
 public:
+	/// Creates a 1x1 box collider.
+	BoxCollider2D() : Collider2D(ShapeType::Box) {}
 	/// Sets the local size of the box shape.
 	void SetSize(const Vector2f& size);
 	/// Returns the local size of the box shape.
@@ -89,14 +120,21 @@ public:
 protected:
 	/// Creates the Box2D polygon shape for the box.
 	b2ShapeId CreateShape(b2BodyId bodyId, const b2ShapeDef& shapeDef) override;
+	/// Sets a recycled shape to the box polygon.
+	void SetShapeGeometry(b2ShapeId shapeId) override;
 
 private:
+	/// Builds the box polygon from size and offset.
+	b2Polygon MakeBox() const;
+
 	Vector2f m_size = Vector2f(1.0f, 1.0f);
 };
 
 /// Circle-shaped collider component.
 class CircleCollider2D : public Collider2D {
 public:
+	/// Creates a circle collider with radius 0.5.
+	CircleCollider2D() : Collider2D(ShapeType::Circle) {}
 	/// Sets the radius of the circle shape.
 	void SetRadius(float radius);
 	/// Returns the radius of the circle shape.
@@ -107,7 +145,12 @@ public:
 protected:
 	/// Creates the Box2D circle shape for the collider.
 	b2ShapeId CreateShape(b2BodyId bodyId, const b2ShapeDef& shapeDef) override;
+	/// Sets a recycled shape to the circle.
+	void SetShapeGeometry(b2ShapeId shapeId) override;
 
 private:
+	/// Builds the circle from radius and offset.
+	b2Circle MakeCircle() const;
+
 	float m_radius = 0.5f;
 };
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Named collision layers plus a symmetric layer-vs-layer matrix of which pairs may touch.
+// Every Collider2D sits on one layer; Physics2DWorld turns its layer's row into Box2D
+// category/mask bits, so pairs that can never interact are rejected in the broadphase and
+// never produce contact or sensor events.
+// Layer 0 is "Default". Until the matrix is edited every layer collides with every other.
+class CollisionLayerMatrix {
+public:
+	// One Box2D category bit per layer.
+	static constexpr int kMaxLayers = 64;
+	static constexpr int kDefaultLayer = 0;
+	// Layer mask matching every layer, for queries
+	static constexpr std::uint64_t kEveryLayer = ~std::uint64_t{ 0 };
+
+	CollisionLayerMatrix() {
+		m_names[kDefaultLayer] = "Default";
+		m_masks.fill(~std::uint64_t{ 0 });
+	}
+
+	static bool IsValidLayer(int layer) { return layer >= 0 && layer < kMaxLayers; }
+
+	CollisionLayerMatrix& SetLayerName(int layer, std::string_view name) {
+		if (IsValidLayer(layer)) {
+			m_names[static_cast<size_t>(layer)] = std::string(name);
+		}
+		return *this;
+	}
+
+	// Returns the index of the named layer, or -1 if no layer has that name.
+	int GetLayer(std::string_view name) const {
+		for (int i = 0; i < kMaxLayers; ++i) {
+			if (!m_names[static_cast<size_t>(i)].empty() && m_names[static_cast<size_t>(i)] == name) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	const std::string& GetLayerName(int layer) const {
+		static const std::string empty;
+		return IsValidLayer(layer) ? m_names[static_cast<size_t>(layer)] : empty;
+	}
+
+	// Turns every pair off; enable the ones the game needs with SetCollision.
+	CollisionLayerMatrix& ClearCollisions() {
+		m_masks.fill(0);
+		return *this;
+	}
+
+	// Enables or disables contacts between two layers (both directions).
+	CollisionLayerMatrix& SetCollision(int a, int b, bool collide) {
+		if (!IsValidLayer(a) || !IsValidLayer(b)) {
+			return *this;
+		}
+		SetBit(a, b, collide);
+		SetBit(b, a, collide);
+		return *this;
+	}
+
+	bool Collides(int a, int b) const {
+		return IsValidLayer(a) && IsValidLayer(b) && (m_masks[static_cast<size_t>(a)] & GetCategoryBits(b)) != 0;
+	}
+
+	static std::uint64_t GetCategoryBits(int layer) {
+		return IsValidLayer(layer) ? std::uint64_t{ 1 } << layer : 0;
+	}
+
+	std::uint64_t GetMaskBits(int layer) const {
+		return IsValidLayer(layer) ? m_masks[static_cast<size_t>(layer)] : 0;
+	}
+
+private:
+	void SetBit(int row, int column, bool on) {
+		std::uint64_t& mask = m_masks[static_cast<size_t>(row)];
+		mask = on ? (mask | GetCategoryBits(column)) : (mask & ~GetCategoryBits(column));
+	}
+
+	std::array<std::string, kMaxLayers> m_names;
+	std::array<std::uint64_t, kMaxLayers> m_masks{};
+};
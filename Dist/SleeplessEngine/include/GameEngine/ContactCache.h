@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Collider2D;
+
+// Set of touching collider pairs, used by Physics2DWorld to synthesize Stay callbacks.
+// Colliders are identified by the dense id Physics2DWorld hands out at registration.
+// Pairs live in a dense array (walked every step) and are found through an open-addressing
+// table keyed by the packed 64-bit pair id. Each collider also keeps the list of its partners,
+// so dropping a collider costs O(its own pairs). Once the table and lists have grown to the
+// working set, Insert/Erase do not allocate.
+class ContactCache {
+public:
+	static constexpr std::uint32_t kInvalidId = 0xFFFFFFFFu;
+
+	struct Pair {
+		Collider2D* a = nullptr;
+		Collider2D* b = nullptr;
+	};
+
+	// Returns false if the pair was already present.
+	bool Insert(std::uint32_t idA, Collider2D* a, std::uint32_t idB, Collider2D* b);
+	// Returns false if the pair was not present.
+	bool Erase(std::uint32_t idA, std::uint32_t idB);
+	// Drops every pair involving the collider.
+	void EraseAll(std::uint32_t id);
+	void Clear();
+
+	// Active pairs in no particular order. Erasing swaps the last pair into the hole.
+	const std::vector<Pair>& GetPairs() const { return m_pairs; }
+	size_t Size() const { return m_pairs.size(); }
+
+private:
+	static constexpr std::uint64_t kEmptyKey = ~std::uint64_t{ 0 };
+
+	static std::uint64_t MakeKey(std::uint32_t a, std::uint32_t b) {
+		return (a < b) ? (std::uint64_t{ a } << 32) | b : (std::uint64_t{ b } << 32) | a;
+	}
+
+	// Returns the table slot holding 'key', or the empty slot where it would go.
+	size_t FindSlot(std::uint64_t key) const;
+	void Grow();
+	// Removes the pair stored at table slot 'slot' and keeps every probe chain intact.
+	void EraseSlot(size_t slot);
+	void AddPartner(std::uint32_t id, std::uint32_t partner);
+	void RemovePartner(std::uint32_t id, std::uint32_t partner);
+
+	// Open-addressing table (linear probing, power-of-two size): key -> index into m_pairs
+	std::vector<std::uint64_t> m_slotKeys;
+	std::vector<std::uint32_t> m_slotPairs;
+
+	// Dense pair storage, parallel arrays
+	std::vector<Pair> m_pairs;
+	std::vector<std::uint64_t> m_pairKeys;
+
+	// Partners of each collider id
+	std::vector<std::vector<std::uint32_t>> m_partners;
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -70,6 +71,12 @@ public:
 	template<typename T>
 	std::vector<std::shared_ptr<T> > GetComponentsInParent() const;
 
+	// Behaviours that implement at least one physics callback, cached for Physics2DWorld's
+	// event dispatch and rebuilt after components change
+	const std::vector<std::shared_ptr<MonoBehaviour>>& GetPhysicsListeners();
+	// Returns true if a behaviour here implements any of the given MonoBehaviour::PhysicsCallbackFlags
+	bool HasPhysicsListener(std::uint8_t callbacks);
+
 	// Returns the component index on this GameObject
 	size_t GetComponentIndex(const Component* component) const;
 
@@ -107,6 +114,8 @@ private:
 	void QueueLifecycle(MonoBehaviour* behaviour);
 	// Handles activation changes in hierarchy
 	void HandleActivationChange(bool wasActive);
+	// Rebuilds m_physicsListeners if components or their callbacks changed
+	void RefreshPhysicsListeners();
 
 	bool m_activeSelf = true; // Local active state
 	bool m_activeInHierarchy = true; // Active state in hierarchy
@@ -115,6 +124,10 @@ private:
 
 	std::shared_ptr<Transform> m_transform; // Transform component
 	std::vector<std::shared_ptr<Component> > m_components; // Owned components
+
+	std::vector<std::shared_ptr<MonoBehaviour>> m_physicsListeners; // Behaviours with physics callbacks
+	std::uint8_t m_physicsListenerMask = 0; // Union of the listeners' callbacks
+	bool m_physicsListenersDirty = true; // Rebuild before the next dispatch
 };
 
 #include "GameObject.inl"
\ No newline at end of file
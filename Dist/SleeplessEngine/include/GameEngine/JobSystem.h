@@ -0,0 +1,46 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed pool of worker threads that run fire-and-forget jobs in FIFO order.
+// Owned by SleeplessEngine; jobs must not touch SDL rendering or engine objects
+// that are only safe on the main thread.
+class JobSystem {
+public:
+	// High jobs are taken before any queued Normal job, so frame-critical work (the physics
+	// solver) does not wait behind background work such as asset decoding. A Normal job that is
+	// already running still occupies its worker until it finishes.
+	enum class Priority {
+		Normal,
+		High
+	};
+
+	// workerCount <= 0 picks (hardware threads - 1), with at least one worker.
+	explicit JobSystem(int workerCount = 0);
+	// Finishes jobs that are already running; jobs still queued are discarded.
+	~JobSystem();
+
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	void Submit(std::function<void()> job, Priority priority = Priority::Normal);
+
+	int GetWorkerCount() const { return static_cast<int>(m_workers.size()); }
+	// Index in [0, GetWorkerCount()) of the worker running the calling job, -1 off the pool.
+	static int GetCurrentWorkerIndex();
+
+private:
+	void WorkerLoop(int workerIndex);
+
+	std::vector<std::thread> m_workers;
+	std::deque<std::function<void()>> m_jobs;
+	std::deque<std::function<void()>> m_highJobs;
+	std::mutex m_mutex;
+	std::condition_variable m_wake;
+	bool m_stopping = false;
+};
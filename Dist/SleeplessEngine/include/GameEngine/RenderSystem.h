@@ -2,6 +2,8 @@
 
 #include <vector>
 
+#include "Types.hpp"
+
 class RenderQueue;
 class RenderableComponent;
 class SpriteRenderer;
@@ -19,8 +21,10 @@ public:
 	void Register(RenderableComponent* renderable);
 	void Unregister(RenderableComponent* renderable);
 
-	// Builds a render queue from all registered renderables
-	void BuildQueue(RenderQueue& outQueue) const;
+	// Builds a render queue from all registered renderables.
+	// Sprites entirely outside the viewSize world area (centered on the origin) are left out and
+	// report !IsInView(); a zero viewSize disables the test.
+	void BuildQueue(RenderQueue& outQueue, const Vector2i& viewSize = Vector2i::Zero()) const;
 
 	// Clears all registered renderables.
 	void Clear();
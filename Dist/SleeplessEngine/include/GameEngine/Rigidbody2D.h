@@ -16,6 +16,12 @@ public:
 		Dynamic = b2_dynamicBody
 	};
 
+	// How the Transform follows the body between fixed steps.
+	enum class Interpolation {
+		None,       // Transform snaps to the pose of the last fixed step
+		Interpolate // Transform is blended between the last two fixed steps before rendering
+	};
+
 	// Creates a rigidbody component with default settings
 	Rigidbody2D() = default;
 	// Releases rigidbody resources
@@ -81,17 +87,40 @@ public:
 	// Returns whether the body can use continuous collision detection
 	bool IsBullet() const { return m_isBullet; }
 
+	// Sets the interpolation mode. Interpolated bodies render up to one fixed step behind the
+	// simulation; move them with velocities/forces, not by offsetting their Transform.
+	void SetInterpolation(Interpolation interpolation);
+	// Returns the interpolation mode
+	Interpolation GetInterpolation() const { return m_interpolation; }
+
 
 
 	/// Syncs the Transform from the current Box2D body state.
 	void SyncTransformFromBody();
+	/// Syncs the Transform from a body pose Box2D already reported (e.g. a move event).
+	void SyncTransformFromBody(const b2Transform& pose);
 	/// Clones the rigidbody settings.
 	std::shared_ptr<Component> Clone() const override;
 
 private:
-	/// Creates the Box2D body for this rigidbody.
+	friend class GameObject;
+	friend class Physics2DWorld;
+
+	/// Disables the body while the GameObject is inactive in the hierarchy and enables it again after.
+	void RefreshSimulation();
+
+	/// Before a fixed step: remembers the body pose the step starts from.
+	void BeginInterpolationStep();
+	/// After a fixed step: remembers the pose the step produced.
+	void EndInterpolationStep();
+	/// Before rendering: blends the Transform between the last two step poses.
+	void ApplyInterpolation(float alpha);
+	/// After rendering: puts the Transform back on the body pose if it holds a blended one.
+	void RestoreSimulatedPose();
+
+	/// Takes a Box2D body from the physics world's pool (or a new one) for this rigidbody.
 	void CreateBody();
-	/// Destroys the Box2D body for this rigidbody.
+	/// Returns the Box2D body and its shapes to the physics world's pool.
 	void DestroyBody();
 	/// Attaches any colliders on the same GameObject.
 	void AttachExistingColliders();
@@ -116,4 +145,13 @@ private:
 	bool m_allowSleep = true;
 	/// Whether the body uses continuous collision.
 	bool m_isBullet = false;
+
+	/// Interpolation mode.
+	Interpolation m_interpolation = Interpolation::None;
+	/// Body pose before the last fixed step.
+	b2Transform m_previousPose = b2Transform_identity;
+	/// Body pose after the last fixed step; anything else means the body was teleported since.
+	b2Transform m_stepPose = b2Transform_identity;
+	/// Whether the Transform currently holds a blended pose.
+	bool m_transformInterpolated = false;
 };
\ No newline at end of file
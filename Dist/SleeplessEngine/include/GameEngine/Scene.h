@@ -11,6 +11,8 @@
 #include "GameMode.h"
 
 class MonoBehaviour;
+class AssetManifest;
+struct AssetPreload;
 
 // Represents a level, contains GameObjects and manages their lifecycle
 class Scene {
@@ -22,6 +24,8 @@ public:
 
 	// Called when the Scene is created
 	virtual void OnCreate() {}
+	// Called before OnStart to list the assets the Scene uses; they are preloaded before the first frame
+	virtual void OnDeclareAssets(AssetManifest& manifest) { (void)manifest; }
 	// Called when the Scene starts
 	virtual void OnStart() {}
 	// Called once per frame
@@ -103,6 +107,10 @@ private:
 	// Queues a MonoBehaviour for lifecycle processing
 	void QueueLifecycle(MonoBehaviour* behaviour);
 
+	// Preloads the Scene + GameMode manifest and turns on lazy load reporting
+	void PreloadAssets();
+	// Releases the preloaded assets
+	void ReleasePreloadedAssets();
 	// Ensures the Scene always has a valid GameMode instance
 	// If one wasn't provided by the game layer, an EmptyGameMode is created
 	void EnsureGameMode();
@@ -147,6 +155,8 @@ private:
 
 	// Per-scene mode that owns shared gameplay rules for this level
 	std::unique_ptr<GameMode> m_gameMode;
+	// Assets preloaded from the manifest, kept resident until the Scene unloads
+	std::unique_ptr<AssetPreload> m_preloadedAssets;
 
 
 	// Registry of all active Scenes
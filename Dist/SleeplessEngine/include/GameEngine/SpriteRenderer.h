@@ -1,5 +1,6 @@
 #pragma once
 
+#include "AssetHandle.h"
 #include "RenderableComponent.h"
 #include "Texture.h"
 #include "Types.hpp"
@@ -11,6 +12,7 @@ class RenderQueue;
 class SpriteRenderer : public RenderableComponent {
 public:
 	friend class RenderQueue;
+	friend class RenderSystem;
 	// Sorting options for SpriteRenderers
 	enum class SortAxis {
 		None,
@@ -48,6 +50,10 @@ public:
 
 	Vector2i GetResolvedFrameSize() const;
 
+	// Whether the sprite overlapped the view when the last frame was queued (RenderSystem::BuildQueue).
+	// False while hidden or inactive; true until the first frame is built.
+	bool IsInView() const { return m_inView; }
+
 	std::shared_ptr<Component> Clone() const override;
 
 private:
@@ -55,7 +61,10 @@ private:
 	int GetMaxFrames(const Vector2i& frameSize) const;
 
 	Texture* m_texture = nullptr;
+	// Keeps an AssetManager texture from being evicted while this sprite draws it
+	AssetHandle<Texture> m_textureHandle;
 	Vector2i m_frameSize = Vector2i::Zero();
 	int m_frameIndex = 0;
 	int m_layerOrder = 0;
+	bool m_inView = true;
 };
\ No newline at end of file
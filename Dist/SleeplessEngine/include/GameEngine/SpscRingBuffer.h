@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+// Bounded single-producer / single-consumer lock-free ring buffer.
+// Exactly one thread may push and exactly one (other) thread may pop.
+// Neither side blocks, locks or allocates once the buffer has been constructed.
+template<typename T>
+class SpscRingBuffer {
+public:
+	// Capacity is rounded up to the next power of two.
+	explicit SpscRingBuffer(size_t capacity = 1024) {
+		size_t cap = 1;
+		while (cap < capacity) {
+			cap <<= 1;
+		}
+		m_capacity = cap;
+		m_mask = cap - 1;
+		m_items = std::make_unique<T[]>(cap);
+	}
+
+	SpscRingBuffer(const SpscRingBuffer&) = delete;
+	SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+	// Producer only. Returns false if the buffer is full (the item is not queued).
+	bool TryPush(const T& item) {
+		const size_t tail = m_tail.load(std::memory_order_relaxed);
+		if (tail - m_cachedHead >= m_capacity) {
+			m_cachedHead = m_head.load(std::memory_order_acquire);
+			if (tail - m_cachedHead >= m_capacity) {
+				return false;
+			}
+		}
+		m_items[tail & m_mask] = item;
+		m_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer only. Returns false if the buffer is empty.
+	bool TryPop(T& out) {
+		const size_t head = m_head.load(std::memory_order_relaxed);
+		if (head == m_cachedTail) {
+			m_cachedTail = m_tail.load(std::memory_order_acquire);
+			if (head == m_cachedTail) {
+				return false;
+			}
+		}
+		out = m_items[head & m_mask];
+		m_head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Approximate number of queued items (exact when called from either side while the other is idle).
+	size_t Size() const {
+		return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+	}
+
+	bool IsEmpty() const { return Size() == 0; }
+	size_t Capacity() const { return m_capacity; }
+
+private:
+	static constexpr size_t kCacheLine = 64;
+
+	std::unique_ptr<T[]> m_items;
+	size_t m_capacity = 0;
+	size_t m_mask = 0;
+
+	// Consumer-owned index plus the consumer's cached copy of the producer index.
+	alignas(kCacheLine) std::atomic<size_t> m_head{ 0 };
+	size_t m_cachedTail = 0;
+
+	// Producer-owned index plus the producer's cached copy of the consumer index.
+	alignas(kCacheLine) std::atomic<size_t> m_tail{ 0 };
+	size_t m_cachedHead = 0;
+};
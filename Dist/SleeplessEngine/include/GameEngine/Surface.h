@@ -10,6 +10,15 @@ public:
 	// Construct from BMP file
 	Surface(const std::string& filePath);
 
+	// Construct from a BMP already in memory (e.g. a view into an asset pack). The bytes are not retained.
+	Surface(const void* data, size_t size, const std::string& debugName);
+
+	// Decode a BMP and apply an optional color key (keyed pixels become transparent). Uncompressed
+	// 24/32-bit BMPs are converted straight to RGBA by the SIMD kernels in PixelConvertKernels;
+	// other variants go through SDL_LoadBMP + SetColorKey. Both give the same texture.
+	static Surface FromBmp(const void* data, size_t size, const Vector3i* colorKey, const std::string& debugName);
+	static Surface FromBmpFile(const std::string& filePath, const Vector3i* colorKey);
+
 	// No copying
 	Surface(const Surface&) = delete;
 	Surface& operator=(const Surface&) = delete;
@@ -26,10 +35,15 @@ public:
 	// Getters
 	void* GetNative() const { return m_surface; }
 	Vector2i GetSize() const;
+	// Pixel memory in bytes (pitch * height)
+	size_t GetByteSize() const;
 
 	// Check if valid
 	bool IsValid() const { return m_surface != nullptr; }
 
 private:
+	// Takes ownership of an SDL_Surface
+	explicit Surface(void* nativeSurface) : m_surface(nativeSurface) {}
+
 	void* m_surface = nullptr; // native* internally
 };
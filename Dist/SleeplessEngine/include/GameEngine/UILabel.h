@@ -1,5 +1,6 @@
 #pragma once
 
+#include "AssetHandle.h"
 #include "UIElement.h"
 #include "Types.hpp"
 
@@ -21,7 +22,7 @@ public:
 	UILabel();
 	~UILabel() override = default;
 
-	void SetFont(BitmapFont* font) { m_font = font; }
+	void SetFont(BitmapFont* font);
 	BitmapFont* GetFont() const { return m_font; }
 
 	void SetText(const std::string& text) { m_text = text; }
@@ -40,6 +41,7 @@ public:
 
 private:
 	BitmapFont* m_font = nullptr; // not owned
+	AssetHandle<BitmapFont> m_fontHandle; // keeps an AssetManager font from being evicted
 	std::string m_text;
 	Vector4i m_color{ 255, 255, 255, 255 };
 	Vector2f m_scale{ 1.0f, 1.0f };
@@ -0,0 +1,59 @@
+#include "AnimationLibrary.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <string>
+
+std::shared_ptr<const AnimatorController> AnimationLibrary::GetSheetController(SpriteSheet* sheet, float fps, bool loop,
+	std::string_view stateName, int firstFrame, int frameCount) {
+	if (!sheet || !sheet->IsValid()) {
+		return nullptr;
+	}
+	if (fps <= 0.0f) fps = 12.0f;
+	firstFrame = std::max(0, firstFrame);
+
+	AssetId id = AssetIds::FromKey(stateName);
+	id = AssetIds::Combine(id, reinterpret_cast<std::uintptr_t>(sheet));
+	id = AssetIds::Combine(id, (static_cast<std::uint64_t>(static_cast<std::uint32_t>(firstFrame)) << 32) | static_cast<std::uint32_t>(frameCount));
+	id = AssetIds::Combine(id, (static_cast<std::uint64_t>(loop) << 32) | std::bit_cast<std::uint32_t>(fps));
+
+	auto it = m_entries.find(id);
+	if (it != m_entries.end()) {
+		return std::shared_ptr<const AnimatorController>(it->second, &it->second->controller);
+	}
+
+	auto entry = std::make_shared<SheetAnimation>();
+	entry->sheet = sheet;
+
+	AnimationClip& clip = entry->clip;
+	clip.name = std::string(stateName);
+	clip.sheet = sheet;
+	clip.fps = fps;
+	clip.loop = loop;
+
+	const Vector2i texSize = sheet->texture->GetSize();
+	const int total = (texSize.x / sheet->frameSize.x) * (texSize.y / sheet->frameSize.y);
+	const int last = frameCount == kAllFrames ? total : std::min(total, firstFrame + frameCount);
+	for (int i = firstFrame; i < last; ++i) {
+		clip.frames.push_back(i);
+	}
+	if (clip.frames.empty()) {
+		clip.frames.push_back(0);
+	}
+
+	AnimState state;
+	state.id = 0;
+	state.name = clip.name;
+	state.clip = &clip;
+	entry->controller.states = { state };
+	entry->controller.entryState = 0;
+	entry->controller.Compile();
+
+	m_entries.emplace(id, entry);
+	return std::shared_ptr<const AnimatorController>(entry, &entry->controller);
+}
+
+void AnimationLibrary::ForgetSheet(const SpriteSheet* sheet) {
+	std::erase_if(m_entries, [sheet](const auto& kv) { return kv.second->sheet == sheet; });
+}
@@ -0,0 +1,253 @@
+#include "AnimationSystem.h"
+
+#include "Animator.h"
+#include "AnimationClip.h"
+#include "JobSystem.h"
+#include "SpriteRenderer.h"
+
+#include <algorithm>
+#include <latch>
+#include <utility>
+
+namespace {
+	// Smallest range worth handing to a worker; below this the submit cost dominates.
+	constexpr size_t kMinChunk = 256;
+
+	// Calls fn(begin, end) over [0, count), split into chunks on the job workers when the batch is
+	// large enough. The calling thread runs the first chunk itself and waits for the rest.
+	template <typename Fn>
+	void RunChunked(size_t count, JobSystem* jobs, int minParallelCount, const Fn& fn) {
+		const int workers = jobs ? jobs->GetWorkerCount() : 0;
+		if (workers <= 0 || minParallelCount <= 0 || count < static_cast<size_t>(minParallelCount) || count < 2 * kMinChunk) {
+			fn(size_t{ 0 }, count);
+			return;
+		}
+
+		const size_t chunks = std::min(static_cast<size_t>(workers) + 1, count / kMinChunk);
+		const size_t chunkSize = (count + chunks - 1) / chunks;
+		std::latch done(static_cast<std::ptrdiff_t>(chunks - 1));
+		for (size_t c = 1; c < chunks; ++c) {
+			const size_t begin = std::min(count, c * chunkSize);
+			const size_t end = std::min(count, begin + chunkSize);
+			jobs->Submit([&fn, &done, begin, end] {
+				fn(begin, end);
+				done.count_down();
+			});
+		}
+		fn(size_t{ 0 }, std::min(count, chunkSize));
+		done.wait();
+	}
+}
+
+AnimationSystem& AnimationSystem::Get() {
+	static AnimationSystem instance;
+	return instance;
+}
+
+void AnimationSystem::Register(Animator* animator) {
+	if (!animator || animator->m_slot >= 0) {
+		return;
+	}
+
+	// New slots start disabled, at the back.
+	animator->m_slot = static_cast<int>(m_animators.size());
+	m_animators.push_back(animator);
+	m_sprites.push_back(nullptr);
+	m_clips.push_back(nullptr);
+	m_times.push_back(0.0f);
+	m_speeds.push_back(1.0f);
+	m_localFrames.push_back(-1);
+	m_appliedFrames.push_back(-1);
+	m_flags.push_back(0);
+	m_cullingModes.push_back(AnimatorCullingMode::AlwaysAnimate);
+}
+
+void AnimationSystem::Unregister(Animator* animator) {
+	if (!animator || animator->m_slot < 0) {
+		return;
+	}
+
+	SetActive(animator, false);
+	SwapSlots(static_cast<size_t>(animator->m_slot), m_animators.size() - 1);
+	m_animators.pop_back();
+	m_sprites.pop_back();
+	m_clips.pop_back();
+	m_times.pop_back();
+	m_speeds.pop_back();
+	m_localFrames.pop_back();
+	m_appliedFrames.pop_back();
+	m_flags.pop_back();
+	m_cullingModes.pop_back();
+	animator->m_slot = -1;
+}
+
+void AnimationSystem::SetActive(Animator* animator, bool active) {
+	if (!animator || animator->m_slot < 0) {
+		return;
+	}
+
+	const size_t slot = static_cast<size_t>(animator->m_slot);
+	const bool isActive = slot < m_activeCount;
+	if (active == isActive) {
+		return;
+	}
+
+	// Move the slot across the active/inactive boundary.
+	if (active) {
+		SwapSlots(slot, m_activeCount);
+		++m_activeCount;
+	}
+	else {
+		--m_activeCount;
+		SwapSlots(slot, m_activeCount);
+	}
+}
+
+void AnimationSystem::SwapSlots(size_t a, size_t b) {
+	if (a == b) {
+		return;
+	}
+
+	std::swap(m_animators[a], m_animators[b]);
+	std::swap(m_sprites[a], m_sprites[b]);
+	std::swap(m_clips[a], m_clips[b]);
+	std::swap(m_times[a], m_times[b]);
+	std::swap(m_speeds[a], m_speeds[b]);
+	std::swap(m_localFrames[a], m_localFrames[b]);
+	std::swap(m_appliedFrames[a], m_appliedFrames[b]);
+	std::swap(m_flags[a], m_flags[b]);
+	std::swap(m_cullingModes[a], m_cullingModes[b]);
+	m_animators[a]->m_slot = static_cast<int>(a);
+	m_animators[b]->m_slot = static_cast<int>(b);
+}
+
+void AnimationSystem::SetClip(int slot, const AnimationClip* clip, bool restart) {
+	const size_t i = static_cast<size_t>(slot);
+	if (m_clips[i] != clip) {
+		m_clips[i] = clip;
+		m_flags[i] |= kClipChanged;
+		m_appliedFrames[i] = -1;
+	}
+	if (restart) {
+		m_times[i] = 0.0f;
+		m_appliedFrames[i] = -1;
+	}
+}
+
+void AnimationSystem::SetSprite(int slot, SpriteRenderer* sprite) {
+	const size_t i = static_cast<size_t>(slot);
+	if (m_sprites[i] != sprite) {
+		m_sprites[i] = sprite;
+		m_flags[i] |= kClipChanged;
+		m_appliedFrames[i] = -1;
+	}
+}
+
+void AnimationSystem::SetFlag(int slot, SlotFlags flag, bool on) {
+	std::uint8_t& flags = m_flags[static_cast<size_t>(slot)];
+	flags = on ? static_cast<std::uint8_t>(flags | flag) : static_cast<std::uint8_t>(flags & ~flag);
+}
+
+void AnimationSystem::Update(float deltaTime, JobSystem* jobs, int minParallelCount) {
+	const size_t count = m_activeCount;
+	if (count == 0) {
+		return;
+	}
+
+	// 1. Visibility (last frame's render result) + advance time
+	RunChunked(count, jobs, minParallelCount, [this, deltaTime](size_t begin, size_t end) {
+		float* times = m_times.data();
+		const float* speeds = m_speeds.data();
+		std::uint8_t* flags = m_flags.data();
+		const AnimatorCullingMode* modes = m_cullingModes.data();
+		SpriteRenderer* const* sprites = m_sprites.data();
+		for (size_t i = begin; i < end; ++i) {
+			// Without a sprite there is no visibility to go by: always animate.
+			const bool culled = modes[i] != AnimatorCullingMode::AlwaysAnimate && sprites[i] && !sprites[i]->IsInView();
+			if (culled) {
+				flags[i] |= kCulled;
+			}
+			else if (flags[i] & kCulled) {
+				flags[i] = static_cast<std::uint8_t>((flags[i] & ~kCulled) | (modes[i] == AnimatorCullingMode::CullUpdate ? kCatchUp : 0));
+			}
+
+			if (!(flags[i] & kTimeOverridden) && !(culled && modes[i] == AnimatorCullingMode::CullCompletely)) {
+				times[i] += deltaTime * speeds[i];
+			}
+			flags[i] &= static_cast<std::uint8_t>(~kTimeOverridden);
+		}
+	});
+
+	// 2. State machines. Taking a transition only rewrites this slot's clip/time, so the slot layout
+	// stays put for the rest of the frame. Culled slots only step for a pending trigger.
+	for (size_t i = 0; i < count; ++i) {
+		const std::uint8_t flags = m_flags[i];
+		if (!(flags & kHasLogic)) continue;
+		if ((flags & kCulled) && !(flags & kTriggerPending)) continue;
+
+		m_animators[i]->StepStateMachine((flags & kCatchUp) != 0);
+		m_flags[i] &= static_cast<std::uint8_t>(~kCatchUp);
+	}
+
+	// 3. Sample frames
+	RunChunked(count, jobs, minParallelCount, [this](size_t begin, size_t end) {
+		const AnimationClip* const* clips = m_clips.data();
+		const float* times = m_times.data();
+		const std::uint8_t* flags = m_flags.data();
+		int* localFrames = m_localFrames.data();
+		for (size_t i = begin; i < end; ++i) {
+			if (flags[i] & kCulled) {
+				localFrames[i] = -1;
+				continue;
+			}
+			localFrames[i] = clips[i] ? clips[i]->SampleLocalFrame(times[i]) : -1;
+		}
+	});
+
+	// 4. Write results
+	PushFrames();
+}
+
+void AnimationSystem::PushFrames() {
+	for (size_t i = 0; i < m_activeCount; ++i) {
+		const int localFrame = m_localFrames[i];
+		if (localFrame < 0) continue;
+		if (localFrame == m_appliedFrames[i] && !(m_flags[i] & kClipChanged)) continue;
+
+		const AnimationClip* clip = m_clips[i];
+		if (!clip->IsValid()) continue;
+
+		SpriteRenderer* sprite = m_sprites[i];
+		if (!sprite) {
+			// Added after Awake, or not at all yet.
+			sprite = m_animators[i]->FindSprite();
+			if (!sprite) continue;
+			m_sprites[i] = sprite;
+		}
+
+		// Ensure the SpriteRenderer is using the clip's spritesheet
+		if (m_flags[i] & kClipChanged) {
+			if (sprite->GetTexture() != clip->sheet->texture) {
+				sprite->SetTexture(clip->sheet->texture);
+			}
+			if (sprite->GetFrameSize() != clip->sheet->frameSize) {
+				sprite->SetFrameSize(clip->sheet->frameSize);
+			}
+			m_flags[i] &= static_cast<std::uint8_t>(~kClipChanged);
+		}
+
+		sprite->SetFrameIndex(clip->frames[static_cast<size_t>(localFrame)]);
+
+		// Fire frame events when entering a new local frame.
+		if (localFrame != m_appliedFrames[i]) {
+			for (const auto& ev : clip->events) {
+				if (ev.localFrameIndex == localFrame) {
+					// Hook into your existing message system if desired.
+					// Example:
+					// ReceiveMessage(ev.name);
+				}
+			}
+		}
+		m_appliedFrames[i] = localFrame;
+	}
+}
@@ -1,4 +1,7 @@
 #include "Animator.h"
+#include "AnimationSystem.h"
+#include "AssetManager.h"
+#include "SleeplessEngine.h"
 #include "SpriteRenderer.h"
 #include "GameObject.h"
 
@@ -7,70 +10,159 @@
 Animator::Animator()
 	: MonoBehaviour() {
 	SetComponentName("Animator");
+	AnimationSystem::Get().Register(this);
+}
+
+Animator::~Animator() {
+	AnimationSystem::Get().Unregister(this);
 }
 
 void Animator::Awake() {
 	// Cache the SpriteRenderer if present.
+	AnimationSystem::Get().SetSprite(m_slot, FindSprite());
+}
+
+void Animator::OnEnable() {
+	AnimationSystem::Get().SetActive(this, true);
+}
+
+void Animator::OnDisable() {
+	AnimationSystem::Get().SetActive(this, false);
+}
+
+SpriteRenderer* Animator::FindSprite() {
 	auto sprite = GetComponent<SpriteRenderer>();
-	m_sprite = sprite ? sprite.get() : nullptr;
+	return sprite ? sprite.get() : nullptr;
 }
 
 void Animator::SetController(AnimatorController* controller) {
+	const AnimatorController* previous = m_controller;
+	if (controller && !controller->IsCompiled()) {
+		controller->Compile();
+	}
+	m_sharedController.reset();
 	m_controller = controller;
-	EnsureDefaultsFromController();
+	EnterController(previous);
+}
 
-	if (m_controller && m_controller->entryState != -1) {
-		SwitchState(m_controller->entryState, true);
+void Animator::SetController(std::shared_ptr<const AnimatorController> controller) {
+	const AnimatorController* previous = m_controller;
+	if (controller && !controller->IsCompiled()) {
+		// Shared controllers are immutable; compile a private copy instead (AnimationLibrary's are precompiled).
+		auto compiled = std::make_shared<AnimatorController>(*controller);
+		compiled->Compile();
+		controller = std::move(compiled);
+	}
+	m_controller = controller.get();
+	m_sharedController = std::move(controller);
+	EnterController(previous);
+}
+
+void Animator::RetainClipSheets() {
+	m_sheetHandles.clear();
+	AssetManager* assets = SleeplessEngine::GetInstance().GetAssetManager();
+	if (!m_controller || !assets) return;
+
+	for (const AnimState& state : m_controller->states) {
+		SpriteSheet* sheet = state.clip ? state.clip->sheet : nullptr;
+		if (!sheet) continue;
+		const bool retained = std::any_of(m_sheetHandles.begin(), m_sheetHandles.end(),
+			[sheet](const AssetHandle<SpriteSheet>& handle) { return handle.Get() == sheet; });
+		if (!retained) {
+			m_sheetHandles.push_back(assets->Retain(sheet));
+		}
+	}
+}
+
+void Animator::EnterController(const AnimatorController* previous) {
+	RetainClipSheets();
+	RebindParameters(previous);
+
+	// Controllers without transitions or triggers (plain looping clips) skip the state machine pass.
+	bool hasLogic = m_controller && m_controller->HasTransitions();
+	if (m_controller && !hasLogic) {
+		for (const auto& def : m_controller->parameters) {
+			if (def.type == AnimParamType::Trigger) {
+				hasLogic = true;
+				break;
+			}
+		}
+	}
+	AnimationSystem::Get().SetFlag(m_slot, AnimationSystem::kHasLogic, hasLogic);
+
+	m_stateIndex = -1;
+	if (m_controller) {
+		SwitchState(m_controller->GetEntryStateIndex(), true);
+	}
+	else {
+		AnimationSystem::Get().SetClip(m_slot, nullptr, true);
 	}
 }
 
 // ---------------- Params ----------------
 
-void Animator::SetFloat(const std::string& name, float v) { m_floats[name] = v; }
-void Animator::SetInt(const std::string& name, int v) { m_ints[name] = v; }
-void Animator::SetBool(const std::string& name, bool v) { m_bools[name] = v; }
-void Animator::SetTrigger(const std::string& name) { m_triggers[name] = true; }
+AnimParamId Animator::GetParameterId(std::string_view name) const {
+	return m_controller ? m_controller->FindParameterId(name) : kInvalidAnimParam;
+}
+
+void Animator::SetFloat(AnimParamId id, float v) {
+	if (id >= 0 && id < static_cast<int>(m_params.size())) m_params[id].f = v;
+}
 
-float Animator::GetFloat(const std::string& name) const {
-	auto it = m_floats.find(name);
-	return it != m_floats.end() ? it->second : 0.0f;
+void Animator::SetInt(AnimParamId id, int v) {
+	if (id >= 0 && id < static_cast<int>(m_params.size())) m_params[id].i = v;
 }
 
-int Animator::GetInt(const std::string& name) const {
-	auto it = m_ints.find(name);
-	return it != m_ints.end() ? it->second : 0;
+void Animator::SetBool(AnimParamId id, bool v) {
+	if (id >= 0 && id < static_cast<int>(m_params.size())) m_params[id].b = v;
 }
 
-bool Animator::GetBool(const std::string& name) const {
-	auto it = m_bools.find(name);
-	return it != m_bools.end() ? it->second : false;
+void Animator::SetTrigger(AnimParamId id) {
+	if (id >= 0 && id < static_cast<int>(m_params.size())) {
+		m_params[id].b = true;
+		AnimationSystem::Get().SetFlag(m_slot, AnimationSystem::kTriggerPending, true);
+	}
 }
 
-bool Animator::GetTrigger(const std::string& name) const {
-	auto it = m_triggers.find(name);
-	return it != m_triggers.end() ? it->second : false;
+float Animator::GetFloat(AnimParamId id) const {
+	return (id >= 0 && id < static_cast<int>(m_params.size())) ? m_params[id].f : 0.0f;
 }
 
-// ensure all params from controller exist in our maps
-void Animator::EnsureDefaultsFromController() {
-	if (!m_controller) return;
+int Animator::GetInt(AnimParamId id) const {
+	return (id >= 0 && id < static_cast<int>(m_params.size())) ? m_params[id].i : 0;
+}
 
-	for (const auto& p : m_controller->parameters) {
-		switch (p.type) {
-			case AnimParamType::Float:
-				if (m_floats.find(p.name) == m_floats.end()) m_floats[p.name] = p.defaultFloat;
-				break;
-			case AnimParamType::Int:
-				if (m_ints.find(p.name) == m_ints.end()) m_ints[p.name] = p.defaultInt;
-				break;
-			case AnimParamType::Bool:
-				if (m_bools.find(p.name) == m_bools.end()) m_bools[p.name] = p.defaultBool;
-				break;
-			case AnimParamType::Trigger:
-				if (m_triggers.find(p.name) == m_triggers.end()) m_triggers[p.name] = false;
-				break;
+bool Animator::GetBool(AnimParamId id) const {
+	return (id >= 0 && id < static_cast<int>(m_params.size())) ? m_params[id].b : false;
+}
+
+bool Animator::GetTrigger(AnimParamId id) const {
+	return GetBool(id);
+}
+
+void Animator::RebindParameters(const AnimatorController* previous) {
+	if (!m_controller) {
+		m_params.clear();
+		return;
+	}
+	// Same controller again (e.g. a pooled object re-running Awake): keep current values.
+	if (previous == m_controller && m_params.size() == m_controller->parameters.size()) {
+		return;
+	}
+
+	std::vector<ParamValue> values(m_controller->parameters.size());
+	for (size_t i = 0; i < values.size(); ++i) {
+		const AnimParamDef& def = m_controller->parameters[i];
+		const AnimParamId old = previous ? previous->FindParameterId(def.name) : kInvalidAnimParam;
+		if (old != kInvalidAnimParam && old < static_cast<int>(m_params.size()) && previous->parameters[old].type == def.type) {
+			values[i] = m_params[old];
+			continue;
 		}
+		values[i].f = def.defaultFloat;
+		values[i].i = def.defaultInt;
+		values[i].b = def.type == AnimParamType::Bool ? def.defaultBool : false;
 	}
+	m_params = std::move(values);
 }
 
 // ---------------- State control ----------------
@@ -78,10 +170,7 @@ void Animator::EnsureDefaultsFromController() {
 // Force a state by name (ignores transition rules).
 void Animator::Play(const std::string& stateName, bool restart) {
 	if (!m_controller) return;
-	int id = m_controller->FindStateIdByName(stateName);
-	if (id != -1) {
-		SwitchState(id, restart);
-	}
+	SwitchState(m_controller->FindStateIndexByName(stateName), restart);
 }
 
 // Get current state's name
@@ -90,22 +179,39 @@ std::string Animator::GetCurrentStateName() const {
 	return s ? s->name : std::string();
 }
 
+float Animator::GetStateTime() const {
+	return AnimationSystem::Get().GetTime(m_slot);
+}
+
+void Animator::SetSpeed(float speed) {
+	AnimationSystem::Get().SetSpeed(m_slot, speed);
+}
+
+float Animator::GetSpeed() const {
+	return AnimationSystem::Get().GetSpeed(m_slot);
+}
+
+void Animator::SetCullingMode(AnimatorCullingMode mode) {
+	AnimationSystem::Get().SetCullingMode(m_slot, mode);
+}
+
+AnimatorCullingMode Animator::GetCullingMode() const {
+	return AnimationSystem::Get().GetCullingMode(m_slot);
+}
+
 // Get current state
 const AnimState* Animator::CurrentState() const {
-	if (!m_controller) return nullptr;
-	return m_controller->FindStateById(m_stateId);
+	if (!m_controller || m_stateIndex < 0) return nullptr;
+	return &m_controller->states[static_cast<size_t>(m_stateIndex)];
 }
 
-// Switch to a new state by ID
-void Animator::SwitchState(int newStateId, bool restartTime) {
-	if (newStateId == -1) return;
-	if (m_stateId == newStateId && !restartTime) return;
+// Switch to a new state by dense index
+void Animator::SwitchState(int newStateIndex, bool restartTime) {
+	if (newStateIndex < 0) return;
+	if (m_stateIndex == newStateIndex && !restartTime) return;
 
-	m_stateId = newStateId;
-	if (restartTime) {
-		m_stateTime = 0.0f;
-		m_prevLocalFrame = -1;
-	}
+	m_stateIndex = newStateIndex;
+	AnimationSystem::Get().SetClip(m_slot, m_controller->states[static_cast<size_t>(newStateIndex)].clip, restartTime);
 }
 
 
@@ -114,14 +220,15 @@ void Animator::SeekNormalized(float targetN, float speedNormalizedPerSec) {
 	const AnimState* s = CurrentState();
 	if (!s || !s->clip) return;
 
-	m_timeOverriddenThisFrame = true; 
+	AnimationSystem& system = AnimationSystem::Get();
+	system.SetFlag(m_slot, AnimationSystem::kTimeOverridden, true);
 
-	AnimationClip* clip = s->clip;
+	const AnimationClip* clip = s->clip;
 	const float len = clip->GetLengthSeconds();
 	if (len <= 0.0f) return;
 
 	targetN = std::clamp(targetN, 0.0f, 1.0f);
-	const float curN = clip->GetNormalizedTime(m_stateTime);
+	const float curN = clip->GetNormalizedTime(system.GetTime(m_slot));
 
 	const float dt = Time::DeltaTime();
 	const float step = std::max(0.0f, speedNormalizedPerSec) * dt;
@@ -130,121 +237,97 @@ void Animator::SeekNormalized(float targetN, float speedNormalizedPerSec) {
 	if (curN < targetN) newN = std::min(curN + step, targetN);
 	else if (curN > targetN) newN = std::max(curN - step, targetN);
 
-	m_stateTime = newN * len;
+	system.SetTime(m_slot, newN * len);
 }
 
 
-// ---------------- Update loop ----------------
+// ---------------- State machine ----------------
 
-void Animator::Update() {
-	if (!m_controller) {
-		ClearAllTriggers();
-		m_timeOverriddenThisFrame = false;
-		return;
-	}
-
-	if (!m_sprite) {
-		auto sprite = GetComponent<SpriteRenderer>();
-		m_sprite = sprite ? sprite.get() : nullptr;
+void Animator::StepStateMachine(bool catchUp) {
+	if (catchUp) {
+		// Walk the whole chain that would have played out while culled (bounded in case of cycles).
+		for (size_t steps = m_controller->states.size(); steps > 0 && EvaluateAndApplyTransitions(true); --steps) {}
 	}
-
-	// Advance time if not overridden this frame
-	if (!m_timeOverriddenThisFrame) {
-		m_stateTime += Time::DeltaTime();
+	else {
+		EvaluateAndApplyTransitions(false);
 	}
-
-	EvaluateAndApplyTransitions();
-	ApplyCurrentClipFrame();
 	ClearAllTriggers();
-
-	// Reset for next frame
-	m_timeOverriddenThisFrame = false;
 }
 
 
-void Animator::EvaluateAndApplyTransitions() {
-	if (!m_controller) return;
+bool Animator::EvaluateAndApplyTransitions(bool carryOvershoot) {
+	if (!m_controller) return false;
 
-	// First check Any State transitions
-	for (const auto& tr : m_controller->transitions) {
-		if (tr.fromState != -1) continue;
-		if (CanTakeTransition(tr)) {
-			ConsumeTriggersUsedBy(tr);
-			SwitchState(tr.toState, true);
-			return;
-		}
+	// Any State transitions first, then the current state's own range.
+	for (const auto& tr : m_controller->GetAnyStateTransitions()) {
+		if (TryTakeTransition(tr, carryOvershoot)) return true;
 	}
-
-	// Then transitions from current state
-	for (const auto& tr : m_controller->transitions) {
-		if (tr.fromState != m_stateId) continue;
-		if (CanTakeTransition(tr)) {
-			ConsumeTriggersUsedBy(tr);
-			SwitchState(tr.toState, true);
-			return;
-		}
+	for (const auto& tr : m_controller->GetTransitionsFrom(m_stateIndex)) {
+		if (TryTakeTransition(tr, carryOvershoot)) return true;
 	}
+	return false;
 }
 
-// Check if a transition can be taken
-bool Animator::CanTakeTransition(const AnimTransition& tr) const {
-	if (tr.toState == -1) return false;
-	if (tr.hasExitTime && !ExitTimeMet(tr)) return false;
+// Take a transition if its exit time and conditions pass
+bool Animator::TryTakeTransition(const AnimCompiledTransition& tr, bool carryOvershoot) {
+	if (tr.exitTimeNormalized >= 0.0f && !ExitTimeMet(tr.exitTimeNormalized)) return false;
 	if (!ConditionsMet(tr)) return false;
+
+	float overshoot = 0.0f;
+	const AnimState* s = CurrentState();
+	if (carryOvershoot && tr.exitTimeNormalized >= 0.0f && s && s->clip) {
+		const float len = s->clip->GetLengthSeconds();
+		const float t = GetStateTime();
+		// Looping clips compare the progress within the current loop; one-shots the raw time.
+		overshoot = s->clip->loop
+			? (s->clip->GetNormalizedTime(t) - tr.exitTimeNormalized) * len
+			: t - tr.exitTimeNormalized * len;
+	}
+
+	if (tr.usesTriggers) ConsumeTriggersUsedBy(tr);
+	SwitchState(tr.toIndex, true);
+	if (overshoot > 0.0f) {
+		AnimationSystem::Get().SetTime(m_slot, overshoot);
+	}
 	return true;
 }
 
 // Check if exit time condition is met
-bool Animator::ExitTimeMet(const AnimTransition& tr) const {
+bool Animator::ExitTimeMet(float exitTimeNormalized) const {
 	const AnimState* s = CurrentState();
 	if (!s || !s->clip) return true;
 
-	const float n = s->clip->GetNormalizedTime(m_stateTime);
-	return n >= tr.exitTimeNormalized;
+	const float n = s->clip->GetNormalizedTime(GetStateTime());
+	return n >= exitTimeNormalized;
 }
 
 // Check if all conditions are met
-bool Animator::ConditionsMet(const AnimTransition& tr) const {
-	for (const auto& c : tr.conditions) {
+bool Animator::ConditionsMet(const AnimCompiledTransition& tr) const {
+	for (const auto& c : m_controller->GetConditions(tr)) {
+		// Params were resolved at compile time; unknown ones read as 0/false like before.
+		const ParamValue v = (c.param >= 0 && c.param < static_cast<int>(m_params.size())) ? m_params[static_cast<size_t>(c.param)] : ParamValue{};
+		bool pass = true;
 		switch (c.op) {
-			case AnimCondOp::BoolTrue:
-				if (!GetBool(c.param)) return false;
-				break;
-			case AnimCondOp::BoolFalse:
-				if (GetBool(c.param)) return false;
-				break;
-			case AnimCondOp::FloatGreater:
-				if (!(GetFloat(c.param) > c.f)) return false;
-				break;
-			case AnimCondOp::FloatLess:
-				if (!(GetFloat(c.param) < c.f)) return false;
-				break;
-			case AnimCondOp::FloatGreaterEq:
-				if (!(GetFloat(c.param) >= c.f)) return false;
-				break;
-			case AnimCondOp::FloatLessEq:
-				if (!(GetFloat(c.param) <= c.f)) return false;
-				break;
-			case AnimCondOp::IntEquals:
-				if (!(GetInt(c.param) == c.i)) return false;
-				break;
-			case AnimCondOp::IntNotEquals:
-				if (!(GetInt(c.param) != c.i)) return false;
-				break;
-			case AnimCondOp::TriggerSet:
-				if (!GetTrigger(c.param)) return false;
-				break;
+			case AnimCondOp::BoolTrue:       pass = v.b; break;
+			case AnimCondOp::BoolFalse:      pass = !v.b; break;
+			case AnimCondOp::FloatGreater:   pass = v.f > c.f; break;
+			case AnimCondOp::FloatLess:      pass = v.f < c.f; break;
+			case AnimCondOp::FloatGreaterEq: pass = v.f >= c.f; break;
+			case AnimCondOp::FloatLessEq:    pass = v.f <= c.f; break;
+			case AnimCondOp::IntEquals:      pass = v.i == c.i; break;
+			case AnimCondOp::IntNotEquals:   pass = v.i != c.i; break;
+			case AnimCondOp::TriggerSet:     pass = v.b; break;
 		}
+		if (!pass) return false;
 	}
 	return true;
 }
 
 // Consume triggers used by a transition
-void Animator::ConsumeTriggersUsedBy(const AnimTransition& tr) {
-	for (const auto& c : tr.conditions) {
+void Animator::ConsumeTriggersUsedBy(const AnimCompiledTransition& tr) {
+	for (const auto& c : m_controller->GetConditions(tr)) {
 		if (c.op == AnimCondOp::TriggerSet) {
-			auto it = m_triggers.find(c.param);
-			if (it != m_triggers.end()) it->second = false;
+			SetBool(c.param, false);
 		}
 	}
 }
@@ -252,51 +335,12 @@ void Animator::ConsumeTriggersUsedBy(const AnimTransition& tr) {
 
 // Clear all triggers
 void Animator::ClearAllTriggers() {
-	for (auto& kv : m_triggers) {
-		kv.second = false;
-	}
-}
-
-
-// Apply the current clip frame to the SpriteRenderer
-void Animator::ApplyCurrentClipFrame() {
-	if (!m_sprite) return;
-
-	const AnimState* s = CurrentState();
-	if (!s || !s->clip) return;
-
-	AnimationClip* clip = s->clip;
-	if (!clip->IsValid()) return;
-
-	// Ensure SpriteRenderer is using the clip's spritesheet
-	Texture* desiredTexture = clip->sheet->texture;
-	Vector2i desiredFrameSize = clip->sheet->frameSize;
-
-	if (desiredTexture != m_lastTexture) {
-		m_sprite->SetTexture(desiredTexture);
-		m_lastTexture = desiredTexture;
-	}
-	if (desiredFrameSize != m_lastFrameSize) {
-		m_sprite->SetFrameSize(desiredFrameSize);
-		m_lastFrameSize = desiredFrameSize;
-	}
-
-	// Sample frame index and apply
-	const int frameIndex = clip->SampleFrameIndex(m_stateTime);
-	if (frameIndex >= 0) {
-		m_sprite->SetFrameIndex(frameIndex);
-	}
-
-	// fire frame events when entering a new local frame.
-	const int localFrame = clip->SampleLocalFrame(m_stateTime);
-	if (localFrame != -1 && localFrame != m_prevLocalFrame) {
-		m_prevLocalFrame = localFrame;
-		for (const auto& ev : clip->events) {
-			if (ev.localFrameIndex == localFrame) {
-				// Hook into your existing message system if desired.
-				// Example:
-				// ReceiveMessage(ev.name);
-			}
+	AnimationSystem::Get().SetFlag(m_slot, AnimationSystem::kTriggerPending, false);
+	if (!m_controller) return;
+	const auto& defs = m_controller->parameters;
+	for (size_t i = 0; i < m_params.size() && i < defs.size(); ++i) {
+		if (defs[i].type == AnimParamType::Trigger) {
+			m_params[i].b = false;
 		}
 	}
 }
@@ -304,11 +348,17 @@ void Animator::ApplyCurrentClipFrame() {
 std::shared_ptr<Component> Animator::Clone() const {
 	auto clone = std::make_shared<Animator>();
 	clone->m_controller = m_controller;
-	clone->m_floats = m_floats;
-	clone->m_ints = m_ints;
-	clone->m_bools = m_bools;
-	clone->m_triggers = m_triggers;
-	clone->m_stateId = m_stateId;
-	clone->m_stateTime = m_stateTime;
+	clone->m_sharedController = m_sharedController;
+	clone->m_sheetHandles = m_sheetHandles;
+	clone->m_params = m_params;
+	clone->m_stateIndex = m_stateIndex;
+
+	AnimationSystem& system = AnimationSystem::Get();
+	const AnimState* s = CurrentState();
+	system.SetClip(clone->m_slot, s ? s->clip : nullptr, true);
+	system.SetTime(clone->m_slot, GetStateTime());
+	system.SetSpeed(clone->m_slot, GetSpeed());
+	system.SetCullingMode(clone->m_slot, GetCullingMode());
+	system.SetFlag(clone->m_slot, AnimationSystem::kHasLogic, system.HasFlag(m_slot, AnimationSystem::kHasLogic));
 	return clone;
 }
@@ -0,0 +1,107 @@
+#include "AnimatorController.h"
+
+#include <algorithm>
+
+void AnimatorController::Compile() {
+	m_compiled = false;
+	m_transitions.clear();
+	m_transitionStart.clear();
+	m_conditions.clear();
+	m_indexByIdTable.clear();
+	m_indexByIdMap.clear();
+	m_indexByName.clear();
+	m_anyStateTransitionCount = 0;
+
+	// State id -> index. Ids are normally 0..n-1, so a table covers them.
+	int maxId = -1;
+	bool allNonNegative = true;
+	for (const auto& s : states) {
+		maxId = std::max(maxId, s.id);
+		allNonNegative = allNonNegative && s.id >= 0;
+	}
+	m_useIdTable = allNonNegative && static_cast<size_t>(maxId + 1) <= states.size() * 4 + 16;
+	if (m_useIdTable) {
+		m_indexByIdTable.assign(static_cast<size_t>(maxId + 1), -1);
+	}
+	for (size_t i = 0; i < states.size(); ++i) {
+		const int index = static_cast<int>(i);
+		if (m_useIdTable) {
+			if (m_indexByIdTable[static_cast<size_t>(states[i].id)] == -1) m_indexByIdTable[static_cast<size_t>(states[i].id)] = index;
+		}
+		else {
+			m_indexByIdMap.emplace(states[i].id, index);
+		}
+		m_indexByName.emplace(states[i].name, index);
+	}
+
+	// Appends one transition and its conditions.
+	auto emit = [this](const AnimTransition& tr, int toIndex) {
+		AnimCompiledTransition out;
+		out.toIndex = toIndex;
+		out.exitTimeNormalized = tr.hasExitTime ? tr.exitTimeNormalized : -1.0f;
+		out.conditionBegin = static_cast<uint32_t>(m_conditions.size());
+		for (const auto& c : tr.conditions) {
+			AnimCompiledCondition cc;
+			cc.op = c.op;
+			cc.param = FindParameterId(c.param);
+			cc.f = c.f;
+			cc.i = c.i;
+			m_conditions.push_back(cc);
+			out.usesTriggers = out.usesTriggers || c.op == AnimCondOp::TriggerSet;
+		}
+		out.conditionCount = static_cast<uint32_t>(tr.conditions.size());
+		m_transitions.push_back(out);
+	};
+
+	// Any-state transitions first, in declaration order.
+	for (const auto& tr : transitions) {
+		if (tr.fromState != -1) continue;
+		const int to = IndexOfId(tr.toState);
+		if (to >= 0) emit(tr, to);
+	}
+	m_anyStateTransitionCount = m_transitions.size();
+
+	// Then each state's own transitions, contiguous and in declaration order.
+	m_transitionStart.reserve(states.size() + 1);
+	for (size_t i = 0; i < states.size(); ++i) {
+		m_transitionStart.push_back(static_cast<uint32_t>(m_transitions.size()));
+		for (const auto& tr : transitions) {
+			if (tr.fromState == -1 || IndexOfId(tr.fromState) != static_cast<int>(i)) continue;
+			const int to = IndexOfId(tr.toState);
+			if (to >= 0) emit(tr, to);
+		}
+	}
+	m_transitionStart.push_back(static_cast<uint32_t>(m_transitions.size()));
+
+	m_entryIndex = IndexOfId(entryState);
+	m_compiled = true;
+}
+
+int AnimatorController::FindStateIndexById(int id) const {
+	if (m_compiled) {
+		return IndexOfId(id);
+	}
+	for (size_t i = 0; i < states.size(); ++i) {
+		if (states[i].id == id) return static_cast<int>(i);
+	}
+	return -1;
+}
+
+int AnimatorController::FindStateIndexByName(std::string_view n) const {
+	if (m_compiled) {
+		auto it = m_indexByName.find(n);
+		return it != m_indexByName.end() ? it->second : -1;
+	}
+	for (size_t i = 0; i < states.size(); ++i) {
+		if (states[i].name == n) return static_cast<int>(i);
+	}
+	return -1;
+}
+
+int AnimatorController::IndexOfId(int id) const {
+	if (m_useIdTable) {
+		return (id >= 0 && static_cast<size_t>(id) < m_indexByIdTable.size()) ? m_indexByIdTable[static_cast<size_t>(id)] : -1;
+	}
+	auto it = m_indexByIdMap.find(id);
+	return it != m_indexByIdMap.end() ? it->second : -1;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+// 64-bit asset identifier: FNV-1a of a path or key, optionally mixed with load parameters
+// (color key, frame size, ...). Everything here is constexpr and allocation-free, so IDs for
+// literal keys can be computed at compile time.
+using AssetId = std::uint64_t;
+
+namespace AssetIds {
+	constexpr std::uint64_t kFnvOffset = 14695981039346656037ull;
+	constexpr std::uint64_t kFnvPrime = 1099511628211ull;
+
+	constexpr std::uint64_t HashByte(std::uint64_t hash, std::uint8_t byte) {
+		return (hash ^ byte) * kFnvPrime;
+	}
+
+	// Relative asset path, normalized while hashing: case-insensitive, '\\' == '/',
+	// leading "./" and '/' ignored. "Sub\\Ship2.BMP" and "sub/ship2.bmp" give the same ID.
+	constexpr AssetId FromPath(std::string_view path) {
+		size_t i = 0;
+		while (i < path.size()) {
+			if (path[i] == '/' || path[i] == '\\') {
+				++i;
+			}
+			else if (path[i] == '.' && i + 1 < path.size() && (path[i + 1] == '/' || path[i + 1] == '\\')) {
+				i += 2;
+			}
+			else {
+				break;
+			}
+		}
+
+		std::uint64_t hash = kFnvOffset;
+		for (; i < path.size(); ++i) {
+			char c = path[i];
+			if (c == '\\') c = '/';
+			if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+			hash = HashByte(hash, static_cast<std::uint8_t>(c));
+		}
+		return hash;
+	}
+
+	// User-chosen key such as "sheet.enemy.drone" (exact, case-sensitive).
+	// Salted so a key never aliases a path with the same spelling.
+	constexpr AssetId FromKey(std::string_view key) {
+		std::uint64_t hash = HashByte(kFnvOffset, 0xFF);
+		for (char c : key) {
+			hash = HashByte(hash, static_cast<std::uint8_t>(c));
+		}
+		return hash;
+	}
+
+	// Mixes a load parameter into an ID.
+	constexpr AssetId Combine(AssetId id, std::uint64_t value) {
+		for (int i = 0; i < 8; ++i) {
+			id = HashByte(id, static_cast<std::uint8_t>(value >> (i * 8)));
+		}
+		return id;
+	}
+
+	// Tags in the top bits keep different kinds of parameters from producing the same ID.
+	constexpr std::uint64_t kColorKeyTag = 1ull << 62;
+	constexpr std::uint64_t kFrameSizeTag = 2ull << 62;
+	constexpr std::uint64_t kBakedTag = 3ull << 62;
+
+	// Texture loaded with a color key (AssetManager's cache ID for it).
+	constexpr AssetId WithColorKey(AssetId textureId, int r, int g, int b) {
+		return Combine(textureId, kColorKeyTag
+			| (static_cast<std::uint64_t>(r & 0xFFFF))
+			| (static_cast<std::uint64_t>(g & 0xFFFF) << 16)
+			| (static_cast<std::uint64_t>(b & 0xFFFF) << 32));
+	}
+
+	// Pack entry holding the baked, upload-ready pixels of a texture (see BakedTextureFormat.h).
+	constexpr AssetId BakedTexture(AssetId textureId) {
+		return Combine(textureId, kBakedTag);
+	}
+}
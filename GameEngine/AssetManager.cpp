@@ -1,16 +1,183 @@
 #include "AssetManager.h"
 #include "EngineException.hpp"
+#include "Audio.h"
+#include "JobSystem.h"
+#include "AssetPack.h"
+#include "BakedTextureFormat.h"
 #include <SDL3/SDL.h>
 #include <sstream>
 #include <filesystem>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <algorithm>
 
+namespace {
+	using LoadClock = std::chrono::steady_clock;
 
+	double MsBetween(LoadClock::time_point from, LoadClock::time_point to) {
+		return std::chrono::duration<double, std::milli>(to - from).count();
+	}
+
+	template<typename T>
+	std::shared_future<T*> MakeReadyFuture(T* value) {
+		std::promise<T*> promise;
+		promise.set_value(value);
+		return promise.get_future().share();
+	}
+
+	template<typename T>
+	bool IsFutureReady(const std::shared_future<T>& future) {
+		return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+	}
+
+	AssetId TextureId(std::string_view relativePath, const Vector3i* colorKey) {
+		const AssetId id = AssetIds::FromPath(relativePath);
+		return colorKey ? AssetIds::WithColorKey(id, colorKey->x, colorKey->y, colorKey->z) : id;
+	}
+
+	// Sheets loaded without an explicit key: one per texture (+ color key) and frame size.
+	AssetId DefaultSpriteSheetId(std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i* colorKey) {
+		return AssetIds::Combine(TextureId(textureRelativePath, colorKey), AssetIds::kFrameSizeTag
+			| (static_cast<std::uint64_t>(frameSize.x & 0xFFFFFF))
+			| (static_cast<std::uint64_t>(frameSize.y & 0xFFFFFF) << 24));
+	}
 
-AssetManager::AssetManager(Renderer& renderer)
-	: m_renderer(renderer) {
+	// Upload-ready pixels baked by AssetPacker, if the mounted pack has them for this texture.
+	const BakedTextureFormat::Header* FindBakedTexture(const AssetPack* pack, AssetId textureId) {
+		return pack ? BakedTextureFormat::Parse(pack->Find(AssetIds::BakedTexture(textureId))) : nullptr;
+	}
+
+	std::unique_ptr<Texture> UploadBakedTexture(Renderer& renderer, const BakedTextureFormat::Header* baked) {
+		return std::make_unique<Texture>(renderer, BakedTextureFormat::Pixels(baked),
+			Vector2i(static_cast<int>(baked->width), static_cast<int>(baked->height)),
+			static_cast<int>(baked->pitch), (baked->flags & BakedTextureFormat::kPremultipliedAlpha) != 0);
+	}
+
+	size_t BakedByteSize(const BakedTextureFormat::Header* baked) {
+		return static_cast<size_t>(baked->pitch) * baked->height;
+	}
+
+	// Decodes a BMP from the pack if it has the entry, otherwise from the loose file, and applies the
+	// color key if given. Thread-safe; throws on failure.
+	std::unique_ptr<Surface> DecodeSurface(const AssetPack* pack, const std::string& relativePath, const std::string& fullPath, const Vector3i* colorKey) {
+		if (pack) {
+			const auto packed = pack->Find(relativePath);
+			if (!packed.empty()) {
+				return std::make_unique<Surface>(Surface::FromBmp(packed.data(), packed.size(), colorKey, relativePath));
+			}
+		}
+		return std::make_unique<Surface>(Surface::FromBmpFile(fullPath, colorKey));
+	}
+
+	// Reads a WAV (packed or loose) and converts it to the mixer format. Thread-safe; throws on failure.
+	std::unique_ptr<AudioClip> DecodeWav(const AssetPack* pack, const std::string& fullPath, const std::string& relativePath) {
+		SDL_AudioSpec spec{};
+		SDL_zero(spec);
+		Uint8* audioBuf = nullptr;
+		Uint32 audioLen = 0;
+
+		const auto packed = pack ? pack->Find(relativePath) : std::span<const std::uint8_t>{};
+		SDL_IOStream* io = packed.empty()
+			? SDL_IOFromFile(fullPath.c_str(), "rb")
+			: SDL_IOFromConstMem(packed.data(), packed.size());
+
+		// Load WAV file
+		if (!io || !SDL_LoadWAV_IO(io, true, &spec, &audioBuf, &audioLen)) {
+			THROW_ENGINE_EXCEPTION("Failed to load WAV '" + relativePath + "': " + std::string(SDL_GetError()));
+		}
+		// Convert once to the mixer format so playback never resamples or converts formats.
+		const SDL_AudioSpec& mixSpec = Audio::GetMixSpec();
+		Uint8* mixBuf = nullptr;
+		int mixLen = 0;
+		if (!SDL_ConvertAudioSamples(&spec, audioBuf, (int)audioLen, &mixSpec, &mixBuf, &mixLen)) {
+			SDL_free(audioBuf);
+			THROW_ENGINE_EXCEPTION("Failed to convert WAV '" + relativePath + "': " + std::string(SDL_GetError()));
+		}
+		SDL_free(audioBuf);
+
+		// Create AudioClip
+		auto clip = std::make_unique<AudioClip>();
+		clip->name = relativePath;
+		clip->spec = mixSpec;
+		clip->pcm.assign(mixBuf, mixBuf + mixLen);
+		SDL_free(mixBuf);
+		return clip;
+	}
+}
+
+// Texture decoded on a worker, uploaded on the main thread.
+struct AssetManager::AsyncTextureLoad {
+	AssetId id = 0;
+	std::string relativePath;
+	std::string fullPath;
+	bool useColorKey = false;
+	Vector3i colorKey{};
+	bool hasScaleModeOverride = false;
+	TextureScaleMode scaleModeOverride = TextureScaleMode::Linear;
+
+	std::promise<Texture*> promise;
+	std::shared_future<Texture*> future;
+	LoadClock::time_point requestTime{};
+
+	// Baked loads skip the worker; the pack reference keeps their pixels mapped until upload.
+	std::shared_ptr<const AssetPack> pack;
+	const BakedTextureFormat::Header* baked = nullptr;
+
+	// Written by the worker before it hands the load to the inbox
+	std::unique_ptr<Surface> surface;
+	std::string error;
+	double decodeMs = 0.0;
+
+	size_t GetUploadBytes() const {
+		if (surface) return surface->GetByteSize();
+		return baked ? BakedByteSize(baked) : 0;
+	}
+};
+
+struct AssetManager::AsyncAudioLoad {
+	AssetId id = 0;
+	std::string relativePath;
+	std::string fullPath;
+
+	std::promise<AudioClip*> promise;
+	std::shared_future<AudioClip*> future;
+	LoadClock::time_point requestTime{};
+
+	// Written by the worker before it hands the load to the inbox
+	std::unique_ptr<AudioClip> clip;
+	std::string error;
+	double decodeMs = 0.0;
+};
+
+// Worker -> main thread handoff. Shared with in-flight jobs so it outlives the AssetManager if needed.
+struct AssetManager::LoadInbox {
+	std::mutex mutex;
+	std::condition_variable ready;
+	std::vector<std::shared_ptr<AsyncTextureLoad>> textures;
+	std::vector<std::shared_ptr<AsyncAudioLoad>> audioClips;
+};
+
+AssetManager::AssetManager(Renderer& renderer, JobSystem* jobs)
+	: m_renderer(renderer), m_jobs(jobs), m_inbox(std::make_shared<LoadInbox>()), m_residency(std::make_shared<AssetResidency>()) {
 	LOG_INFO("AssetManager initialized");
 }
 
+AssetManager::~AssetManager() {
+	// Release anyone polling an unfinished load; workers still holding a load just drop it.
+	for (auto& kv : m_pendingTextures) {
+		kv.second->promise.set_value(nullptr);
+	}
+	for (auto& kv : m_pendingAudioClips) {
+		kv.second->promise.set_value(nullptr);
+	}
+	for (auto& resolve : m_dependents) {
+		resolve(true);
+	}
+	// Handles that outlive us release into an empty table.
+	m_residency->Clear();
+}
+
 void AssetManager::SetBasePath(const std::string& basePath) {
 	m_basePath = basePath;
 	if (!m_basePath.empty() && m_basePath.back() != '/' && m_basePath.back() != '\\') {
@@ -19,73 +186,70 @@ void AssetManager::SetBasePath(const std::string& basePath) {
 	LOG_INFO("Base path set to: " + m_basePath);
 }
 
+bool AssetManager::MountPack(const std::string& packPath) {
+	auto pack = std::make_shared<AssetPack>();
+	if (!pack->Open(packPath)) {
+		LOG_INFO("No asset pack at " + packPath + "; loading loose files from " + m_basePath);
+		return false;
+	}
+	// In-flight async loads keep the previous pack mapped until they finish.
+	m_pack = std::move(pack);
+	return true;
+}
+
+void AssetManager::UnmountPack() {
+	m_pack.reset();
+}
+
 void AssetManager::SetDefaultTextureScaleMode(TextureScaleMode mode) {
 	m_defaultTextureScaleMode = mode;
 
 	// Apply to already-loaded textures
-	for (auto& kv : m_textures) {
-		if (kv.second) {
-			kv.second->SetScaleMode(mode);
-		}
-	}
+	m_textures.ForEach([mode](AssetId, Texture& texture) {
+		texture.SetScaleMode(mode);
+	});
 }
 
 
-Texture* AssetManager::LoadTexture(const std::string& relativePath) {
+Texture* AssetManager::LoadTexture(std::string_view relativePath) {
 	return LoadTextureInternal(relativePath, nullptr, nullptr);
 }
 
-Texture* AssetManager::LoadTexture(const std::string& relativePath, const Vector3i& colorKey) {
+Texture* AssetManager::LoadTexture(std::string_view relativePath, const Vector3i& colorKey) {
 	return LoadTextureInternal(relativePath, &colorKey, nullptr);
 }
 
-Texture* AssetManager::LoadTexture(const std::string& relativePath, TextureScaleMode scaleModeOverride) {
+Texture* AssetManager::LoadTexture(std::string_view relativePath, TextureScaleMode scaleModeOverride) {
 	return LoadTextureInternal(relativePath, nullptr, &scaleModeOverride);
 }
 
-Texture* AssetManager::LoadTexture(const std::string& relativePath, const Vector3i& colorKey, TextureScaleMode scaleModeOverride) {
+Texture* AssetManager::LoadTexture(std::string_view relativePath, const Vector3i& colorKey, TextureScaleMode scaleModeOverride) {
 	return LoadTextureInternal(relativePath, &colorKey, &scaleModeOverride);
 }
 
-// Build default sprite sheet key, Unique per texture + frame size.
-std::string AssetManager::BuildDefaultSpriteSheetKey(const std::string& textureRelativePath, const Vector2i& frameSize) const {
-	std::stringstream ss;
-	ss << textureRelativePath << "|" << frameSize.x << "x" << frameSize.y;
-	return ss.str();
-}
-
-static std::string BuildDefaultSpriteSheetKeyWithColorKey(const std::string& textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey) {
-	std::stringstream ss;
-	ss << textureRelativePath << "|" << frameSize.x << "x" << frameSize.y
-		<< "|CK:" << colorKey.x << "," << colorKey.y << "," << colorKey.z;
-	return ss.str();
-}
-
-static std::string BuildTextureCacheKey(const std::string& relativePath, const Vector3i* colorKey) {
-	if (!colorKey) return relativePath;
-	std::stringstream ss;
-	ss << relativePath << "|CK:" << colorKey->x << "," << colorKey->y << "," << colorKey->z;
-	return ss.str();
-}
-
-Texture* AssetManager::LoadTextureInternal(const std::string& relativePath, const Vector3i* colorKey, const TextureScaleMode* scaleModeOverride) {
-	// Build full path
-	std::string fullPath = m_basePath + relativePath;
-
-	const std::string cacheKey = BuildTextureCacheKey(relativePath, colorKey);
+Texture* AssetManager::LoadTextureInternal(std::string_view relativePath, const Vector3i* colorKey, const TextureScaleMode* scaleModeOverride) {
+	const AssetId id = TextureId(relativePath, colorKey);
 
 	// Check if already loaded
-	auto it = m_textures.find(cacheKey);
-	if (it != m_textures.end()) {
-		LOG_DEBUG("Texture already loaded: " + cacheKey);
+	if (Texture* cached = m_textures.Find(id)) {
 		// override: apply to cached texture.
-		if (scaleModeOverride && it->second) {
-			it->second->SetScaleMode(*scaleModeOverride);
+		if (scaleModeOverride) {
+			cached->SetScaleMode(*scaleModeOverride);
 		}
-		return it->second.get();
+		m_residency->Touch(cached, m_frame);
+		return cached;
 	}
 
-	if (colorKey != nullptr) {
+	// Build full path
+	const std::string path(relativePath);
+	const std::string fullPath = m_basePath + path;
+	ReportLazyLoad("Texture", path);
+
+	const BakedTextureFormat::Header* baked = FindBakedTexture(m_pack.get(), id);
+	if (baked) {
+		LOG_INFO("Loading baked texture: " + path);
+	}
+	else if (colorKey != nullptr) {
 		std::stringstream logMsg;
 		logMsg << "Loading texture with color key: " << fullPath
 			<< " (R=" << colorKey->x
@@ -98,31 +262,48 @@ Texture* AssetManager::LoadTextureInternal(const std::string& relativePath, cons
 	}
 
 	try {
-		// Create texture based on whether color key is provided
-		std::unique_ptr<Texture> texture;
+		const auto start = LoadClock::now();
 
-		if (colorKey != nullptr) {
-			texture = std::make_unique<Texture>(m_renderer, fullPath, true, *colorKey);
+		std::unique_ptr<Texture> texture;
+		size_t bytes = 0;
+		auto decoded = start;
+		if (baked) {
+			// Already converted and keyed offline: a single upload
+			texture = UploadBakedTexture(m_renderer, baked);
+			bytes = BakedByteSize(baked);
 		}
 		else {
-			texture = std::make_unique<Texture>(m_renderer, fullPath);
+			// Decode, apply the color key if provided, then upload
+			std::unique_ptr<Surface> surface = DecodeSurface(m_pack.get(), path, fullPath, colorKey);
+			decoded = LoadClock::now();
+
+			texture = std::make_unique<Texture>(m_renderer, *surface);
+			bytes = surface->GetByteSize();
 		}
+		const auto uploaded = LoadClock::now();
+
+		AssetLoadStats stats;
+		stats.id = id;
+		stats.key = path;
+		stats.type = "Texture";
+		stats.decodeMs = MsBetween(start, decoded);
+		stats.uploadMs = MsBetween(decoded, uploaded);
+		stats.totalMs = MsBetween(start, uploaded);
+		stats.bytes = bytes;
+		m_loadStats.push_back(stats);
 
 		// Apply filtering
 		texture->SetScaleMode(scaleModeOverride ? *scaleModeOverride : m_defaultTextureScaleMode);
 
-		auto result = m_textures.emplace(cacheKey, std::move(texture));
-
-		if (!result.second) {
-			THROW_ENGINE_EXCEPTION("Failed to cache texture: " + relativePath);
-		}
+		Texture* loadedTexture = m_textures.Insert(id, std::move(texture));
+		TrackResident(loadedTexture, AssetKind::Texture, id, loadedTexture->GetByteSize());
 
 		// Log successful loading
-		Texture* loadedTexture = result.first->second.get();
 		std::stringstream successMsg;
-		successMsg << "Texture loaded: " << relativePath
+		successMsg << "Texture loaded: " << path
 			<< " (" << loadedTexture->GetSize().x
-			<< "x" << loadedTexture->GetSize().y << ")";
+			<< "x" << loadedTexture->GetSize().y << ", "
+			<< stats.totalMs << " ms)";
 
 		if (colorKey != nullptr) {
 			successMsg << " [ColorKey: R=" << colorKey->x
@@ -142,206 +323,137 @@ Texture* AssetManager::LoadTextureInternal(const std::string& relativePath, cons
 
 // ---------------- Sprite sheets ----------------
 
-SpriteSheet* AssetManager::LoadSpriteSheet(const std::string& textureRelativePath, const Vector2i& frameSize) {
-	const std::string key = BuildDefaultSpriteSheetKey(textureRelativePath, frameSize);
-	return LoadSpriteSheet(key, textureRelativePath, frameSize);
+SpriteSheet* AssetManager::LoadSpriteSheet(std::string_view textureRelativePath, const Vector2i& frameSize) {
+	return LoadSpriteSheetInternal(DefaultSpriteSheetId(textureRelativePath, frameSize, nullptr), {}, textureRelativePath, frameSize, nullptr, nullptr);
 }
 
-SpriteSheet* AssetManager::LoadSpriteSheet(const std::string& textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey) {
-	const std::string key = BuildDefaultSpriteSheetKeyWithColorKey(textureRelativePath, frameSize, colorKey);
-	return LoadSpriteSheet(key, textureRelativePath, frameSize, colorKey);
+SpriteSheet* AssetManager::LoadSpriteSheet(std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey) {
+	return LoadSpriteSheetInternal(DefaultSpriteSheetId(textureRelativePath, frameSize, &colorKey), {}, textureRelativePath, frameSize, &colorKey, nullptr);
 }
 
-SpriteSheet* AssetManager::LoadSpriteSheet(const std::string& textureRelativePath, const Vector2i& frameSize, TextureScaleMode textureScaleModeOverride) {
-	const std::string key = BuildDefaultSpriteSheetKey(textureRelativePath, frameSize);
-	return LoadSpriteSheet(key, textureRelativePath, frameSize, textureScaleModeOverride);
+SpriteSheet* AssetManager::LoadSpriteSheet(std::string_view textureRelativePath, const Vector2i& frameSize, TextureScaleMode textureScaleModeOverride) {
+	return LoadSpriteSheetInternal(DefaultSpriteSheetId(textureRelativePath, frameSize, nullptr), {}, textureRelativePath, frameSize, nullptr, &textureScaleModeOverride);
 }
 
-SpriteSheet* AssetManager::LoadSpriteSheet(const std::string& textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride) {
-	const std::string key = BuildDefaultSpriteSheetKeyWithColorKey(textureRelativePath, frameSize, colorKey);
-	return LoadSpriteSheet(key, textureRelativePath, frameSize, colorKey, textureScaleModeOverride);
+SpriteSheet* AssetManager::LoadSpriteSheet(std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride) {
+	return LoadSpriteSheetInternal(DefaultSpriteSheetId(textureRelativePath, frameSize, &colorKey), {}, textureRelativePath, frameSize, &colorKey, &textureScaleModeOverride);
 }
 
-SpriteSheet* AssetManager::LoadSpriteSheet(const std::string& sheetKey, const std::string& textureRelativePath, const Vector2i& frameSize) {
-	// Return cached
-	auto it = m_spriteSheets.find(sheetKey);
-	if (it != m_spriteSheets.end()) {
-		return &it->second;
-	}
-
-	Texture* texture = LoadTexture(textureRelativePath);
-	if (!texture || !texture->IsValid()) {
-		LOG_ERROR("Failed to create SpriteSheet '" + sheetKey + "' because texture could not be loaded: " + textureRelativePath);
-		return nullptr;
-	}
-
-	SpriteSheet sheet;
-	sheet.name = sheetKey;
-	sheet.texture = texture;
-	sheet.frameSize = frameSize;
-
-	auto result = m_spriteSheets.emplace(sheetKey, sheet);
-	if (!result.second) {
-		return &result.first->second;
-	}
-	return &result.first->second;
+SpriteSheet* AssetManager::LoadSpriteSheet(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize) {
+	return LoadSpriteSheetInternal(AssetIds::FromKey(sheetKey), sheetKey, textureRelativePath, frameSize, nullptr, nullptr);
 }
 
-SpriteSheet* AssetManager::LoadSpriteSheet(const std::string& sheetKey, const std::string& textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey) {
-	// Return cached
-	auto it = m_spriteSheets.find(sheetKey);
-	if (it != m_spriteSheets.end()) {
-		return &it->second;
-	}
-
-	Texture* texture = LoadTexture(textureRelativePath, colorKey);
-	if (!texture || !texture->IsValid()) {
-		LOG_ERROR("Failed to create SpriteSheet '" + sheetKey + "' because texture could not be loaded: " + textureRelativePath);
-		return nullptr;
-	}
+SpriteSheet* AssetManager::LoadSpriteSheet(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey) {
+	return LoadSpriteSheetInternal(AssetIds::FromKey(sheetKey), sheetKey, textureRelativePath, frameSize, &colorKey, nullptr);
+}
 
-	SpriteSheet sheet;
-	sheet.name = sheetKey;
-	sheet.texture = texture;
-	sheet.frameSize = frameSize;
+SpriteSheet* AssetManager::LoadSpriteSheet(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize, TextureScaleMode textureScaleModeOverride) {
+	return LoadSpriteSheetInternal(AssetIds::FromKey(sheetKey), sheetKey, textureRelativePath, frameSize, nullptr, &textureScaleModeOverride);
+}
 
-	auto result = m_spriteSheets.emplace(sheetKey, sheet);
-	if (!result.second) {
-		return &result.first->second;
-	}
-	return &result.first->second;
+SpriteSheet* AssetManager::LoadSpriteSheet(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride) {
+	return LoadSpriteSheetInternal(AssetIds::FromKey(sheetKey), sheetKey, textureRelativePath, frameSize, &colorKey, &textureScaleModeOverride);
 }
 
-SpriteSheet* AssetManager::LoadSpriteSheet(const std::string& sheetKey, const std::string& textureRelativePath, const Vector2i& frameSize, TextureScaleMode textureScaleModeOverride) {
+SpriteSheet* AssetManager::LoadSpriteSheetInternal(AssetId sheetId, std::string_view sheetName, std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i* colorKey, const TextureScaleMode* scaleModeOverride) {
 	// Return cached
-	auto it = m_spriteSheets.find(sheetKey);
-	if (it != m_spriteSheets.end()) {
+	if (SpriteSheet* cached = m_spriteSheets.Find(sheetId)) {
 		// apply override to cached texture
-		if (it->second.texture) {
-			it->second.texture->SetScaleMode(textureScaleModeOverride);
+		if (scaleModeOverride && cached->texture) {
+			cached->texture->SetScaleMode(*scaleModeOverride);
 		}
-		return &it->second;
-	}
-
-	Texture* texture = LoadTexture(textureRelativePath, textureScaleModeOverride);
-	if (!texture || !texture->IsValid()) {
-		LOG_ERROR("Failed to create SpriteSheet '" + sheetKey + "' because texture could not be loaded: " + textureRelativePath);
-		return nullptr;
-	}
-
-	SpriteSheet sheet;
-	sheet.name = sheetKey;
-	sheet.texture = texture;
-	sheet.frameSize = frameSize;
-
-	auto result = m_spriteSheets.emplace(sheetKey, sheet);
-	if (!result.second) {
-		return &result.first->second;
+		m_residency->Touch(cached->texture, m_frame);
+		return cached;
 	}
-	return &result.first->second;
-}
 
-SpriteSheet* AssetManager::LoadSpriteSheet(const std::string& sheetKey, const std::string& textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride) {
-	// Return cached
-	auto it = m_spriteSheets.find(sheetKey);
-	if (it != m_spriteSheets.end()) {
-		if (it->second.texture) {
-			it->second.texture->SetScaleMode(textureScaleModeOverride);
-		}
-		return &it->second;
+	// Sheets without an explicit key are named after their texture and frame size.
+	std::string name(sheetName);
+	if (name.empty()) {
+		std::stringstream ss;
+		ss << textureRelativePath << "|" << frameSize.x << "x" << frameSize.y;
+		name = ss.str();
 	}
 
-	Texture* texture = LoadTexture(textureRelativePath, colorKey, textureScaleModeOverride);
+	Texture* texture = LoadTextureInternal(textureRelativePath, colorKey, scaleModeOverride);
 	if (!texture || !texture->IsValid()) {
-		LOG_ERROR("Failed to create SpriteSheet '" + sheetKey + "' because texture could not be loaded: " + textureRelativePath);
+		LOG_ERROR("Failed to create SpriteSheet '" + name + "' because texture could not be loaded: " + std::string(textureRelativePath));
 		return nullptr;
 	}
 
-	SpriteSheet sheet;
-	sheet.name = sheetKey;
-	sheet.texture = texture;
-	sheet.frameSize = frameSize;
+	auto sheet = std::make_unique<SpriteSheet>();
+	sheet->name = std::move(name);
+	sheet->texture = texture;
+	sheet->frameSize = frameSize;
+	return m_spriteSheets.Insert(sheetId, std::move(sheet));
+}
 
-	auto result = m_spriteSheets.emplace(sheetKey, sheet);
-	if (!result.second) {
-		return &result.first->second;
-	}
-	return &result.first->second;
+SpriteSheet* AssetManager::GetSpriteSheet(std::string_view sheetKey) {
+	return m_spriteSheets.Find(AssetIds::FromKey(sheetKey));
 }
 
-SpriteSheet* AssetManager::GetSpriteSheet(const std::string& sheetKey) {
-	auto it = m_spriteSheets.find(sheetKey);
-	return (it != m_spriteSheets.end()) ? &it->second : nullptr;
+SpriteSheet* AssetManager::GetSpriteSheet(AssetId sheetId) const {
+	return m_spriteSheets.Find(sheetId);
 }
 
-bool AssetManager::IsSpriteSheetLoaded(const std::string& sheetKey) const {
-	return m_spriteSheets.find(sheetKey) != m_spriteSheets.end();
+bool AssetManager::IsSpriteSheetLoaded(std::string_view sheetKey) const {
+	return m_spriteSheets.Contains(AssetIds::FromKey(sheetKey));
 }
 
-void AssetManager::UnloadSpriteSheet(const std::string& sheetKey) {
-	auto it = m_spriteSheets.find(sheetKey);
-	if (it != m_spriteSheets.end()) {
-		m_spriteSheets.erase(it);
-	} else {
-		LOG_WARN("SpriteSheet not found for unloading: " + sheetKey);
+void AssetManager::UnloadSpriteSheet(std::string_view sheetKey) {
+	std::unique_ptr<SpriteSheet> doomed = m_spriteSheets.Extract(AssetIds::FromKey(sheetKey));
+	if (doomed) {
+		m_animations.ForgetSheet(doomed.get());
+	}
+	else {
+		LOG_WARN("SpriteSheet not found for unloading: " + std::string(sheetKey));
 	}
 }
 
 void AssetManager::UnloadAllSpriteSheets() {
 	std::stringstream logMsg;
-	logMsg << "Unloading all sprite sheets (count: " << m_spriteSheets.size() << ")";
+	logMsg << "Unloading all sprite sheets (count: " << m_spriteSheets.Size() << ")";
 	LOG_INFO(logMsg.str());
-	m_spriteSheets.clear();
+	m_spriteSheets.Clear();
+	m_animations.Clear();
 }
 
-Texture* AssetManager::GetTexture(const std::string& relativePath) const {
-	auto it = m_textures.find(relativePath);
-	if (it != m_textures.end()) {
-		return it->second.get();
-	}
-	return nullptr;
+Texture* AssetManager::GetTexture(std::string_view relativePath) const {
+	return m_textures.Find(TextureId(relativePath, nullptr));
 }
 
-bool AssetManager::IsTextureLoaded(const std::string& relativePath) const {
-	return m_textures.find(relativePath) != m_textures.end();
+bool AssetManager::IsTextureLoaded(std::string_view relativePath) const {
+	return m_textures.Contains(TextureId(relativePath, nullptr));
 }
 
-void AssetManager::UnloadTexture(const std::string& relativePath) {
-	auto it = m_textures.find(relativePath);
-	if (it != m_textures.end()) {
-		Texture* doomed = it->second.get();
-		LOG_INFO("Unloading texture: " + relativePath);
-		m_textures.erase(it);
-
-		// Remove any sprite sheets that referenced this texture.
-		for (auto sheetIt = m_spriteSheets.begin(); sheetIt != m_spriteSheets.end(); ) {
-			if (sheetIt->second.texture == doomed) {
-				sheetIt = m_spriteSheets.erase(sheetIt);
-			} else {
-				++sheetIt;
-			}
-		}
-
-		// Remove any fonts that referenced this texture.
-		for (auto fontIt = m_fonts.begin(); fontIt != m_fonts.end(); ) {
-			if (fontIt->second && fontIt->second->GetTexture() == doomed) {
-				fontIt = m_fonts.erase(fontIt);
-			}
-			else {
-				++fontIt;
-			}
-		}
+void AssetManager::UnloadTexture(std::string_view relativePath) {
+	std::unique_ptr<Texture> doomed = m_textures.Extract(TextureId(relativePath, nullptr));
+	if (doomed) {
+		LOG_INFO("Unloading texture: " + std::string(relativePath));
+		m_residency->Remove(doomed.get());
+		DropTextureDependents(doomed.get());
 	}
 	else {
-		LOG_WARN("Texture not found for unloading: " + relativePath);
+		LOG_WARN("Texture not found for unloading: " + std::string(relativePath));
 	}
 }
 
+void AssetManager::DropTextureDependents(const Texture* texture) {
+	m_spriteSheets.EraseIf([this, texture](AssetId, SpriteSheet& sheet) {
+		if (sheet.texture != texture) return false;
+		m_animations.ForgetSheet(&sheet);
+		return true;
+	});
+	m_fonts.EraseIf([texture](AssetId, BitmapFont& font) {
+		return font.GetTexture() == texture;
+	});
+}
+
 void AssetManager::UnloadAllTextures() {
 	std::stringstream logMsg;
-	logMsg << "Unloading all textures (count: " << m_textures.size() << ")";
+	logMsg << "Unloading all textures (count: " << m_textures.Size() << ")";
 	LOG_INFO(logMsg.str());
-	m_textures.clear();
+	m_textures.Clear();
+	m_residency->Clear(AssetKind::Texture);
 
 	// All cached sprite sheets become invalid when textures are gone.
 	UnloadAllSpriteSheets();
@@ -351,156 +463,690 @@ void AssetManager::UnloadAllTextures() {
 
 // ---------------- Audio clips ----------------
 
-AudioClip* AssetManager::LoadAudioClip(const std::string& relativePath) {
+AudioClip* AssetManager::LoadAudioClip(std::string_view relativePath) {
+	const AssetId id = AssetIds::FromPath(relativePath);
+
 	// Check if already loaded
-	auto it = m_audioClips.find(relativePath);
-	if (it != m_audioClips.end()) {
-		return it->second.get();
-	}
-
-	const std::string fullPath = m_basePath + relativePath;
-	SDL_AudioSpec spec{};
-	SDL_zero(spec);
-	Uint8* audioBuf = nullptr;
-	Uint32 audioLen = 0;
-	// Load WAV file
-	if (!SDL_LoadWAV(fullPath.c_str(), &spec, &audioBuf, &audioLen)) {
-		THROW_ENGINE_EXCEPTION("Failed to load WAV '" + relativePath + "': " + std::string(SDL_GetError()));
-	}
-	// Create AudioClip
-	auto clip = std::make_unique<AudioClip>();
-	clip->name = relativePath;
-	clip->spec = spec;
-	clip->pcm.assign(audioBuf, audioBuf + audioLen);
-	SDL_free(audioBuf);
+	if (AudioClip* cached = m_audioClips.Find(id)) {
+		m_residency->Touch(cached, m_frame);
+		return cached;
+	}
+
+	const std::string path(relativePath);
+	const std::string fullPath = m_basePath + path;
+	ReportLazyLoad("AudioClip", path);
+	const auto start = LoadClock::now();
+	auto clip = DecodeWav(m_pack.get(), fullPath, path);
+
+	AssetLoadStats stats;
+	stats.id = id;
+	stats.key = path;
+	stats.type = "AudioClip";
+	stats.decodeMs = MsBetween(start, LoadClock::now());
+	stats.totalMs = stats.decodeMs;
+	stats.bytes = clip->pcm.size();
+	m_loadStats.push_back(stats);
 
 	// Cache and return
-	AudioClip* result = clip.get();
-	m_audioClips.emplace(relativePath, std::move(clip));
-	LOG_INFO("Loaded AudioClip: " + relativePath);
+	AudioClip* result = m_audioClips.Insert(id, std::move(clip));
+	TrackResident(result, AssetKind::AudioClip, id, result->pcm.size());
+	LOG_INFO("Loaded AudioClip: " + path);
 	return result;
 }
 
-AudioClip* AssetManager::GetAudioClip(const std::string& relativePath) const {
-	auto it = m_audioClips.find(relativePath);
-	if (it == m_audioClips.end()) return nullptr;
-	return it->second.get();
+AudioClip* AssetManager::GetAudioClip(std::string_view relativePath) const {
+	return m_audioClips.Find(AssetIds::FromPath(relativePath));
 }
 
-bool AssetManager::IsAudioClipLoaded(const std::string& relativePath) const {
-	return m_audioClips.find(relativePath) != m_audioClips.end();
+bool AssetManager::IsAudioClipLoaded(std::string_view relativePath) const {
+	return m_audioClips.Contains(AssetIds::FromPath(relativePath));
 }
 
-void AssetManager::UnloadAudioClip(const std::string& relativePath) {
-	auto it = m_audioClips.find(relativePath);
-	if (it != m_audioClips.end()) {
-		m_audioClips.erase(it);
-		LOG_INFO("Unloaded AudioClip: " + relativePath);
+void AssetManager::UnloadAudioClip(std::string_view relativePath) {
+	std::unique_ptr<AudioClip> clip = m_audioClips.Extract(AssetIds::FromPath(relativePath));
+	if (clip) {
+		// Voices still mixing this clip must let go before the PCM is freed.
+		Audio::ForgetClip(clip.get());
+		m_residency->Remove(clip.get());
+		LOG_INFO("Unloaded AudioClip: " + std::string(relativePath));
 	}
 }
 
 void AssetManager::UnloadAllAudioClips() {
 	std::stringstream logMsg;
-	logMsg << "Unloading all audio clips (count: " << m_audioClips.size() << ")";
+	logMsg << "Unloading all audio clips (count: " << m_audioClips.Size() << ")";
 	LOG_INFO(logMsg.str());
-	m_audioClips.clear();
+	m_audioClips.ForEach([](AssetId, AudioClip& clip) {
+		Audio::ForgetClip(&clip);
+	});
+	m_audioClips.Clear();
+	m_residency->Clear(AssetKind::AudioClip);
 }
 
 // ---------------- Bitmap fonts ----------------
 
-BitmapFont* AssetManager::LoadFont(const std::string& relativePath, const Vector2i& glyphSize, unsigned char firstChar)
+BitmapFont* AssetManager::LoadFont(std::string_view relativePath, const Vector2i& glyphSize, unsigned char firstChar)
 {
-	return LoadFont(relativePath, relativePath, glyphSize, firstChar);
+	return LoadFontInternal(relativePath, relativePath, glyphSize, firstChar, nullptr, nullptr);
 }
 
-BitmapFont* AssetManager::LoadFont(const std::string& fontKey, const std::string& relativePath, const Vector2i& glyphSize, unsigned char firstChar)
+BitmapFont* AssetManager::LoadFont(std::string_view fontKey, std::string_view relativePath, const Vector2i& glyphSize, unsigned char firstChar)
 {
-	// Return cached
-	auto it = m_fonts.find(fontKey);
-	if (it != m_fonts.end()) {
-		return it->second.get();
-	}
-
-	// Load texture
-	Texture* texture = LoadTexture(relativePath);
-	if (!texture || !texture->IsValid()) {
-		LOG_ERROR("Failed to create Font '" + fontKey + "' because texture could not be loaded: " + relativePath);
-		return nullptr;
-	}
-
-	// Create font, cache abd return
-	auto font = std::make_unique<BitmapFont>(texture, glyphSize, firstChar);
-	BitmapFont* out = font.get();
-	m_fonts.emplace(fontKey, std::move(font));
-	return out;
+	return LoadFontInternal(fontKey, relativePath, glyphSize, firstChar, nullptr, nullptr);
 }
 
-BitmapFont* AssetManager::LoadFont(const std::string& relativePath, const Vector2i& glyphSize, const Vector3i& colorKey, unsigned char firstChar)
+BitmapFont* AssetManager::LoadFont(std::string_view relativePath, const Vector2i& glyphSize, const Vector3i& colorKey, unsigned char firstChar)
 {
 	return LoadFont(relativePath, relativePath, glyphSize, colorKey, firstChar);
 }
 
-BitmapFont* AssetManager::LoadFont(const std::string& fontKey, const std::string& relativePath, const Vector2i& glyphSize, const Vector3i& colorKey, unsigned char firstChar)
+BitmapFont* AssetManager::LoadFont(std::string_view fontKey, std::string_view relativePath, const Vector2i& glyphSize, const Vector3i& colorKey, unsigned char firstChar)
 {
 	// Use default texture filtering for the scene
-	return LoadFont(fontKey, relativePath, glyphSize, firstChar, colorKey, m_defaultTextureScaleMode);
+	return LoadFontInternal(fontKey, relativePath, glyphSize, firstChar, &colorKey, &m_defaultTextureScaleMode);
 }
 
 
-BitmapFont* AssetManager::LoadFont(const std::string& relativePath, const Vector2i& glyphSize, unsigned char firstChar, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride)
+BitmapFont* AssetManager::LoadFont(std::string_view relativePath, const Vector2i& glyphSize, unsigned char firstChar, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride)
 {
-	return LoadFont(relativePath, relativePath, glyphSize, firstChar, colorKey, textureScaleModeOverride);
+	return LoadFontInternal(relativePath, relativePath, glyphSize, firstChar, &colorKey, &textureScaleModeOverride);
 }
 
-BitmapFont* AssetManager::LoadFont(const std::string& fontKey, const std::string& relativePath, const Vector2i& glyphSize, unsigned char firstChar, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride)
+BitmapFont* AssetManager::LoadFont(std::string_view fontKey, std::string_view relativePath, const Vector2i& glyphSize, unsigned char firstChar, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride)
 {
-	auto it = m_fonts.find(fontKey);
-	if (it != m_fonts.end()) {
-		return it->second.get();
+	return LoadFontInternal(fontKey, relativePath, glyphSize, firstChar, &colorKey, &textureScaleModeOverride);
+}
+
+BitmapFont* AssetManager::LoadFontInternal(std::string_view fontKey, std::string_view relativePath, const Vector2i& glyphSize, unsigned char firstChar, const Vector3i* colorKey, const TextureScaleMode* scaleModeOverride)
+{
+	// Return cached
+	const AssetId id = AssetIds::FromKey(fontKey);
+	if (BitmapFont* cached = m_fonts.Find(id)) {
+		m_residency->Touch(cached->GetTexture(), m_frame);
+		return cached;
 	}
 
-	Texture* texture = LoadTexture(relativePath, colorKey, textureScaleModeOverride);
+	// Load texture
+	Texture* texture = LoadTextureInternal(relativePath, colorKey, scaleModeOverride);
 	if (!texture || !texture->IsValid()) {
-		LOG_ERROR("Failed to create Font '" + fontKey + "' because texture could not be loaded: " + relativePath);
+		LOG_ERROR("Failed to create Font '" + std::string(fontKey) + "' because texture could not be loaded: " + std::string(relativePath));
 		return nullptr;
 	}
 
-	auto font = std::make_unique<BitmapFont>(texture, glyphSize, firstChar);
-	BitmapFont* out = font.get();
-	m_fonts.emplace(fontKey, std::move(font));
-	return out;
+	// Create font, cache and return
+	return m_fonts.Insert(id, std::make_unique<BitmapFont>(texture, glyphSize, firstChar));
 }
 
-BitmapFont* AssetManager::GetFont(const std::string& keyOrRelativePath) const
+BitmapFont* AssetManager::GetFont(std::string_view keyOrRelativePath) const
 {
-	auto it = m_fonts.find(keyOrRelativePath);
-	if (it != m_fonts.end()) {
-		return it->second.get();
-	}
-	return nullptr;
+	return m_fonts.Find(AssetIds::FromKey(keyOrRelativePath));
 }
 
-bool AssetManager::IsFontLoaded(const std::string& keyOrRelativePath) const
+bool AssetManager::IsFontLoaded(std::string_view keyOrRelativePath) const
 {
-	return m_fonts.find(keyOrRelativePath) != m_fonts.end();
+	return m_fonts.Contains(AssetIds::FromKey(keyOrRelativePath));
 }
 
-void AssetManager::UnloadFont(const std::string& keyOrRelativePath)
+void AssetManager::UnloadFont(std::string_view keyOrRelativePath)
 {
-	auto it = m_fonts.find(keyOrRelativePath);
-	if (it != m_fonts.end()) {
-		LOG_INFO("Unloading font: " + keyOrRelativePath);
-		m_fonts.erase(it);
+	if (m_fonts.Erase(AssetIds::FromKey(keyOrRelativePath))) {
+		LOG_INFO("Unloading font: " + std::string(keyOrRelativePath));
 	}
 	else {
-		LOG_WARN("Font not found for unloading: " + keyOrRelativePath);
+		LOG_WARN("Font not found for unloading: " + std::string(keyOrRelativePath));
 	}
 }
 
 void AssetManager::UnloadAllFonts()
 {
 	std::stringstream logMsg;
-	logMsg << "Unloading all Fonts (count: " << m_fonts.size() << ")";
+	logMsg << "Unloading all Fonts (count: " << m_fonts.Size() << ")";
 	LOG_INFO(logMsg.str());
-	m_fonts.clear();
+	m_fonts.Clear();
+}
+
+// ---------------- Async loading ----------------
+
+void AssetManager::RunJob(std::function<void()> job) {
+	if (m_jobs) {
+		m_jobs->Submit(std::move(job));
+	}
+	else {
+		job();
+	}
+}
+
+std::shared_future<Texture*> AssetManager::LoadTextureAsync(std::string_view relativePath) {
+	return LoadTextureAsyncInternal(relativePath, nullptr, nullptr);
+}
+
+std::shared_future<Texture*> AssetManager::LoadTextureAsync(std::string_view relativePath, const Vector3i& colorKey) {
+	return LoadTextureAsyncInternal(relativePath, &colorKey, nullptr);
+}
+
+std::shared_future<Texture*> AssetManager::LoadTextureAsync(std::string_view relativePath, const Vector3i& colorKey, TextureScaleMode scaleModeOverride) {
+	return LoadTextureAsyncInternal(relativePath, &colorKey, &scaleModeOverride);
+}
+
+std::shared_future<Texture*> AssetManager::LoadTextureAsyncInternal(std::string_view relativePath, const Vector3i* colorKey, const TextureScaleMode* scaleModeOverride) {
+	const AssetId id = TextureId(relativePath, colorKey);
+
+	// Already loaded
+	if (Texture* cached = m_textures.Find(id)) {
+		if (scaleModeOverride) {
+			cached->SetScaleMode(*scaleModeOverride);
+		}
+		m_residency->Touch(cached, m_frame);
+		return MakeReadyFuture(cached);
+	}
+
+	// Already in flight (the override is applied when it finishes; the worker never reads it)
+	auto pending = m_pendingTextures.find(id);
+	if (pending != m_pendingTextures.end()) {
+		if (scaleModeOverride) {
+			pending->second->hasScaleModeOverride = true;
+			pending->second->scaleModeOverride = *scaleModeOverride;
+		}
+		return pending->second->future;
+	}
+
+	auto load = std::make_shared<AsyncTextureLoad>();
+	load->id = id;
+	load->relativePath = std::string(relativePath);
+	load->fullPath = m_basePath + load->relativePath;
+	load->useColorKey = colorKey != nullptr;
+	load->colorKey = colorKey ? *colorKey : Vector3i(0, 0, 0);
+	load->hasScaleModeOverride = scaleModeOverride != nullptr;
+	load->scaleModeOverride = scaleModeOverride ? *scaleModeOverride : m_defaultTextureScaleMode;
+	load->future = load->promise.get_future().share();
+	load->requestTime = LoadClock::now();
+	m_pendingTextures.emplace(id, load);
+
+	if (const BakedTextureFormat::Header* baked = FindBakedTexture(m_pack.get(), id)) {
+		// Nothing to decode; wait for upload budget like any other texture.
+		load->pack = m_pack;
+		load->baked = baked;
+		m_decodedTextures.push_back(load);
+		LOG_INFO("Queued baked texture upload: " + load->relativePath);
+		return load->future;
+	}
+
+	LOG_INFO("Queued async texture load: " + load->fullPath);
+
+	std::shared_ptr<LoadInbox> inbox = m_inbox;
+	std::shared_ptr<const AssetPack> pack = m_pack;
+	RunJob([load, inbox, pack]() {
+		const auto start = LoadClock::now();
+		try {
+			load->surface = DecodeSurface(pack.get(), load->relativePath, load->fullPath, load->useColorKey ? &load->colorKey : nullptr);
+		}
+		catch (const std::exception& e) {
+			load->error = e.what();
+		}
+		load->decodeMs = MsBetween(start, LoadClock::now());
+
+		{
+			std::lock_guard<std::mutex> lock(inbox->mutex);
+			inbox->textures.push_back(load);
+		}
+		inbox->ready.notify_all();
+	});
+
+	return load->future;
+}
+
+std::shared_future<SpriteSheet*> AssetManager::LoadSpriteSheetAsync(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize) {
+	return LoadSpriteSheetAsyncInternal(sheetKey, textureRelativePath, frameSize, nullptr);
+}
+
+std::shared_future<SpriteSheet*> AssetManager::LoadSpriteSheetAsync(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey) {
+	return LoadSpriteSheetAsyncInternal(sheetKey, textureRelativePath, frameSize, &colorKey);
+}
+
+std::shared_future<SpriteSheet*> AssetManager::LoadSpriteSheetAsyncInternal(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i* colorKey) {
+	const AssetId sheetId = AssetIds::FromKey(sheetKey);
+	if (SpriteSheet* cached = m_spriteSheets.Find(sheetId)) {
+		m_residency->Touch(cached->texture, m_frame);
+		return MakeReadyFuture(cached);
+	}
+	auto pending = m_pendingSpriteSheets.find(sheetId);
+	if (pending != m_pendingSpriteSheets.end()) {
+		return pending->second;
+	}
+
+	std::shared_future<Texture*> textureFuture = colorKey
+		? LoadTextureAsync(textureRelativePath, *colorKey)
+		: LoadTextureAsync(textureRelativePath);
+
+	auto promise = std::make_shared<std::promise<SpriteSheet*>>();
+	std::shared_future<SpriteSheet*> future = promise->get_future().share();
+	m_pendingSpriteSheets.emplace(sheetId, future);
+
+	const bool useColorKey = colorKey != nullptr;
+	const Vector3i key = colorKey ? *colorKey : Vector3i(0, 0, 0);
+	m_dependents.push_back([this, sheetId, name = std::string(sheetKey), path = std::string(textureRelativePath), frameSize, useColorKey, key, textureFuture, promise](bool abandon) {
+		if (abandon) {
+			promise->set_value(nullptr);
+			return true;
+		}
+		if (!IsFutureReady(textureFuture)) {
+			return false;
+		}
+		SpriteSheet* sheet = nullptr;
+		// The texture is cached by now, so the synchronous path only builds the sheet.
+		if (textureFuture.get()) {
+			sheet = LoadSpriteSheetInternal(sheetId, name, path, frameSize, useColorKey ? &key : nullptr, nullptr);
+		}
+		m_pendingSpriteSheets.erase(sheetId);
+		promise->set_value(sheet);
+		return true;
+	});
+
+	return future;
+}
+
+std::shared_future<BitmapFont*> AssetManager::LoadFontAsync(std::string_view fontKey, std::string_view relativePath, const Vector2i& glyphSize, const Vector3i& colorKey, unsigned char firstChar) {
+	const AssetId fontId = AssetIds::FromKey(fontKey);
+	if (BitmapFont* cached = m_fonts.Find(fontId)) {
+		m_residency->Touch(cached->GetTexture(), m_frame);
+		return MakeReadyFuture(cached);
+	}
+	auto pending = m_pendingFonts.find(fontId);
+	if (pending != m_pendingFonts.end()) {
+		return pending->second;
+	}
+
+	std::shared_future<Texture*> textureFuture = LoadTextureAsync(relativePath, colorKey, m_defaultTextureScaleMode);
+
+	auto promise = std::make_shared<std::promise<BitmapFont*>>();
+	std::shared_future<BitmapFont*> future = promise->get_future().share();
+	m_pendingFonts.emplace(fontId, future);
+
+	m_dependents.push_back([this, fontId, key = std::string(fontKey), path = std::string(relativePath), glyphSize, colorKey, firstChar, textureFuture, promise](bool abandon) {
+		if (abandon) {
+			promise->set_value(nullptr);
+			return true;
+		}
+		if (!IsFutureReady(textureFuture)) {
+			return false;
+		}
+		BitmapFont* font = nullptr;
+		if (textureFuture.get()) {
+			font = LoadFont(key, path, glyphSize, colorKey, firstChar);
+		}
+		m_pendingFonts.erase(fontId);
+		promise->set_value(font);
+		return true;
+	});
+
+	return future;
+}
+
+std::shared_future<AudioClip*> AssetManager::LoadAudioClipAsync(std::string_view relativePath) {
+	const AssetId id = AssetIds::FromPath(relativePath);
+	if (AudioClip* cached = m_audioClips.Find(id)) {
+		m_residency->Touch(cached, m_frame);
+		return MakeReadyFuture(cached);
+	}
+	auto pending = m_pendingAudioClips.find(id);
+	if (pending != m_pendingAudioClips.end()) {
+		return pending->second->future;
+	}
+
+	auto load = std::make_shared<AsyncAudioLoad>();
+	load->id = id;
+	load->relativePath = std::string(relativePath);
+	load->fullPath = m_basePath + load->relativePath;
+	load->future = load->promise.get_future().share();
+	load->requestTime = LoadClock::now();
+	m_pendingAudioClips.emplace(id, load);
+
+	LOG_INFO("Queued async audio clip load: " + load->fullPath);
+
+	std::shared_ptr<LoadInbox> inbox = m_inbox;
+	std::shared_ptr<const AssetPack> pack = m_pack;
+	RunJob([load, inbox, pack]() {
+		const auto start = LoadClock::now();
+		try {
+			load->clip = DecodeWav(pack.get(), load->fullPath, load->relativePath);
+		}
+		catch (const std::exception& e) {
+			load->error = e.what();
+		}
+		load->decodeMs = MsBetween(start, LoadClock::now());
+
+		{
+			std::lock_guard<std::mutex> lock(inbox->mutex);
+			inbox->audioClips.push_back(load);
+		}
+		inbox->ready.notify_all();
+	});
+
+	return load->future;
+}
+
+void AssetManager::FinishTextureLoad(AsyncTextureLoad& load) {
+	m_pendingTextures.erase(load.id);
+
+	if (!load.surface && !load.baked) {
+		LOG_ERROR("Failed to load texture " + load.fullPath + ": " + load.error);
+		load.promise.set_value(nullptr);
+		return;
+	}
+
+	// A synchronous LoadTexture may have beaten us to it.
+	if (Texture* cached = m_textures.Find(load.id)) {
+		m_residency->Touch(cached, m_frame);
+		load.promise.set_value(cached);
+		return;
+	}
+
+	const auto start = LoadClock::now();
+	try {
+		auto texture = load.baked
+			? UploadBakedTexture(m_renderer, load.baked)
+			: std::make_unique<Texture>(m_renderer, *load.surface);
+		texture->SetScaleMode(load.hasScaleModeOverride ? load.scaleModeOverride : m_defaultTextureScaleMode);
+		Texture* result = m_textures.Insert(load.id, std::move(texture));
+		TrackResident(result, AssetKind::Texture, load.id, result->GetByteSize());
+
+		const auto end = LoadClock::now();
+		AssetLoadStats stats;
+		stats.id = load.id;
+		stats.key = load.relativePath;
+		stats.type = "Texture";
+		stats.async = true;
+		stats.decodeMs = load.decodeMs;
+		stats.uploadMs = MsBetween(start, end);
+		stats.totalMs = MsBetween(load.requestTime, end);
+		stats.bytes = load.GetUploadBytes();
+		m_loadStats.push_back(stats);
+
+		std::stringstream msg;
+		msg << "Texture loaded (async): " << load.relativePath
+			<< " (" << result->GetSize().x << "x" << result->GetSize().y
+			<< ", decode " << stats.decodeMs << " ms, upload " << stats.uploadMs
+			<< " ms, total " << stats.totalMs << " ms)";
+		LOG_INFO(msg.str());
+
+		load.surface.reset();
+		load.baked = nullptr;
+		load.pack.reset();
+		load.promise.set_value(result);
+	}
+	catch (const EngineException& e) {
+		LOG_ERROR("Failed to upload texture " + load.fullPath + ": " + e.what());
+		load.promise.set_value(nullptr);
+	}
+}
+
+void AssetManager::FinishAudioLoad(AsyncAudioLoad& load) {
+	m_pendingAudioClips.erase(load.id);
+
+	if (!load.clip) {
+		LOG_ERROR("Failed to load audio clip " + load.fullPath + ": " + load.error);
+		load.promise.set_value(nullptr);
+		return;
+	}
+
+	if (AudioClip* cached = m_audioClips.Find(load.id)) {
+		m_residency->Touch(cached, m_frame);
+		load.promise.set_value(cached);
+		return;
+	}
+
+	AssetLoadStats stats;
+	stats.id = load.id;
+	stats.key = load.relativePath;
+	stats.type = "AudioClip";
+	stats.async = true;
+	stats.decodeMs = load.decodeMs;
+	stats.totalMs = MsBetween(load.requestTime, LoadClock::now());
+	stats.bytes = load.clip->pcm.size();
+	m_loadStats.push_back(stats);
+
+	AudioClip* result = m_audioClips.Insert(load.id, std::move(load.clip));
+	TrackResident(result, AssetKind::AudioClip, load.id, result->pcm.size());
+	LOG_INFO("Loaded AudioClip (async): " + load.relativePath);
+	load.promise.set_value(result);
+}
+
+void AssetManager::ResolveDependents() {
+	std::erase_if(m_dependents, [](const std::function<bool(bool)>& resolve) { return resolve(false); });
+}
+
+void AssetManager::Update() {
+	PumpLoads();
+	EnforceMemoryBudget();
+	++m_frame;
+}
+
+void AssetManager::PumpLoads() {
+	std::vector<std::shared_ptr<AsyncTextureLoad>> textures;
+	std::vector<std::shared_ptr<AsyncAudioLoad>> audioClips;
+	{
+		std::lock_guard<std::mutex> lock(m_inbox->mutex);
+		textures.swap(m_inbox->textures);
+		audioClips.swap(m_inbox->audioClips);
+	}
+
+	// Audio needs no GPU work, so it is never budgeted.
+	for (auto& load : audioClips) {
+		FinishAudioLoad(*load);
+	}
+
+	for (auto& load : textures) {
+		m_decodedTextures.push_back(std::move(load));
+	}
+
+	size_t uploadedBytes = 0;
+	bool uploadedAny = false;
+	while (!m_decodedTextures.empty()) {
+		std::shared_ptr<AsyncTextureLoad> load = m_decodedTextures.front();
+		const size_t bytes = load->GetUploadBytes();
+		// Always make progress, even if one texture is larger than the whole budget.
+		if (uploadedAny && uploadedBytes + bytes > m_uploadBudgetBytes) {
+			break;
+		}
+		m_decodedTextures.pop_front();
+		FinishTextureLoad(*load);
+		uploadedBytes += bytes;
+		uploadedAny = true;
+	}
+
+	ResolveDependents();
+}
+
+void AssetManager::WaitForPendingLoads() {
+	const size_t savedBudget = m_uploadBudgetBytes;
+	m_uploadBudgetBytes = static_cast<size_t>(-1);
+
+	while (GetPendingLoadCount() > 0) {
+		{
+			std::unique_lock<std::mutex> lock(m_inbox->mutex);
+			m_inbox->ready.wait_for(lock, std::chrono::milliseconds(5), [this] {
+				return !m_inbox->textures.empty() || !m_inbox->audioClips.empty();
+			});
+		}
+		PumpLoads();
+	}
+
+	m_uploadBudgetBytes = savedBudget;
+}
+
+AssetPreload AssetManager::Preload(const AssetManifest& manifest) {
+	const auto start = LoadClock::now();
+
+	// Queue everything first so decodes overlap, then wait once.
+	std::vector<std::shared_future<Texture*>> textures;
+	textures.reserve(manifest.GetTextures().size());
+	for (const auto& entry : manifest.GetTextures()) {
+		textures.push_back(entry.useColorKey
+			? LoadTextureAsync(entry.path, entry.colorKey)
+			: LoadTextureAsync(entry.path));
+	}
+
+	std::vector<std::shared_future<SpriteSheet*>> spriteSheets;
+	spriteSheets.reserve(manifest.GetSpriteSheets().size());
+	for (const auto& entry : manifest.GetSpriteSheets()) {
+		spriteSheets.push_back(entry.useColorKey
+			? LoadSpriteSheetAsync(entry.key, entry.texturePath, entry.frameSize, entry.colorKey)
+			: LoadSpriteSheetAsync(entry.key, entry.texturePath, entry.frameSize));
+	}
+
+	std::vector<std::shared_future<BitmapFont*>> fonts;
+	fonts.reserve(manifest.GetFonts().size());
+	for (const auto& entry : manifest.GetFonts()) {
+		fonts.push_back(LoadFontAsync(entry.key, entry.path, entry.glyphSize, entry.colorKey, entry.firstChar));
+	}
+
+	std::vector<std::shared_future<AudioClip*>> audioClips;
+	audioClips.reserve(manifest.GetAudioClips().size());
+	for (const auto& path : manifest.GetAudioClips()) {
+		audioClips.push_back(LoadAudioClipAsync(path));
+	}
+
+	WaitForPendingLoads();
+
+	AssetPreload preload;
+	auto collect = [this, &preload](const auto& futures, auto& handles) {
+		handles.reserve(futures.size());
+		for (const auto& future : futures) {
+			if (auto* asset = future.get()) {
+				handles.push_back(Retain(asset));
+			}
+			else {
+				++preload.failedCount;
+			}
+		}
+	};
+	collect(textures, preload.textures);
+	collect(spriteSheets, preload.spriteSheets);
+	collect(fonts, preload.fonts);
+	collect(audioClips, preload.audioClips);
+	preload.elapsedMs = MsBetween(start, LoadClock::now());
+
+	std::stringstream msg;
+	msg << "Preloaded " << preload.Size() << "/" << manifest.Size() << " manifest assets in "
+		<< preload.elapsedMs << " ms";
+	if (preload.failedCount > 0) {
+		msg << " (" << preload.failedCount << " failed)";
+		LOG_WARN(msg.str());
+	}
+	else {
+		LOG_INFO(msg.str());
+	}
+	return preload;
+}
+
+void AssetManager::ReportLazyLoad(const char* type, const std::string& path) const {
+	if (m_reportLazyLoads) {
+		LOG_WARN(std::string("Lazy ") + type + " load not covered by the scene's preload manifest: " + path);
+	}
+}
+
+size_t AssetManager::GetPendingLoadCount() const {
+	return m_pendingTextures.size() + m_pendingAudioClips.size() + m_dependents.size();
+}
+
+// ---------------- Memory budget ----------------
+
+TextureHandle AssetManager::Retain(Texture* texture) {
+	if (!texture) return {};
+	m_residency->Touch(texture, m_frame);
+	return TextureHandle(m_residency, texture, texture);
+}
+
+SpriteSheetHandle AssetManager::Retain(SpriteSheet* sheet) {
+	if (!sheet) return {};
+	m_residency->Touch(sheet->texture, m_frame);
+	return SpriteSheetHandle(m_residency, sheet->texture, sheet);
+}
+
+BitmapFontHandle AssetManager::Retain(BitmapFont* font) {
+	if (!font) return {};
+	m_residency->Touch(font->GetTexture(), m_frame);
+	return BitmapFontHandle(m_residency, font->GetTexture(), font);
+}
+
+AudioClipHandle AssetManager::Retain(AudioClip* clip) {
+	if (!clip) return {};
+	m_residency->Touch(clip, m_frame);
+	return AudioClipHandle(m_residency, clip, clip);
+}
+
+void AssetManager::TrackResident(const void* asset, AssetKind kind, AssetId id, size_t bytes) {
+	m_residency->Add(asset, kind, id, bytes, m_frame);
+	m_peakBytes = std::max(m_peakBytes, m_residency->GetTotalBytes());
+}
+
+bool AssetManager::Evict(const void* asset) {
+	const AssetResidency::Record* record = m_residency->Find(asset);
+	if (!record) return false;
+
+	const AssetId id = record->id;
+	if (record->kind == AssetKind::Texture) {
+		std::unique_ptr<Texture> texture = m_textures.Extract(id);
+		m_residency->Remove(asset);
+		if (texture) {
+			DropTextureDependents(texture.get());
+		}
+	}
+	else {
+		std::unique_ptr<AudioClip> clip = m_audioClips.Extract(id);
+		m_residency->Remove(asset);
+		if (clip) {
+			Audio::ForgetClip(clip.get());
+		}
+	}
+	++m_evictedCount;
+	return true;
+}
+
+size_t AssetManager::EnforceMemoryBudget() {
+	if (m_memoryBudgetBytes == 0 || m_residency->GetTotalBytes() <= m_memoryBudgetBytes) {
+		return 0;
+	}
+
+	const size_t before = m_residency->GetTotalBytes();
+	size_t evicted = 0;
+	for (const void* asset : m_residency->CollectEvictable(m_frame)) {
+		if (m_residency->GetTotalBytes() <= m_memoryBudgetBytes) {
+			break;
+		}
+		if (Evict(asset)) {
+			++evicted;
+		}
+	}
+
+	const size_t after = m_residency->GetTotalBytes();
+	std::stringstream msg;
+	msg << "Asset budget: evicted " << evicted << " assets (" << (before - after) << " bytes), "
+		<< after << " / " << m_memoryBudgetBytes << " bytes resident";
+	if (after > m_memoryBudgetBytes) {
+		msg << " - still over budget, remaining assets are referenced or in use this frame";
+		LOG_WARN(msg.str());
+	}
+	else {
+		LOG_INFO(msg.str());
+	}
+	return before - after;
+}
+
+AssetMemoryUsage AssetManager::GetMemoryUsage() const {
+	AssetMemoryUsage usage;
+	usage.textureBytes = m_residency->GetBytes(AssetKind::Texture);
+	usage.audioBytes = m_residency->GetBytes(AssetKind::AudioClip);
+	usage.textureCount = m_textures.Size();
+	usage.audioClipCount = m_audioClips.Size();
+	usage.spriteSheetCount = m_spriteSheets.Size();
+	usage.fontCount = m_fonts.Size();
+	usage.peakBytes = m_peakBytes;
+	usage.budgetBytes = m_memoryBudgetBytes;
+	usage.evictedCount = m_evictedCount;
+	return usage;
+}
+
+void AssetManager::ResetPeakMemoryUsage() {
+	m_peakBytes = m_residency->GetTotalBytes();
 }
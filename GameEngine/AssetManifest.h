@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Types.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// List of assets a scene needs, declared up front (Scene::OnDeclareAssets / GameMode::OnDeclareAssets).
+// AssetManager::Preload loads the whole list in parallel before the scene's first frame.
+// Entries use the same arguments as the matching AssetManager::Load* call, so the cache IDs line up:
+// a texture declared with a color key only covers loads that pass that same key.
+class AssetManifest {
+public:
+	struct TextureEntry {
+		std::string path;
+		bool useColorKey = false;
+		Vector3i colorKey = Vector3i(0, 0, 0);
+	};
+
+	struct SpriteSheetEntry {
+		std::string key;
+		std::string texturePath;
+		Vector2i frameSize = Vector2i(0, 0);
+		bool useColorKey = false;
+		Vector3i colorKey = Vector3i(0, 0, 0);
+	};
+
+	struct FontEntry {
+		std::string key;
+		std::string path;
+		Vector2i glyphSize = Vector2i(0, 0);
+		Vector3i colorKey = Vector3i(0, 0, 0);
+		unsigned char firstChar = 32;
+	};
+
+	AssetManifest& AddTexture(std::string_view path) {
+		m_textures.push_back({ std::string(path), false, Vector3i(0, 0, 0) });
+		return *this;
+	}
+
+	AssetManifest& AddTexture(std::string_view path, const Vector3i& colorKey) {
+		m_textures.push_back({ std::string(path), true, colorKey });
+		return *this;
+	}
+
+	AssetManifest& AddSpriteSheet(std::string_view key, std::string_view texturePath, const Vector2i& frameSize) {
+		m_spriteSheets.push_back({ std::string(key), std::string(texturePath), frameSize, false, Vector3i(0, 0, 0) });
+		return *this;
+	}
+
+	AssetManifest& AddSpriteSheet(std::string_view key, std::string_view texturePath, const Vector2i& frameSize, const Vector3i& colorKey) {
+		m_spriteSheets.push_back({ std::string(key), std::string(texturePath), frameSize, true, colorKey });
+		return *this;
+	}
+
+	// Same as LoadFont(key, path, glyphSize, colorKey, firstChar); the key is usually the path itself.
+	AssetManifest& AddFont(std::string_view key, std::string_view path, const Vector2i& glyphSize, const Vector3i& colorKey, unsigned char firstChar = 32) {
+		m_fonts.push_back({ std::string(key), std::string(path), glyphSize, colorKey, firstChar });
+		return *this;
+	}
+
+	AssetManifest& AddAudioClip(std::string_view path) {
+		m_audioClips.emplace_back(path);
+		return *this;
+	}
+
+	const std::vector<TextureEntry>& GetTextures() const { return m_textures; }
+	const std::vector<SpriteSheetEntry>& GetSpriteSheets() const { return m_spriteSheets; }
+	const std::vector<FontEntry>& GetFonts() const { return m_fonts; }
+	const std::vector<std::string>& GetAudioClips() const { return m_audioClips; }
+
+	size_t Size() const { return m_textures.size() + m_spriteSheets.size() + m_fonts.size() + m_audioClips.size(); }
+	bool IsEmpty() const { return Size() == 0; }
+
+	void Clear() {
+		m_textures.clear();
+		m_spriteSheets.clear();
+		m_fonts.clear();
+		m_audioClips.clear();
+	}
+
+private:
+	std::vector<TextureEntry> m_textures;
+	std::vector<SpriteSheetEntry> m_spriteSheets;
+	std::vector<FontEntry> m_fonts;
+	std::vector<std::string> m_audioClips;
+};
@@ -0,0 +1,155 @@
+#include "AssetPack.h"
+#include "Logger.h"
+
+#include <algorithm>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace AssetPackFormat;
+
+AssetPack::~AssetPack() {
+	Close();
+}
+
+bool AssetPack::Open(const std::string& path) {
+	Close();
+
+#if defined(_WIN32)
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	LARGE_INTEGER fileSize{};
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping) {
+		CloseHandle(file);
+		return false;
+	}
+
+	const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!view) {
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	m_file = file;
+	m_mapping = mapping;
+	m_base = static_cast<const std::uint8_t*>(view);
+	m_size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+	const int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+
+	struct stat st {};
+	if (fstat(fd, &st) != 0 || st.st_size == 0) {
+		::close(fd);
+		return false;
+	}
+
+	void* view = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+	// The mapping keeps the file alive on its own.
+	::close(fd);
+	if (view == MAP_FAILED) {
+		return false;
+	}
+
+	m_base = static_cast<const std::uint8_t*>(view);
+	m_size = static_cast<std::size_t>(st.st_size);
+#endif
+
+	m_path = path;
+	if (!Validate()) {
+		LOG_ERROR("Asset pack is corrupt or from an unsupported version: " + path);
+		Close();
+		return false;
+	}
+
+	LOG_INFO("Asset pack mapped: " + path + " (" + std::to_string(m_entryCount) + " entries, " + std::to_string(m_size) + " bytes)");
+	return true;
+}
+
+void AssetPack::Close() {
+	if (!m_base) return;
+
+#if defined(_WIN32)
+	UnmapViewOfFile(m_base);
+	CloseHandle(static_cast<HANDLE>(m_mapping));
+	CloseHandle(static_cast<HANDLE>(m_file));
+	m_mapping = nullptr;
+	m_file = nullptr;
+#else
+	munmap(const_cast<std::uint8_t*>(m_base), m_size);
+#endif
+
+	m_base = nullptr;
+	m_size = 0;
+	m_toc = nullptr;
+	m_entryCount = 0;
+	m_path.clear();
+}
+
+bool AssetPack::Validate() {
+	if (m_size < sizeof(Header)) {
+		return false;
+	}
+
+	const Header* header = reinterpret_cast<const Header*>(m_base);
+	if (header->magic != kMagic || header->version != kVersion) {
+		return false;
+	}
+
+	const std::uint64_t tocBytes = static_cast<std::uint64_t>(header->entryCount) * sizeof(TocEntry);
+	if (header->tocOffset % alignof(TocEntry) != 0 || header->tocOffset > m_size || tocBytes > m_size - header->tocOffset) {
+		return false;
+	}
+
+	const TocEntry* toc = reinterpret_cast<const TocEntry*>(m_base + header->tocOffset);
+	for (std::uint32_t i = 0; i < header->entryCount; ++i) {
+		const TocEntry& e = toc[i];
+		if (e.offset > m_size || e.size > m_size - e.offset) {
+			return false;
+		}
+		// Find() relies on strictly increasing hashes.
+		if (i > 0 && toc[i - 1].pathHash >= e.pathHash) {
+			return false;
+		}
+	}
+
+	m_toc = toc;
+	m_entryCount = header->entryCount;
+	return true;
+}
+
+std::span<const std::uint8_t> AssetPack::Find(std::string_view relativePath) const {
+	// Hashing normalizes on the fly, so lookups never allocate.
+	return Find(AssetIds::FromPath(relativePath));
+}
+
+std::span<const std::uint8_t> AssetPack::Find(AssetId hash) const {
+	if (!m_base || m_entryCount == 0) {
+		return {};
+	}
+
+	const TocEntry* end = m_toc + m_entryCount;
+	const TocEntry* it = std::lower_bound(m_toc, end, hash,
+		[](const TocEntry& e, std::uint64_t h) { return e.pathHash < h; });
+
+	if (it == end || it->pathHash != hash) {
+		return {};
+	}
+	return { m_base + it->offset, static_cast<std::size_t>(it->size) };
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "AssetPackFormat.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+// Read-only asset archive mapped into memory. Lookups return views straight into the mapping,
+// so nothing is copied until a decoder reads the bytes. Safe to query from any thread once open.
+class AssetPack {
+public:
+	AssetPack() = default;
+	~AssetPack();
+
+	AssetPack(const AssetPack&) = delete;
+	AssetPack& operator=(const AssetPack&) = delete;
+
+	// Maps the file and validates header / table of contents. Returns false (and stays closed) on failure.
+	bool Open(const std::string& path);
+	void Close();
+
+	bool IsOpen() const { return m_base != nullptr; }
+	const std::string& GetPath() const { return m_path; }
+	std::uint32_t GetEntryCount() const { return m_entryCount; }
+
+	// Zero-copy view of an entry (empty if not packed). Valid while the pack stays open.
+	std::span<const std::uint8_t> Find(std::string_view relativePath) const;
+	std::span<const std::uint8_t> Find(AssetId id) const;
+
+private:
+	bool Validate();
+
+	std::string m_path;
+	const std::uint8_t* m_base = nullptr;
+	std::size_t m_size = 0;
+	const AssetPackFormat::TocEntry* m_toc = nullptr;
+	std::uint32_t m_entryCount = 0;
+
+	// Platform mapping handles
+	void* m_file = nullptr;
+	void* m_mapping = nullptr;
+};
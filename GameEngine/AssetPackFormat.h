@@ -0,0 +1,55 @@
+#pragma once
+
+#include "AssetId.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// On-disk layout of an asset pack (.pak), shared by the engine reader and the AssetPacker tool.
+//
+//   Header
+//   TocEntry[entryCount]   sorted by pathHash (binary searchable)
+//   blobs                  each starting on a kBlobAlignment boundary
+//
+// All integers are little-endian. Paths are not stored; entries are keyed by AssetIds::FromPath(relativePath),
+// the same ID AssetManager uses for loose files.
+namespace AssetPackFormat {
+	constexpr std::uint32_t kMagic = 0x4B504C53; // "SLPK"
+	constexpr std::uint32_t kVersion = 1;
+	constexpr std::uint64_t kBlobAlignment = 16;
+
+	struct Header {
+		std::uint32_t magic = kMagic;
+		std::uint32_t version = kVersion;
+		std::uint32_t entryCount = 0;
+		std::uint32_t reserved = 0;
+		std::uint64_t tocOffset = 0;
+	};
+	static_assert(sizeof(Header) == 24, "AssetPack header layout changed");
+
+	struct TocEntry {
+		std::uint64_t pathHash = 0;
+		std::uint64_t offset = 0; // from the start of the file
+		std::uint64_t size = 0;
+	};
+	static_assert(sizeof(TocEntry) == 24, "AssetPack TOC layout changed");
+
+	// Lowercase, forward slashes, no leading "./" or slash (the spelling AssetIds::FromPath hashes).
+	inline std::string NormalizePath(std::string_view path) {
+		std::string out;
+		out.reserve(path.size());
+		for (char c : path) {
+			if (c == '\\') c = '/';
+			if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+			out.push_back(c);
+		}
+		while (out.rfind("./", 0) == 0) out.erase(0, 2);
+		while (!out.empty() && out.front() == '/') out.erase(0, 1);
+		return out;
+	}
+
+	constexpr std::uint64_t AlignUp(std::uint64_t value) {
+		return (value + kBlobAlignment - 1) & ~(kBlobAlignment - 1);
+	}
+}
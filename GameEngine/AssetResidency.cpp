@@ -0,0 +1,91 @@
+#include "AssetResidency.h"
+
+#include <algorithm>
+
+void AssetResidency::Add(const void* asset, AssetKind kind, AssetId id, size_t bytes, std::uint64_t frame) {
+	Remove(asset);
+
+	Record record;
+	record.kind = kind;
+	record.id = id;
+	record.bytes = bytes;
+	record.lastUseFrame = frame;
+	record.generation = m_nextGeneration++;
+	m_records.emplace(asset, record);
+	m_bytes[static_cast<size_t>(kind)] += bytes;
+}
+
+void AssetResidency::Remove(const void* asset) {
+	auto it = m_records.find(asset);
+	if (it == m_records.end()) return;
+	m_bytes[static_cast<size_t>(it->second.kind)] -= it->second.bytes;
+	m_records.erase(it);
+}
+
+void AssetResidency::Clear(AssetKind kind) {
+	std::erase_if(m_records, [kind](const auto& kv) { return kv.second.kind == kind; });
+	m_bytes[static_cast<size_t>(kind)] = 0;
+}
+
+void AssetResidency::Clear() {
+	m_records.clear();
+	std::fill(std::begin(m_bytes), std::end(m_bytes), size_t{ 0 });
+}
+
+void AssetResidency::Touch(const void* asset, std::uint64_t frame) {
+	auto it = m_records.find(asset);
+	if (it != m_records.end()) {
+		it->second.lastUseFrame = frame;
+	}
+}
+
+std::uint64_t AssetResidency::Retain(const void* asset) {
+	auto it = m_records.find(asset);
+	if (it == m_records.end()) return 0;
+	++it->second.refCount;
+	return it->second.generation;
+}
+
+void AssetResidency::Retain(const void* asset, std::uint64_t generation) {
+	auto it = m_records.find(asset);
+	if (it != m_records.end() && it->second.generation == generation) {
+		++it->second.refCount;
+	}
+}
+
+void AssetResidency::Release(const void* asset, std::uint64_t generation) {
+	auto it = m_records.find(asset);
+	if (it != m_records.end() && it->second.generation == generation && it->second.refCount > 0) {
+		--it->second.refCount;
+	}
+}
+
+const AssetResidency::Record* AssetResidency::Find(const void* asset) const {
+	auto it = m_records.find(asset);
+	return it != m_records.end() ? &it->second : nullptr;
+}
+
+size_t AssetResidency::GetTotalBytes() const {
+	size_t total = 0;
+	for (size_t bytes : m_bytes) {
+		total += bytes;
+	}
+	return total;
+}
+
+std::vector<const void*> AssetResidency::CollectEvictable(std::uint64_t frame) const {
+	std::vector<std::pair<std::uint64_t, const void*>> candidates;
+	for (const auto& [asset, record] : m_records) {
+		if (record.refCount == 0 && record.lastUseFrame < frame) {
+			candidates.emplace_back(record.lastUseFrame, asset);
+		}
+	}
+	std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+	std::vector<const void*> out;
+	out.reserve(candidates.size());
+	for (const auto& c : candidates) {
+		out.push_back(c.second);
+	}
+	return out;
+}
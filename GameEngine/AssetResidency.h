@@ -0,0 +1,57 @@
+#pragma once
+
+#include "AssetId.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Asset types that own memory and can be evicted. Sprite sheets and fonts are views onto a texture.
+enum class AssetKind : std::uint8_t {
+	Texture,
+	AudioClip,
+	Count
+};
+
+// Bookkeeping for the assets an AssetManager holds: size, reference count and the frame each was
+// last used. Keyed by asset address; every Add starts a new generation, so references taken on an
+// asset that has since been unloaded never count against whatever is later allocated at its
+// address. Main thread only.
+class AssetResidency {
+public:
+	struct Record {
+		AssetKind kind = AssetKind::Texture;
+		AssetId id = 0;
+		size_t bytes = 0;
+		std::uint32_t refCount = 0;
+		std::uint64_t lastUseFrame = 0;
+		std::uint64_t generation = 0; // never 0 once added
+	};
+
+	void Add(const void* asset, AssetKind kind, AssetId id, size_t bytes, std::uint64_t frame);
+	void Remove(const void* asset);
+	void Clear(AssetKind kind);
+	void Clear();
+
+	void Touch(const void* asset, std::uint64_t frame);
+	// Counts a new reference and returns the generation to pass back to Release
+	// (0, which matches nothing, for unknown assets).
+	std::uint64_t Retain(const void* asset);
+	// References of another generation (the asset was evicted or unloaded since) are ignored.
+	void Retain(const void* asset, std::uint64_t generation);
+	void Release(const void* asset, std::uint64_t generation);
+
+	const Record* Find(const void* asset) const;
+
+	size_t GetBytes(AssetKind kind) const { return m_bytes[static_cast<size_t>(kind)]; }
+	size_t GetTotalBytes() const;
+
+	// Unreferenced assets last used before 'frame', least recently used first.
+	std::vector<const void*> CollectEvictable(std::uint64_t frame) const;
+
+private:
+	std::unordered_map<const void*, Record> m_records;
+	size_t m_bytes[static_cast<size_t>(AssetKind::Count)] = {};
+	std::uint64_t m_nextGeneration = 1;
+};
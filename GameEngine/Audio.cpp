@@ -1,14 +1,322 @@
 #include "Audio.h"
 
+#include "AudioClip.h"
+#include "AudioMixKernels.h"
 #include "Logger.h"
+#include "SpscRingBuffer.h"
 
 #include <SDL3/SDL.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <deque>
+#include <vector>
+
 // Internal audio state
 namespace {
+	// Command posted by the game thread and applied by the mixer callback.
+	struct AudioCommand {
+		enum class Type : std::uint8_t {
+			Play,
+			Stop,
+			SetGain,
+			SetPitch,
+			SetPan,
+			SetLoop
+		};
+
+		Type type = Type::Stop;
+		int voice = Audio::kInvalidVoice;
+		std::uint32_t serial = 0;
+		const AudioClip* clip = nullptr;
+		float value = 0.0f; // gain for Play/SetGain, pitch for SetPitch, pan for SetPan
+		float pitch = 1.0f; // Play only
+		float pan = 0.0f; // Play only
+		bool loop = false;
+	};
+
+	// Mixer-side voice state. Only touched from the audio thread
+	// (or from the game thread while the mix stream is locked).
+	struct Voice {
+		const AudioClip* clip = nullptr;
+		const float* samples = nullptr; // interleaved stereo F32
+		size_t frameCount = 0;
+		double cursor = 0.0; // fractional frame position
+		float gain = 1.0f;
+		float pan = 0.0f;
+		float pitch = 1.0f;
+		// Per-channel gain actually applied, ramped towards the gain/pan target
+		float gainL = 1.0f;
+		float gainR = 1.0f;
+		float targetL = 1.0f;
+		float targetR = 1.0f;
+		int rampFramesLeft = 0;
+		bool loop = false;
+		bool active = false;
+		std::uint32_t serial = 0;
+	};
+
+	constexpr size_t kCommandQueueCapacity = 4096;
+	constexpr int kMixChunkFrames = 1024;
+	// Length of a gain/pan change (~5 ms at 48 kHz); long enough to avoid zipper noise.
+	constexpr int kGainRampFrames = 256;
+
 	SDL_AudioDeviceID g_device = 0;
+	SDL_AudioStream* g_mixStream = nullptr;
 	bool g_initialized = false;
-	float g_masterGain = 1.0f;
+	std::atomic<float> g_masterGain{ 1.0f };
+
+	const SDL_AudioSpec g_mixSpec{ SDL_AUDIO_F32, 2, 48000 };
+
+	// Game thread -> mixer
+	SpscRingBuffer<AudioCommand> g_commands(kCommandQueueCapacity);
+	// Commands that did not fit in the ring; flushed in order by Audio::Update (game thread only)
+	std::deque<AudioCommand> g_overflow;
+	std::vector<int> g_freeVoices;
+	std::uint32_t g_nextSerial = 1;
+
+	// Mixer -> game thread: serial of the last playback that finished on each voice
+	std::array<std::atomic<std::uint32_t>, Audio::kMaxVoices> g_finishedSerial{};
+
+	// Audio thread only
+	std::array<Voice, Audio::kMaxVoices> g_voices{};
+	std::array<float, kMixChunkFrames * 2> g_mixBuffer{};
+	// Resampled frames of the voice currently being mixed
+	std::array<float, kMixChunkFrames * 2> g_voiceBuffer{};
+	float g_appliedMasterGain = 1.0f;
+	const AudioMixKernels* g_kernels = nullptr;
+
+	bool IsValidVoice(int voice) {
+		return voice >= 0 && voice < Audio::kMaxVoices;
+	}
+
+	// Queues a command, preserving order with anything already waiting in the overflow.
+	void PostCommand(const AudioCommand& command) {
+		if (g_overflow.empty() && g_commands.TryPush(command)) {
+			return;
+		}
+		g_overflow.push_back(command);
+	}
+
+	void FlushOverflow() {
+		while (!g_overflow.empty()) {
+			if (!g_commands.TryPush(g_overflow.front())) {
+				return;
+			}
+			g_overflow.pop_front();
+		}
+	}
+
+	void FinishVoice(Voice& voice, int index) {
+		if (voice.active) {
+			g_finishedSerial[static_cast<size_t>(index)].store(voice.serial, std::memory_order_release);
+		}
+		voice.active = false;
+		voice.clip = nullptr;
+		voice.samples = nullptr;
+		voice.frameCount = 0;
+	}
+
+	// Balance law for stereo sources: centre leaves both channels at unity.
+	void PanToChannelGains(float gain, float pan, float& outL, float& outR) {
+		outL = gain * std::min(1.0f, 1.0f - pan);
+		outR = gain * std::min(1.0f, 1.0f + pan);
+	}
+
+	void SetVoiceTarget(Voice& voice, bool immediate) {
+		PanToChannelGains(voice.gain, voice.pan, voice.targetL, voice.targetR);
+		if (immediate) {
+			voice.gainL = voice.targetL;
+			voice.gainR = voice.targetR;
+			voice.rampFramesLeft = 0;
+		}
+		else {
+			voice.rampFramesLeft = kGainRampFrames;
+		}
+	}
+
+	void ApplyCommand(const AudioCommand& command) {
+		if (!IsValidVoice(command.voice)) {
+			return;
+		}
+		Voice& voice = g_voices[static_cast<size_t>(command.voice)];
+
+		switch (command.type) {
+		case AudioCommand::Type::Play:
+			// Restarting a voice finishes whatever it was playing before.
+			FinishVoice(voice, command.voice);
+			voice.clip = command.clip;
+			voice.samples = reinterpret_cast<const float*>(command.clip->pcm.data());
+			voice.frameCount = command.clip->pcm.size() / (sizeof(float) * 2);
+			voice.cursor = 0.0;
+			voice.gain = command.value;
+			voice.pan = command.pan;
+			voice.pitch = command.pitch;
+			voice.loop = command.loop;
+			SetVoiceTarget(voice, true);
+			voice.serial = command.serial;
+			voice.active = voice.frameCount > 0;
+			if (!voice.active) {
+				g_finishedSerial[static_cast<size_t>(command.voice)].store(command.serial, std::memory_order_release);
+			}
+			break;
+		case AudioCommand::Type::Stop:
+			FinishVoice(voice, command.voice);
+			break;
+		case AudioCommand::Type::SetGain:
+			voice.gain = command.value;
+			SetVoiceTarget(voice, false);
+			break;
+		case AudioCommand::Type::SetPitch:
+			voice.pitch = command.value;
+			break;
+		case AudioCommand::Type::SetPan:
+			voice.pan = command.value;
+			SetVoiceTarget(voice, false);
+			break;
+		case AudioCommand::Type::SetLoop:
+			voice.loop = command.loop;
+			break;
+		}
+	}
+
+	void DrainCommands() {
+		AudioCommand command;
+		while (g_commands.TryPop(command)) {
+			ApplyCommand(command);
+		}
+	}
+
+	// Resamples up to 'frames' frames of the voice (linear interpolation for pitch) and returns
+	// a pointer to them. Unpitched voices are read straight from the clip without a copy.
+	// 'produced' is less than 'frames' when a one-shot voice reaches its end.
+	const float* ResampleVoice(Voice& voice, int frames, int& produced) {
+		const float* src = voice.samples;
+		const size_t count = voice.frameCount;
+		double cursor = voice.cursor;
+
+		if (voice.pitch == 1.0f && cursor == std::floor(cursor)) {
+			const size_t start = static_cast<size_t>(cursor);
+			produced = static_cast<int>(std::min(static_cast<size_t>(frames), count - start));
+			voice.cursor = static_cast<double>(start + static_cast<size_t>(produced));
+			if (voice.loop && voice.cursor >= static_cast<double>(count)) {
+				voice.cursor = 0.0;
+			}
+			return src + start * 2;
+		}
+
+		const double step = static_cast<double>(voice.pitch);
+		float* dst = g_voiceBuffer.data();
+		produced = 0;
+		while (produced < frames) {
+			const size_t i0 = static_cast<size_t>(cursor);
+			size_t i1 = i0 + 1;
+			if (i1 >= count) {
+				i1 = voice.loop ? 0 : i0;
+			}
+			const float t = static_cast<float>(cursor - static_cast<double>(i0));
+
+			dst[produced * 2] = src[i0 * 2] + (src[i1 * 2] - src[i0 * 2]) * t;
+			dst[produced * 2 + 1] = src[i0 * 2 + 1] + (src[i1 * 2 + 1] - src[i0 * 2 + 1]) * t;
+			++produced;
+
+			cursor += step;
+			if (cursor >= static_cast<double>(count)) {
+				if (!voice.loop) {
+					break;
+				}
+				cursor = std::fmod(cursor, static_cast<double>(count));
+			}
+		}
+		voice.cursor = cursor;
+		return dst;
+	}
+
+	// Mixes one voice into 'out' (interleaved stereo), ramping its gain if a change is pending.
+	void MixVoice(Voice& voice, int index, float* out, int frames) {
+		int mixed = 0;
+		while (mixed < frames && voice.active) {
+			int produced = 0;
+			const float* in = ResampleVoice(voice, frames - mixed, produced);
+
+			int done = 0;
+			if (voice.rampFramesLeft > 0) {
+				const int rampFrames = std::min(produced, voice.rampFramesLeft);
+				const float stepL = (voice.targetL - voice.gainL) / static_cast<float>(voice.rampFramesLeft);
+				const float stepR = (voice.targetR - voice.gainR) / static_cast<float>(voice.rampFramesLeft);
+				g_kernels->mixStereo(out + mixed * 2, in, rampFrames, voice.gainL, voice.gainR, stepL, stepR);
+
+				voice.rampFramesLeft -= rampFrames;
+				if (voice.rampFramesLeft == 0) {
+					voice.gainL = voice.targetL;
+					voice.gainR = voice.targetR;
+				}
+				else {
+					voice.gainL += stepL * static_cast<float>(rampFrames);
+					voice.gainR += stepR * static_cast<float>(rampFrames);
+				}
+				done = rampFrames;
+			}
+			if (done < produced) {
+				g_kernels->mixStereo(out + (mixed + done) * 2, in + done * 2, produced - done, voice.gainL, voice.gainR, 0.0f, 0.0f);
+			}
+			mixed += produced;
+
+			if (!voice.loop && voice.cursor >= static_cast<double>(voice.frameCount)) {
+				FinishVoice(voice, index);
+			}
+		}
+	}
+
+	// Runs on the SDL audio thread whenever the device needs more data.
+	void SDLCALL MixCallback(void* userdata, SDL_AudioStream* stream, int additionalAmount, int totalAmount) {
+		(void)userdata;
+		(void)totalAmount;
+
+		DrainCommands();
+
+		const float masterGain = g_masterGain.load(std::memory_order_relaxed);
+		int framesLeft = additionalAmount / static_cast<int>(sizeof(float) * 2);
+
+		while (framesLeft > 0) {
+			const int frames = std::min(framesLeft, kMixChunkFrames);
+			float* out = g_mixBuffer.data();
+			std::fill(out, out + frames * 2, 0.0f);
+
+			for (int v = 0; v < Audio::kMaxVoices; ++v) {
+				Voice& voice = g_voices[static_cast<size_t>(v)];
+				if (voice.active) {
+					MixVoice(voice, v, out, frames);
+				}
+			}
+
+			// Master gain changes are ramped across the chunk instead of jumping.
+			const float masterStep = (masterGain - g_appliedMasterGain) / static_cast<float>(frames);
+			g_kernels->scaleAndClip(out, frames, g_appliedMasterGain, masterStep);
+			g_appliedMasterGain = masterGain;
+
+			SDL_PutAudioStreamData(stream, out, frames * static_cast<int>(sizeof(float) * 2));
+			framesLeft -= frames;
+		}
+	}
+
+	void ResetVoices() {
+		for (int v = 0; v < Audio::kMaxVoices; ++v) {
+			g_voices[static_cast<size_t>(v)] = Voice{};
+			g_finishedSerial[static_cast<size_t>(v)].store(0, std::memory_order_relaxed);
+		}
+
+		g_freeVoices.clear();
+		for (int v = Audio::kMaxVoices - 1; v >= 0; --v) {
+			g_freeVoices.push_back(v);
+		}
+
+		AudioCommand discarded;
+		while (g_commands.TryPop(discarded)) {}
+		g_overflow.clear();
+	}
 }
 
 // audio system
@@ -25,11 +333,7 @@ bool Audio::Initialize() {
 	}
 
 	// Open default playback device
-	SDL_AudioSpec want{};
-	SDL_zero(want);
-	want.format = SDL_AUDIO_F32; // friendly format for conversion/mixing
-	want.channels = 2; // stereo
-	want.freq = 48000; // standard sample rate
+	SDL_AudioSpec want = g_mixSpec; // friendly format for conversion/mixing
 
 	g_device = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &want);
 	// Failed to open device
@@ -39,12 +343,33 @@ bool Audio::Initialize() {
 		return false;
 	}
 
+	ResetVoices();
+	g_kernels = &SelectAudioMixKernels();
+	g_appliedMasterGain = g_masterGain.load(std::memory_order_relaxed);
+
+	// A single stream carries the software mix. SDL pulls from it on the audio thread,
+	// which is where MixCallback drains the command queue.
+	g_mixStream = SDL_CreateAudioStream(&g_mixSpec, &g_mixSpec);
+	if (!g_mixStream
+		|| !SDL_SetAudioStreamGetCallback(g_mixStream, MixCallback, nullptr)
+		|| !SDL_BindAudioStream(g_device, g_mixStream)) {
+		LOG_ERROR("Failed to create mixer stream: " + std::string(SDL_GetError()));
+		if (g_mixStream) {
+			SDL_DestroyAudioStream(g_mixStream);
+			g_mixStream = nullptr;
+		}
+		SDL_CloseAudioDevice(g_device);
+		g_device = 0;
+		SDL_QuitSubSystem(SDL_INIT_AUDIO);
+		return false;
+	}
+
 	// In SDL3 an opened device won't output sound until streams are bound and fed,
 	// but resuming explicitly keeps behavior consistent.
 	SDL_ResumeAudioDevice(g_device);
 
 	g_initialized = true;
-	LOG_INFO("Audio initialized.");
+	LOG_INFO(std::string("Audio initialized (") + g_kernels->name + " mixer).");
 	return true;
 }
 
@@ -52,12 +377,21 @@ bool Audio::Initialize() {
 void Audio::Shutdown() {
 	if (!g_initialized) return;
 
+	// Destroying the stream waits for any in-flight callback.
+	if (g_mixStream) {
+		SDL_UnbindAudioStream(g_mixStream);
+		SDL_DestroyAudioStream(g_mixStream);
+		g_mixStream = nullptr;
+	}
+
 	// Close device
 	if (g_device != 0) {
 		SDL_CloseAudioDevice(g_device);
 		g_device = 0;
 	}
 
+	ResetVoices();
+
 	SDL_QuitSubSystem(SDL_INIT_AUDIO);
 	g_initialized = false;
 	LOG_INFO("Audio shutdown.");
@@ -71,6 +405,10 @@ SDL_AudioDeviceID Audio::GetDevice() {
 	return g_device;
 }
 
+const SDL_AudioSpec& Audio::GetMixSpec() {
+	return g_mixSpec;
+}
+
 void Audio::PauseDevice(bool pause) {
 	if (!g_initialized || g_device == 0) return;
 	if (pause) {
@@ -83,10 +421,133 @@ void Audio::PauseDevice(bool pause) {
 
 // Master volume
 void Audio::SetMasterGain(float gain) {
-	g_masterGain = gain;
+	g_masterGain.store(gain, std::memory_order_relaxed);
 }
 
 // Get master volume
 float Audio::GetMasterGain() {
-	return g_masterGain;
+	return g_masterGain.load(std::memory_order_relaxed);
+}
+
+void Audio::Update() {
+	if (!g_initialized) return;
+	FlushOverflow();
+}
+
+// ---------------- Voices ----------------
+
+int Audio::AcquireVoice() {
+	if (!g_initialized || g_freeVoices.empty()) {
+		return kInvalidVoice;
+	}
+	const int voice = g_freeVoices.back();
+	g_freeVoices.pop_back();
+	return voice;
+}
+
+void Audio::ReleaseVoice(int voice) {
+	if (!g_initialized || !IsValidVoice(voice)) return;
+
+	// The stop is queued ahead of any later Play on the same slot, so reuse is safe.
+	StopVoice(voice);
+	g_freeVoices.push_back(voice);
+}
+
+std::uint32_t Audio::PlayVoice(int voice, const AudioClip* clip, bool loop, float gain, float pitch, float pan) {
+	if (!g_initialized || !IsValidVoice(voice) || !clip) return 0;
+
+	if (clip->spec.format != g_mixSpec.format || clip->spec.channels != g_mixSpec.channels || clip->spec.freq != g_mixSpec.freq) {
+		LOG_WARN("AudioClip '" + clip->name + "' is not in the mixer format; ignoring Play.");
+		return 0;
+	}
+
+	std::uint32_t serial = g_nextSerial++;
+	if (serial == 0) {
+		serial = g_nextSerial++;
+	}
+
+	AudioCommand play;
+	play.type = AudioCommand::Type::Play;
+	play.voice = voice;
+	play.serial = serial;
+	play.clip = clip;
+	play.value = gain;
+	play.pitch = pitch;
+	play.pan = std::clamp(pan, -1.0f, 1.0f);
+	play.loop = loop;
+	PostCommand(play);
+	return serial;
+}
+
+void Audio::StopVoice(int voice) {
+	if (!g_initialized || !IsValidVoice(voice)) return;
+	AudioCommand command;
+	command.type = AudioCommand::Type::Stop;
+	command.voice = voice;
+	PostCommand(command);
+}
+
+void Audio::SetVoiceGain(int voice, float gain) {
+	if (!g_initialized || !IsValidVoice(voice)) return;
+	AudioCommand command;
+	command.type = AudioCommand::Type::SetGain;
+	command.voice = voice;
+	command.value = gain;
+	PostCommand(command);
+}
+
+void Audio::SetVoicePitch(int voice, float pitch) {
+	if (!g_initialized || !IsValidVoice(voice)) return;
+	AudioCommand command;
+	command.type = AudioCommand::Type::SetPitch;
+	command.voice = voice;
+	command.value = pitch;
+	PostCommand(command);
+}
+
+void Audio::SetVoicePan(int voice, float pan) {
+	if (!g_initialized || !IsValidVoice(voice)) return;
+	AudioCommand command;
+	command.type = AudioCommand::Type::SetPan;
+	command.voice = voice;
+	command.value = std::clamp(pan, -1.0f, 1.0f);
+	PostCommand(command);
+}
+
+void Audio::SetVoiceLoop(int voice, bool loop) {
+	if (!g_initialized || !IsValidVoice(voice)) return;
+	AudioCommand command;
+	command.type = AudioCommand::Type::SetLoop;
+	command.voice = voice;
+	command.loop = loop;
+	PostCommand(command);
+}
+
+bool Audio::IsVoicePlaying(int voice, std::uint32_t serial) {
+	if (!g_initialized || !IsValidVoice(voice) || serial == 0) return false;
+	return g_finishedSerial[static_cast<size_t>(voice)].load(std::memory_order_acquire) != serial;
+}
+
+void Audio::ForgetClip(const AudioClip* clip) {
+	if (!g_initialized || !clip || !g_mixStream) return;
+
+	// Rare path (clip unload): take the stream lock so the mixer callback cannot run,
+	// apply everything queued so far in order, then drop voices still using the clip.
+	SDL_LockAudioStream(g_mixStream);
+	DrainCommands();
+	while (!g_overflow.empty()) {
+		ApplyCommand(g_overflow.front());
+		g_overflow.pop_front();
+	}
+	for (int v = 0; v < kMaxVoices; ++v) {
+		Voice& voice = g_voices[static_cast<size_t>(v)];
+		if (voice.clip == clip) {
+			FinishVoice(voice, v);
+		}
+	}
+	SDL_UnlockAudioStream(g_mixStream);
+}
+
+std::size_t Audio::GetPendingCommandCount() {
+	return g_overflow.size();
 }
@@ -2,9 +2,16 @@
 
 #include <SDL3/SDL.h>
 
+#include <cstddef>
+#include <cstdint>
 
+struct AudioClip;
 
 namespace Audio {
+	// Maximum number of voices the software mixer can play at once
+	constexpr int kMaxVoices = 64;
+	constexpr int kInvalidVoice = -1;
+
 	// Initializes SDL audio subsystem + opens default playback device
 	bool Initialize();
 
@@ -14,10 +21,45 @@ namespace Audio {
 	bool IsInitialized();
 	SDL_AudioDeviceID GetDevice();
 
+	// Format every clip is converted to before mixing (F32, stereo, 48kHz)
+	const SDL_AudioSpec& GetMixSpec();
+
 	// Device-level pause (affects all bound streams)
 	void PauseDevice(bool pause);
 
 	// Global master gain applied to all AudioSource gain values
 	void SetMasterGain(float gain);
 	float GetMasterGain();
+
+	// Called once per frame on the game thread. Flushes commands that did not
+	// fit into the mixer queue last frame.
+	void Update();
+
+	// --- Voices (game thread) ---
+	// Voice control never touches SDL directly: each call posts a command into a
+	// lock-free queue that the mixer callback drains on the audio thread.
+
+	// Reserves a voice slot. Returns kInvalidVoice if all slots are in use.
+	int AcquireVoice();
+	// Stops and returns a voice slot to the free list.
+	void ReleaseVoice(int voice);
+
+	// Starts playing a clip on a voice. Returns a play serial used by IsVoicePlaying.
+	// pan: -1 = left, 0 = centre, 1 = right.
+	std::uint32_t PlayVoice(int voice, const AudioClip* clip, bool loop, float gain, float pitch, float pan = 0.0f);
+	void StopVoice(int voice);
+	// Gain and pan changes are ramped over a few milliseconds by the mixer.
+	void SetVoiceGain(int voice, float gain);
+	void SetVoicePitch(int voice, float pitch);
+	void SetVoicePan(int voice, float pan);
+	void SetVoiceLoop(int voice, bool loop);
+
+	// True until the mixer reports that the playback started with 'serial' has finished.
+	bool IsVoicePlaying(int voice, std::uint32_t serial);
+
+	// Synchronously stops every voice using this clip. Must be called before a clip is freed.
+	void ForgetClip(const AudioClip* clip);
+
+	// Number of commands waiting on the game thread because the mixer queue was full.
+	std::size_t GetPendingCommandCount();
 }
@@ -0,0 +1,162 @@
+#include "AudioMixKernels.h"
+
+#include <SDL3/SDL.h>
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define AUDIO_MIX_X86 1
+#include <immintrin.h>
+#else
+#define AUDIO_MIX_X86 0
+#endif
+
+// MSVC emits AVX intrinsics regardless of /arch; GCC/Clang need the function to opt in.
+#if AUDIO_MIX_X86 && (defined(__GNUC__) || defined(__clang__))
+#define AUDIO_MIX_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define AUDIO_MIX_TARGET_AVX2
+#endif
+
+namespace {
+	// ---------------- Scalar ----------------
+
+	void MixStereoScalar(float* out, const float* in, int frames, float gainL, float gainR, float stepL, float stepR) {
+		for (int i = 0; i < frames; ++i) {
+			const float f = static_cast<float>(i);
+			out[i * 2] += in[i * 2] * (gainL + stepL * f);
+			out[i * 2 + 1] += in[i * 2 + 1] * (gainR + stepR * f);
+		}
+	}
+
+	void ScaleAndClipScalar(float* buf, int frames, float gain, float step) {
+		for (int i = 0; i < frames; ++i) {
+			const float g = gain + step * static_cast<float>(i);
+			buf[i * 2] = SoftClip(buf[i * 2] * g);
+			buf[i * 2 + 1] = SoftClip(buf[i * 2 + 1] * g);
+		}
+	}
+
+#if AUDIO_MIX_X86
+	// ---------------- SSE2 (2 stereo frames per vector) ----------------
+
+	// SoftClip on four samples: the curve runs on |x| and the sign is put back afterwards.
+	__m128 SoftClipSSE2(__m128 x) {
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 a = _mm_min_ps(_mm_andnot_ps(signMask, x), _mm_set1_ps(kSoftClipLimit));
+		const __m128 e = _mm_max_ps(_mm_sub_ps(a, _mm_set1_ps(kSoftClipKnee)), _mm_setzero_ps());
+		const __m128 y = _mm_sub_ps(a, _mm_mul_ps(_mm_mul_ps(e, e), _mm_set1_ps(kSoftClipCurve)));
+		return _mm_or_ps(y, _mm_and_ps(signMask, x));
+	}
+
+	void MixStereoSSE2(float* out, const float* in, int frames, float gainL, float gainR, float stepL, float stepR) {
+		__m128 g = _mm_setr_ps(gainL, gainR, gainL + stepL, gainR + stepR);
+		const __m128 inc = _mm_setr_ps(stepL * 2.0f, stepR * 2.0f, stepL * 2.0f, stepR * 2.0f);
+
+		int i = 0;
+		for (; i + 2 <= frames; i += 2) {
+			const __m128 x = _mm_loadu_ps(in + i * 2);
+			const __m128 o = _mm_loadu_ps(out + i * 2);
+			_mm_storeu_ps(out + i * 2, _mm_add_ps(o, _mm_mul_ps(x, g)));
+			g = _mm_add_ps(g, inc);
+		}
+
+		const float f = static_cast<float>(i);
+		MixStereoScalar(out + i * 2, in + i * 2, frames - i, gainL + stepL * f, gainR + stepR * f, stepL, stepR);
+	}
+
+	void ScaleAndClipSSE2(float* buf, int frames, float gain, float step) {
+		__m128 g = _mm_setr_ps(gain, gain, gain + step, gain + step);
+		const __m128 inc = _mm_set1_ps(step * 2.0f);
+
+		int i = 0;
+		for (; i + 2 <= frames; i += 2) {
+			const __m128 x = _mm_mul_ps(_mm_loadu_ps(buf + i * 2), g);
+			_mm_storeu_ps(buf + i * 2, SoftClipSSE2(x));
+			g = _mm_add_ps(g, inc);
+		}
+
+		ScaleAndClipScalar(buf + i * 2, frames - i, gain + step * static_cast<float>(i), step);
+	}
+
+	// ---------------- AVX2 (4 stereo frames per vector) ----------------
+
+	AUDIO_MIX_TARGET_AVX2
+	__m256 SoftClipAVX2(__m256 x) {
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+		const __m256 a = _mm256_min_ps(_mm256_andnot_ps(signMask, x), _mm256_set1_ps(kSoftClipLimit));
+		const __m256 e = _mm256_max_ps(_mm256_sub_ps(a, _mm256_set1_ps(kSoftClipKnee)), _mm256_setzero_ps());
+		const __m256 y = _mm256_sub_ps(a, _mm256_mul_ps(_mm256_mul_ps(e, e), _mm256_set1_ps(kSoftClipCurve)));
+		return _mm256_or_ps(y, _mm256_and_ps(signMask, x));
+	}
+
+	AUDIO_MIX_TARGET_AVX2
+	void MixStereoAVX2(float* out, const float* in, int frames, float gainL, float gainR, float stepL, float stepR) {
+		__m256 g = _mm256_setr_ps(
+			gainL, gainR,
+			gainL + stepL, gainR + stepR,
+			gainL + stepL * 2.0f, gainR + stepR * 2.0f,
+			gainL + stepL * 3.0f, gainR + stepR * 3.0f);
+		const __m256 inc = _mm256_setr_ps(
+			stepL * 4.0f, stepR * 4.0f, stepL * 4.0f, stepR * 4.0f,
+			stepL * 4.0f, stepR * 4.0f, stepL * 4.0f, stepR * 4.0f);
+
+		int i = 0;
+		for (; i + 4 <= frames; i += 4) {
+			const __m256 x = _mm256_loadu_ps(in + i * 2);
+			const __m256 o = _mm256_loadu_ps(out + i * 2);
+			_mm256_storeu_ps(out + i * 2, _mm256_add_ps(o, _mm256_mul_ps(x, g)));
+			g = _mm256_add_ps(g, inc);
+		}
+		_mm256_zeroupper();
+
+		const float f = static_cast<float>(i);
+		MixStereoSSE2(out + i * 2, in + i * 2, frames - i, gainL + stepL * f, gainR + stepR * f, stepL, stepR);
+	}
+
+	AUDIO_MIX_TARGET_AVX2
+	void ScaleAndClipAVX2(float* buf, int frames, float gain, float step) {
+		__m256 g = _mm256_setr_ps(
+			gain, gain,
+			gain + step, gain + step,
+			gain + step * 2.0f, gain + step * 2.0f,
+			gain + step * 3.0f, gain + step * 3.0f);
+		const __m256 inc = _mm256_set1_ps(step * 4.0f);
+
+		int i = 0;
+		for (; i + 4 <= frames; i += 4) {
+			const __m256 x = _mm256_mul_ps(_mm256_loadu_ps(buf + i * 2), g);
+			_mm256_storeu_ps(buf + i * 2, SoftClipAVX2(x));
+			g = _mm256_add_ps(g, inc);
+		}
+		_mm256_zeroupper();
+
+		ScaleAndClipSSE2(buf + i * 2, frames - i, gain + step * static_cast<float>(i), step);
+	}
+#endif
+
+	const AudioMixKernels kScalarKernels{ MixStereoScalar, ScaleAndClipScalar, "scalar" };
+#if AUDIO_MIX_X86
+	const AudioMixKernels kSSE2Kernels{ MixStereoSSE2, ScaleAndClipSSE2, "SSE2" };
+	const AudioMixKernels kAVX2Kernels{ MixStereoAVX2, ScaleAndClipAVX2, "AVX2" };
+#endif
+}
+
+float SoftClip(float x) {
+	const float a = std::min(std::abs(x), kSoftClipLimit);
+	const float e = std::max(a - kSoftClipKnee, 0.0f);
+	return std::copysign(a - e * e * kSoftClipCurve, x);
+}
+
+const AudioMixKernels& SelectAudioMixKernels() {
+#if AUDIO_MIX_X86
+	if (SDL_HasAVX2()) {
+		return kAVX2Kernels;
+	}
+	if (SDL_HasSSE2()) {
+		return kSSE2Kernels;
+	}
+#endif
+	return kScalarKernels;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+// Inner loops of the software mixer, operating on interleaved stereo F32 buffers.
+// Each kernel exists in scalar, SSE2 and AVX2 flavours; the best one the CPU supports
+// is picked once by SelectAudioMixKernels() and called through AudioMixKernels.
+struct AudioMixKernels {
+	// out[frame] += in[frame] * gain, where the per-channel gain starts at (gainL, gainR)
+	// and moves by (stepL, stepR) every frame (linear ramp; steps of 0 = constant gain).
+	void (*mixStereo)(float* out, const float* in, int frames, float gainL, float gainR, float stepL, float stepR);
+
+	// buf[frame] = SoftClip(buf[frame] * gain), with gain ramped by 'step' per frame.
+	void (*scaleAndClip)(float* buf, int frames, float gain, float step);
+
+	const char* name;
+};
+
+// Output saturation used by scaleAndClip: unity gain up to |x| = kSoftClipKnee, then a quadratic
+// knee that flattens smoothly (no slope jump) into +-1 at |x| = 2 - kSoftClipKnee and holds there.
+constexpr float kSoftClipKnee = 0.5f;
+constexpr float kSoftClipLimit = 2.0f - kSoftClipKnee;
+constexpr float kSoftClipCurve = 1.0f / (4.0f * (1.0f - kSoftClipKnee));
+
+// Reference (scalar) version of the output curve.
+float SoftClip(float x);
+
+// Returns the fastest kernel set supported by the running CPU (AVX2 > SSE2 > scalar).
+const AudioMixKernels& SelectAudioMixKernels();
@@ -1,10 +1,20 @@
 #include "AudioSource.h"
 
+#include "AssetManager.h"
 #include "Audio.h"
 #include "AudioClip.h"
 #include "Logger.h"
+#include "SleeplessEngine.h"
 
 #include <algorithm>
+#include <string>
+
+namespace {
+	AssetHandle<AudioClip> RetainClip(AudioClip* clip) {
+		AssetManager* assets = SleeplessEngine::GetInstance().GetAssetManager();
+		return assets ? assets->Retain(clip) : AssetHandle<AudioClip>{};
+	}
+}
 
 AudioSource::AudioSource()
 	: MonoBehaviour() {
@@ -12,27 +22,42 @@ AudioSource::AudioSource()
 }
 
 AudioSource::~AudioSource() {
-	DestroyStream();
+	ReleaseVoice();
 }
 
 void AudioSource::SetClip(AudioClip* clip) {
 	if (m_clip == clip) return;
 	m_clip = clip;
+	m_clipHandle = RetainClip(clip);
 	// stop current playback when changing clip.
 	Stop();
 }
 
+void AudioSource::SetLoop(bool loop) {
+	m_loop = loop;
+	if (IsPlaying()) {
+		Audio::SetVoiceLoop(m_voice, m_loop);
+	}
+}
+
 void AudioSource::SetGain(float gain) {
 	m_gain = std::max(0.0f, gain);
-	if (m_stream) {
-		SDL_SetAudioStreamGain(m_stream, m_gain * Audio::GetMasterGain());
+	if (IsPlaying()) {
+		Audio::SetVoiceGain(m_voice, m_gain);
 	}
 }
 
 void AudioSource::SetPitch(float ratio) {
 	m_pitch = std::max(0.01f, ratio);
-	if (m_stream) {
-		SDL_SetAudioStreamFrequencyRatio(m_stream, m_pitch);
+	if (IsPlaying()) {
+		Audio::SetVoicePitch(m_voice, m_pitch);
+	}
+}
+
+void AudioSource::SetPan(float pan) {
+	m_pan = std::clamp(pan, -1.0f, 1.0f);
+	if (IsPlaying()) {
+		Audio::SetVoicePan(m_voice, m_pan);
 	}
 }
 
@@ -45,16 +70,11 @@ void AudioSource::Play() {
 		if (!Audio::IsInitialized()) return;
 	}
 
-	CreateStreamIfNeeded();
-	if (!m_stream) return;
+	AcquireVoiceIfNeeded();
+	if (m_voice == Audio::kInvalidVoice) return;
 
-	SDL_ClearAudioStream(m_stream);
-	// Queue the full clip once to start playback.
-	QueueFullClip();
-	if (!m_loop) {
-		// Tell SDL we're done providing input so it can drain.
-		SDL_FlushAudioStream(m_stream);
-	}
+	// Restarts from the beginning if the voice is already playing.
+	m_playSerial = Audio::PlayVoice(m_voice, m_clip, m_loop, m_gain, m_pitch, m_pan);
 }
 
 void AudioSource::Play(AudioClip* clip, bool loop) {
@@ -64,37 +84,14 @@ void AudioSource::Play(AudioClip* clip, bool loop) {
 }
 
 void AudioSource::Stop() {
-	DestroyStream();
-}
-
-void AudioSource::Update() {
-	
-	// Ensure stream exists if playing.
-	if (!m_stream || !m_clip) return;
-
-	// Looping: re-queue clip when input runs low.
-	if (m_loop) {
-		const int queued = SDL_GetAudioStreamQueued(m_stream);
-		if (queued < 0) {
-			DestroyStream();
-			return;
-		}
-
-		const int clipBytes = (int)m_clip->pcm.size(); // full clip size in bytes
-		const int threshold = std::max(4096, clipBytes / 2); // re-queue when below half or 4KB
-		// Re-queue full clip if below threshold.
-		if (queued < threshold) {
-			QueueFullClip();
-		}
-		return;
+	if (m_voice != Audio::kInvalidVoice && m_playSerial != 0) {
+		Audio::StopVoice(m_voice);
 	}
+	m_playSerial = 0;
+}
 
-	// One-shot: destroy stream once fully drained.
-	const int queued = SDL_GetAudioStreamQueued(m_stream);
-	const int available = SDL_GetAudioStreamAvailable(m_stream);
-	if (queued == 0 && available == 0) {
-		DestroyStream();
-	}
+bool AudioSource::IsPlaying() const {
+	return Audio::IsVoicePlaying(m_voice, m_playSerial);
 }
 
 void AudioSource::OnDisable() {
@@ -103,58 +100,33 @@ void AudioSource::OnDisable() {
 
 void AudioSource::OnDestroy() {
 	Stop();
+	ReleaseVoice();
 }
 
-void AudioSource::CreateStreamIfNeeded() {
-	if (m_stream) return;
-	if (!m_clip) return;
-	if (!Audio::IsInitialized()) return;
+void AudioSource::AcquireVoiceIfNeeded() {
+	if (m_voice != Audio::kInvalidVoice) return;
 
-	const SDL_AudioDeviceID dev = Audio::GetDevice();
-	if (dev == 0) return;
-
-    
-	// Create and bind stream
-	m_stream = SDL_CreateAudioStream(&m_clip->spec, NULL);
-	if (!m_stream) {
-		LOG_ERROR("Failed to create audio stream: " + std::string(SDL_GetError()));
-		return;
-	}
-	// Bind to device
-	if (!SDL_BindAudioStream(dev, m_stream)) {
-		LOG_ERROR("Failed to bind audio stream: " + std::string(SDL_GetError()));
-		SDL_DestroyAudioStream(m_stream);
-		m_stream = nullptr;
-		return;
+	m_voice = Audio::AcquireVoice();
+	if (m_voice == Audio::kInvalidVoice) {
+		LOG_WARN("AudioSource: no free mixer voice (max " + std::to_string(Audio::kMaxVoices) + ")");
 	}
-
-	SDL_SetAudioStreamGain(m_stream, m_gain * Audio::GetMasterGain());
-	SDL_SetAudioStreamFrequencyRatio(m_stream, m_pitch);
-}
-
-void AudioSource::DestroyStream() {
-	if (!m_stream) return;
-	SDL_UnbindAudioStream(m_stream);
-	SDL_DestroyAudioStream(m_stream);
-	m_stream = nullptr;
 }
 
-void AudioSource::QueueFullClip() {
-	if (!m_stream || !m_clip) return;
-	if (m_clip->pcm.empty()) return;
-
-	if (!SDL_PutAudioStreamData(m_stream, m_clip->pcm.data(), (int)m_clip->pcm.size())) {
-		LOG_ERROR("SDL_PutAudioStreamData failed: " + std::string(SDL_GetError()));
-		DestroyStream();
-	}
+void AudioSource::ReleaseVoice() {
+	if (m_voice == Audio::kInvalidVoice) return;
+	Audio::ReleaseVoice(m_voice);
+	m_voice = Audio::kInvalidVoice;
+	m_playSerial = 0;
 }
 
 std::shared_ptr<Component> AudioSource::Clone() const {
 	auto c = std::make_shared<AudioSource>();
 	c->m_clip = m_clip;
+	c->m_clipHandle = m_clipHandle;
 	c->m_loop = m_loop;
 	c->m_gain = m_gain;
 	c->m_pitch = m_pitch;
-	// Runtime stream is not cloned.
+	c->m_pan = m_pan;
+	// Runtime voice is not cloned.
 	return c;
 }
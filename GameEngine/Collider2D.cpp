@@ -47,6 +47,35 @@ void Collider2D::SetTrigger(bool isTrigger) {
 	RecreateShape();
 }
 
+void Collider2D::SetLayer(int layer) {
+	if (!CollisionLayerMatrix::IsValidLayer(layer)) {
+		THROW_ENGINE_EXCEPTION("Collision layer ") << layer << " is out of range";
+	}
+	if (m_layer == layer) {
+		return;
+	}
+	m_layer = layer;
+	RefreshFilter();
+}
+
+void Collider2D::SetLayer(std::string_view layerName) {
+	auto* physicsWorld = SleeplessEngine::GetInstance().GetPhysicsWorld();
+	const int layer = physicsWorld ? physicsWorld->GetCollisionLayers().GetLayer(layerName) : -1;
+	if (layer < 0) {
+		THROW_ENGINE_EXCEPTION("Unknown collision layer '") << std::string(layerName) << "'";
+	}
+	SetLayer(layer);
+}
+
+void Collider2D::RefreshFilter() {
+	if (!b2Shape_IsValid(m_shapeId)) {
+		return;
+	}
+	if (auto* physicsWorld = SleeplessEngine::GetInstance().GetPhysicsWorld()) {
+		b2Shape_SetFilter(m_shapeId, physicsWorld->MakeFilter(m_layer));
+	}
+}
+
 void Collider2D::RebuildShape() {
 	RecreateShape();
 }
@@ -108,7 +137,8 @@ void Collider2D::DestroyImmediateInternal() {
 void Collider2D::RecreateShape() {
 	// If we're about to replace/destroy the current shape, it can invalidate contacts
 	// without Box2D emitting End events. Clear cached pairs so Stay doesn't get stuck.
-	if (auto* physicsWorld = SleeplessEngine::GetInstance().GetPhysicsWorld()) {
+	auto* physicsWorld = SleeplessEngine::GetInstance().GetPhysicsWorld();
+	if (physicsWorld) {
 		physicsWorld->ClearContactCacheFor(this);
 	}
 
@@ -127,6 +157,17 @@ void Collider2D::RecreateShape() {
 	}
 
 	b2ShapeDef shapeDef = BuildShapeDef();
+
+	// A body recycled from the pool may still carry a parked shape we can take over.
+	m_shapeId = physicsWorld ? physicsWorld->AcquireShape(bodyId, shapeDef) : b2_nullShapeId;
+	if (b2Shape_IsValid(m_shapeId)) {
+		SetShapeGeometry(m_shapeId);
+		if (shapeDef.updateBodyMass) {
+			b2Body_ApplyMassFromShapes(bodyId);
+		}
+		return;
+	}
+
 	m_shapeId = CreateShape(bodyId, shapeDef);
 }
 
@@ -141,6 +182,9 @@ b2ShapeDef Collider2D::BuildShapeDef() const {
 	shapeDef.enableSensorEvents = m_shouldSensorEvent;
 	shapeDef.enableContactEvents = !m_isTrigger;
 	shapeDef.updateBodyMass = true;
+	if (auto* physicsWorld = SleeplessEngine::GetInstance().GetPhysicsWorld()) {
+		shapeDef.filter = physicsWorld->MakeFilter(m_layer);
+	}
 
 	return shapeDef;
 }
@@ -170,19 +214,29 @@ std::shared_ptr<Component> BoxCollider2D::Clone() const {
 	clone->m_friction = m_friction;
 	clone->m_restitution = m_restitution;
 	clone->m_isTrigger = m_isTrigger;
+	clone->m_layer = m_layer;
 	clone->m_size = m_size;
 	clone->SetComponentName(GetComponentName());
 	return clone;
 }
 
 b2ShapeId BoxCollider2D::CreateShape(b2BodyId bodyId, const b2ShapeDef& shapeDef) {
-	b2Polygon box = b2MakeOffsetBox(
+	const b2Polygon box = MakeBox();
+	return b2CreatePolygonShape(bodyId, &shapeDef, &box);
+}
+
+void BoxCollider2D::SetShapeGeometry(b2ShapeId shapeId) {
+	const b2Polygon box = MakeBox();
+	b2Shape_SetPolygon(shapeId, &box);
+}
+
+b2Polygon BoxCollider2D::MakeBox() const {
+	return b2MakeOffsetBox(
 		m_size.x * 0.5f,
 		m_size.y * 0.5f,
 		{ m_offset.x, m_offset.y },
 		b2MakeRot(0.0f)
 	);
-	return b2CreatePolygonShape(bodyId, &shapeDef, &box);
 }
 
 void CircleCollider2D::SetRadius(float radius) {
@@ -197,14 +251,25 @@ std::shared_ptr<Component> CircleCollider2D::Clone() const {
 	clone->m_friction = m_friction;
 	clone->m_restitution = m_restitution;
 	clone->m_isTrigger = m_isTrigger;
+	clone->m_layer = m_layer;
 	clone->m_radius = m_radius;
 	clone->SetComponentName(GetComponentName());
 	return clone;
 }
 
 b2ShapeId CircleCollider2D::CreateShape(b2BodyId bodyId, const b2ShapeDef& shapeDef) {
+	const b2Circle circle = MakeCircle();
+	return b2CreateCircleShape(bodyId, &shapeDef, &circle);
+}
+
+void CircleCollider2D::SetShapeGeometry(b2ShapeId shapeId) {
+	const b2Circle circle = MakeCircle();
+	b2Shape_SetCircle(shapeId, &circle);
+}
+
+b2Circle CircleCollider2D::MakeCircle() const {
 	b2Circle circle{};
 	circle.center = { m_offset.x, m_offset.y };
 	circle.radius = m_radius;
-	return b2CreateCircleShape(bodyId, &shapeDef, &circle);
+	return circle;
 }
@@ -0,0 +1,146 @@
+#include "ContactCache.h"
+
+#include <algorithm>
+
+namespace {
+	// Collider ids are small and dense, so mix the bits before masking.
+	size_t HashKey(std::uint64_t key) {
+		key ^= key >> 33;
+		key *= 0xff51afd7ed558ccdull;
+		key ^= key >> 33;
+		return static_cast<size_t>(key);
+	}
+}
+
+bool ContactCache::Insert(std::uint32_t idA, Collider2D* a, std::uint32_t idB, Collider2D* b) {
+	if (idA == kInvalidId || idB == kInvalidId || idA == idB) {
+		return false;
+	}
+
+	// Keep the table at most half full so probe chains stay short.
+	if ((m_pairs.size() + 1) * 2 > m_slotKeys.size()) {
+		Grow();
+	}
+
+	const std::uint64_t key = MakeKey(idA, idB);
+	const size_t slot = FindSlot(key);
+	if (m_slotKeys[slot] == key) {
+		return false;
+	}
+
+	m_slotKeys[slot] = key;
+	m_slotPairs[slot] = static_cast<std::uint32_t>(m_pairs.size());
+	m_pairs.push_back(idA < idB ? Pair{ a, b } : Pair{ b, a });
+	m_pairKeys.push_back(key);
+	AddPartner(idA, idB);
+	AddPartner(idB, idA);
+	return true;
+}
+
+bool ContactCache::Erase(std::uint32_t idA, std::uint32_t idB) {
+	if (m_pairs.empty() || idA == kInvalidId || idB == kInvalidId) {
+		return false;
+	}
+
+	const size_t slot = FindSlot(MakeKey(idA, idB));
+	if (m_slotKeys[slot] == kEmptyKey) {
+		return false;
+	}
+
+	EraseSlot(slot);
+	RemovePartner(idA, idB);
+	RemovePartner(idB, idA);
+	return true;
+}
+
+void ContactCache::EraseAll(std::uint32_t id) {
+	if (id >= m_partners.size()) {
+		return;
+	}
+
+	auto& partners = m_partners[id];
+	while (!partners.empty()) {
+		Erase(id, partners.back());
+	}
+}
+
+void ContactCache::Clear() {
+	std::fill(m_slotKeys.begin(), m_slotKeys.end(), kEmptyKey);
+	m_pairs.clear();
+	m_pairKeys.clear();
+	// Keep each list's capacity for the next scene.
+	for (auto& partners : m_partners) {
+		partners.clear();
+	}
+}
+
+size_t ContactCache::FindSlot(std::uint64_t key) const {
+	const size_t mask = m_slotKeys.size() - 1;
+	size_t slot = HashKey(key) & mask;
+	while (m_slotKeys[slot] != kEmptyKey && m_slotKeys[slot] != key) {
+		slot = (slot + 1) & mask;
+	}
+	return slot;
+}
+
+void ContactCache::Grow() {
+	const size_t newSize = std::max<size_t>(64, m_slotKeys.size() * 2);
+	m_slotKeys.assign(newSize, kEmptyKey);
+	m_slotPairs.assign(newSize, 0);
+
+	for (size_t i = 0; i < m_pairKeys.size(); ++i) {
+		const size_t slot = FindSlot(m_pairKeys[i]);
+		m_slotKeys[slot] = m_pairKeys[i];
+		m_slotPairs[slot] = static_cast<std::uint32_t>(i);
+	}
+}
+
+void ContactCache::EraseSlot(size_t slot) {
+	// Swap-remove from the dense arrays and repoint the moved pair's slot.
+	const size_t index = m_slotPairs[slot];
+	const size_t last = m_pairs.size() - 1;
+	if (index != last) {
+		m_pairs[index] = m_pairs[last];
+		m_pairKeys[index] = m_pairKeys[last];
+		m_slotPairs[FindSlot(m_pairKeys[index])] = static_cast<std::uint32_t>(index);
+	}
+	m_pairs.pop_back();
+	m_pairKeys.pop_back();
+
+	// Backward-shift deletion: pull later entries of the probe chain into the hole
+	// when the hole lies between their home slot and where they sit now.
+	const size_t mask = m_slotKeys.size() - 1;
+	size_t hole = slot;
+	for (size_t i = (slot + 1) & mask; m_slotKeys[i] != kEmptyKey; i = (i + 1) & mask) {
+		const size_t home = HashKey(m_slotKeys[i]) & mask;
+		if (((i - home) & mask) >= ((i - hole) & mask)) {
+			m_slotKeys[hole] = m_slotKeys[i];
+			m_slotPairs[hole] = m_slotPairs[i];
+			hole = i;
+		}
+	}
+	m_slotKeys[hole] = kEmptyKey;
+}
+
+void ContactCache::AddPartner(std::uint32_t id, std::uint32_t partner) {
+	if (id >= m_partners.size()) {
+		m_partners.resize(static_cast<size_t>(id) + 1);
+	}
+	m_partners[id].push_back(partner);
+}
+
+void ContactCache::RemovePartner(std::uint32_t id, std::uint32_t partner) {
+	if (id >= m_partners.size()) {
+		return;
+	}
+
+	// EraseAll removes from the back, so search from there.
+	auto& partners = m_partners[id];
+	for (size_t i = partners.size(); i-- > 0; ) {
+		if (partners[i] == partner) {
+			partners[i] = partners.back();
+			partners.pop_back();
+			return;
+		}
+	}
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string_view>
 #include <vector>
 
 // Engine headers
@@ -10,9 +11,11 @@
 #include "AudioSource.h"
 #include "BitmapFont.h"
 #include "Collider2D.h"
+#include "CollisionLayers.h"
 #include "Component.h"
 #include "GameObject.h"
 #include "Input.h"
+#include "JobSystem.h"
 #include "MonoBehaviour.h"
 #include "ObjectPool.h"
 #include "Renderer.h"
@@ -41,97 +44,129 @@
 #include "UIPanel.h"
 
 //asset loading shortcuts
-inline Texture* LoadTexture(const std::string& relativePath) {
+inline Texture* LoadTexture(std::string_view relativePath) {
 	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
 	return assetManager ? assetManager->LoadTexture(relativePath) : nullptr;
 }
 
-inline Texture* LoadTexture(const std::string& relativePath, const Vector3i& colorKey) {
+inline Texture* LoadTexture(std::string_view relativePath, const Vector3i& colorKey) {
 	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
 	return assetManager ? assetManager->LoadTexture(relativePath, colorKey) : nullptr;
 }
 
 // SpriteSheet loading shortcuts
-inline SpriteSheet* LoadSpriteSheet(const std::string& textureRelativePath, const Vector2i& frameSize) {
+inline SpriteSheet* LoadSpriteSheet(std::string_view textureRelativePath, const Vector2i& frameSize) {
 	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
 	return assetManager ? assetManager->LoadSpriteSheet(textureRelativePath, frameSize) : nullptr;
 }
 
-inline SpriteSheet* LoadSpriteSheet(const std::string& textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey) {
+inline SpriteSheet* LoadSpriteSheet(std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey) {
 	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
 	return assetManager ? assetManager->LoadSpriteSheet(textureRelativePath, frameSize, colorKey) : nullptr;
 }
 
 
-inline SpriteSheet* LoadSpriteSheet(const std::string& textureRelativePath, const Vector2i& frameSize, TextureScaleMode textureScaleModeOverride) {
+inline SpriteSheet* LoadSpriteSheet(std::string_view textureRelativePath, const Vector2i& frameSize, TextureScaleMode textureScaleModeOverride) {
 	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
 	return assetManager ? assetManager->LoadSpriteSheet(textureRelativePath, frameSize, textureScaleModeOverride) : nullptr;
 }
 
-inline SpriteSheet* LoadSpriteSheet(const std::string& textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride) {
+inline SpriteSheet* LoadSpriteSheet(std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride) {
 	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
 	return assetManager ? assetManager->LoadSpriteSheet(textureRelativePath, frameSize, colorKey, textureScaleModeOverride) : nullptr;
 }
 
-inline SpriteSheet* LoadSpriteSheet(const std::string& sheetKey, const std::string& textureRelativePath, const Vector2i& frameSize) {
+inline SpriteSheet* LoadSpriteSheet(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize) {
 	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
 	return assetManager ? assetManager->LoadSpriteSheet(sheetKey, textureRelativePath, frameSize) : nullptr;
 }
 
-inline SpriteSheet* LoadSpriteSheet(const std::string& sheetKey, const std::string& textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey) {
+inline SpriteSheet* LoadSpriteSheet(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey) {
 	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
 	return assetManager ? assetManager->LoadSpriteSheet(sheetKey, textureRelativePath, frameSize, colorKey) : nullptr;
 }
 
 
-inline SpriteSheet* LoadSpriteSheet(const std::string& sheetKey, const std::string& textureRelativePath, const Vector2i& frameSize, TextureScaleMode textureScaleModeOverride) {
+inline SpriteSheet* LoadSpriteSheet(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize, TextureScaleMode textureScaleModeOverride) {
 	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
 	return assetManager ? assetManager->LoadSpriteSheet(sheetKey, textureRelativePath, frameSize, textureScaleModeOverride) : nullptr;
 }
 
-inline SpriteSheet* LoadSpriteSheet(const std::string& sheetKey, const std::string& textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride) {
+inline SpriteSheet* LoadSpriteSheet(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride) {
 	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
 	return assetManager ? assetManager->LoadSpriteSheet(sheetKey, textureRelativePath, frameSize, colorKey, textureScaleModeOverride) : nullptr;
 }
 
 // Bitmap font shortcuts 
-inline BitmapFont* LoadBitmapFont(const std::string& textureRelativePath, const Vector2i& glyphSize, unsigned char firstChar = 32) {
+inline BitmapFont* LoadBitmapFont(std::string_view textureRelativePath, const Vector2i& glyphSize, unsigned char firstChar = 32) {
 	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
 	return assetManager ? assetManager->LoadFont(textureRelativePath, glyphSize, firstChar) : nullptr;
 }
 
 // Keyed bitmap font shortcuts
-inline BitmapFont* LoadBitmapFont(const std::string& fontKey, const std::string& textureRelativePath, const Vector2i& glyphSize, unsigned char firstChar = 32) {
+inline BitmapFont* LoadBitmapFont(std::string_view fontKey, std::string_view textureRelativePath, const Vector2i& glyphSize, unsigned char firstChar = 32) {
 	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
 	return assetManager ? assetManager->LoadFont(fontKey, textureRelativePath, glyphSize, firstChar) : nullptr;
 }
 
-inline BitmapFont* LoadBitmapFont(const std::string& textureRelativePath, const Vector2i& glyphSize, const Vector3i& colorKey, unsigned char firstChar = 32) {
+inline BitmapFont* LoadBitmapFont(std::string_view textureRelativePath, const Vector2i& glyphSize, const Vector3i& colorKey, unsigned char firstChar = 32) {
 	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
 	return assetManager ? assetManager->LoadFont(textureRelativePath, glyphSize, colorKey, firstChar) : nullptr;
 }
 
-inline BitmapFont* LoadBitmapFont(const std::string& fontKey, const std::string& textureRelativePath, const Vector2i& glyphSize, const Vector3i& colorKey, unsigned char firstChar = 32) {
+inline BitmapFont* LoadBitmapFont(std::string_view fontKey, std::string_view textureRelativePath, const Vector2i& glyphSize, const Vector3i& colorKey, unsigned char firstChar = 32) {
 	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
 	return assetManager ? assetManager->LoadFont(fontKey, textureRelativePath, glyphSize, colorKey, firstChar) : nullptr;
 }
 
-inline BitmapFont* LoadBitmapFont(const std::string& textureRelativePath, const Vector2i& glyphSize, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride, unsigned char firstChar = 32) {
+inline BitmapFont* LoadBitmapFont(std::string_view textureRelativePath, const Vector2i& glyphSize, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride, unsigned char firstChar = 32) {
 	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
 	return assetManager ? assetManager->LoadFont(textureRelativePath, glyphSize, firstChar, colorKey, textureScaleModeOverride) : nullptr;
 }
 
-inline BitmapFont* LoadBitmapFont(const std::string& fontKey, const std::string& textureRelativePath, const Vector2i& glyphSize, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride, unsigned char firstChar = 32) {
+inline BitmapFont* LoadBitmapFont(std::string_view fontKey, std::string_view textureRelativePath, const Vector2i& glyphSize, const Vector3i& colorKey, TextureScaleMode textureScaleModeOverride, unsigned char firstChar = 32) {
 	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
 	return assetManager ? assetManager->LoadFont(fontKey, textureRelativePath, glyphSize, firstChar, colorKey, textureScaleModeOverride) : nullptr;
 }
 
 // Audio clip shortcut
-inline AudioClip* LoadAudioClip(const std::string& relativePath) {
+inline AudioClip* LoadAudioClip(std::string_view relativePath) {
 	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
 	return assetManager ? assetManager->LoadAudioClip(relativePath) : nullptr;
 }
 
+// Keeps a loaded asset from being evicted by the memory budget while the handle lives
+// (see AssetManager::Retain). Empty if the engine has no AssetManager.
+template<typename T>
+inline AssetHandle<T> RetainAsset(T* asset) {
+	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
+	return assetManager ? assetManager->Retain(asset) : AssetHandle<T>{};
+}
+
+// Shared single-state animation for a sprite sheet (see AnimationLibrary::GetSheetController).
+inline std::shared_ptr<const AnimatorController> GetSheetController(SpriteSheet* sheet, float fps, bool loop = true,
+	std::string_view stateName = "Loop", int firstFrame = 0, int frameCount = AnimationLibrary::kAllFrames) {
+	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
+	return assetManager ? assetManager->GetAnimationLibrary().GetSheetController(sheet, fps, loop, stateName, firstFrame, frameCount) : nullptr;
+}
+
+// Async loading shortcuts (results become ready during AssetManager::Update).
+// The returned future is invalid (valid() == false) if the engine has no AssetManager.
+inline std::shared_future<Texture*> LoadTextureAsync(std::string_view relativePath, const Vector3i& colorKey) {
+	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
+	return assetManager ? assetManager->LoadTextureAsync(relativePath, colorKey) : std::shared_future<Texture*>{};
+}
+
+inline std::shared_future<SpriteSheet*> LoadSpriteSheetAsync(std::string_view sheetKey, std::string_view textureRelativePath, const Vector2i& frameSize, const Vector3i& colorKey) {
+	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
+	return assetManager ? assetManager->LoadSpriteSheetAsync(sheetKey, textureRelativePath, frameSize, colorKey) : std::shared_future<SpriteSheet*>{};
+}
+
+inline std::shared_future<AudioClip*> LoadAudioClipAsync(std::string_view relativePath) {
+	auto* assetManager = SleeplessEngine::GetInstance().GetAssetManager();
+	return assetManager ? assetManager->LoadAudioClipAsync(relativePath) : std::shared_future<AudioClip*>{};
+}
+
 
 
 // Input shortcuts
@@ -1,6 +1,7 @@
 #pragma once
 
 class Scene;
+class AssetManifest;
 
 // Per-scene rule container (spawning rules, win/lose conditions, scoring, etc.)
 // A Scene always owns exactly one GameMode. If a Scene is created without explicitly
@@ -13,6 +14,9 @@ public:
 	// Called when the GameMode is attached to a Scene
 	virtual void OnAttach(Scene& scene) { (void)scene; }
 
+	// Called before OnStart to add the mode's assets to the Scene's preload manifest
+	virtual void OnDeclareAssets(AssetManifest& manifest) { (void)manifest; }
+
 	// Called when the Scene starts running
 	virtual void OnStart() {}
 
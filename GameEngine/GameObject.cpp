@@ -47,6 +47,33 @@ size_t GameObject::GetComponentIndex(const Component* component) const {
 	return 0;
 }
 
+const std::vector<std::shared_ptr<MonoBehaviour>>& GameObject::GetPhysicsListeners() {
+	RefreshPhysicsListeners();
+	return m_physicsListeners;
+}
+
+bool GameObject::HasPhysicsListener(std::uint8_t callbacks) {
+	RefreshPhysicsListeners();
+	return (m_physicsListenerMask & callbacks) != 0;
+}
+
+void GameObject::RefreshPhysicsListeners() {
+	if (!m_physicsListenersDirty) {
+		return;
+	}
+
+	m_physicsListenersDirty = false;
+	m_physicsListeners.clear();
+	m_physicsListenerMask = 0;
+	for (const auto& component : m_components) {
+		auto behaviour = std::dynamic_pointer_cast<MonoBehaviour>(component);
+		if (behaviour && behaviour->GetPhysicsCallbacks() != 0) {
+			m_physicsListenerMask |= behaviour->GetPhysicsCallbacks();
+			m_physicsListeners.push_back(std::move(behaviour));
+		}
+	}
+}
+
 std::shared_ptr<Component> GameObject::GetComponentByName(const std::string& componentName) const {
 	for (const auto& component : m_components) {
 		if (!component) continue;
@@ -156,6 +183,10 @@ void GameObject::UpdateActiveInHierarchy() {
 void GameObject::HandleActivationChange(bool wasActive) {
 	const bool isActiveNow = m_activeInHierarchy;
 
+	if (auto rigidbody = GetComponent<Rigidbody2D>()) {
+		rigidbody->RefreshSimulation();
+	}
+
 	// If we're turning off, send OnDisable to behaviours that had been enabled.
 	if (!isActiveNow) {
 		for (const auto& component : m_components) {
@@ -200,6 +231,7 @@ void GameObject::RegisterComponent(const std::shared_ptr<Component>& component)
 	}
 
 	m_components.push_back(component);
+	m_physicsListenersDirty = true;
 	Object::RegisterObject(component);
 
 	// If this is a renderable component, register it in the RenderSystem so
@@ -227,6 +259,7 @@ void GameObject::UnregisterComponent(const std::shared_ptr<Component>& component
 	auto it = std::find(m_components.begin(), m_components.end(), component);
 	if (it != m_components.end()) {
 		m_components.erase(it);
+		m_physicsListenersDirty = true;
 	}
 }
 
@@ -237,6 +270,7 @@ void GameObject::RemoveComponent(const Component* component) {
 	auto it = std::remove_if(m_components.begin(), m_components.end(),
 		[component](const std::shared_ptr<Component>& entry) { return entry.get() == component; });
 	m_components.erase(it, m_components.end());
+	m_physicsListenersDirty = true;
 }
 
 void GameObject::DestroyImmediateInternal() {
@@ -263,6 +297,9 @@ void GameObject::DestroyImmediateInternal() {
 		Object::UnregisterObject(component->GetInstanceID());
 	}
 	m_components.clear();
+	m_physicsListeners.clear();
+	m_physicsListenerMask = 0;
+	m_physicsListenersDirty = false;
 
 	// Detach from parent.
 	if (m_transform && m_transform->GetParent()) {
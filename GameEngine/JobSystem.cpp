@@ -0,0 +1,77 @@
+#include "JobSystem.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <exception>
+#include <string>
+
+namespace {
+	thread_local int t_workerIndex = -1;
+}
+
+JobSystem::JobSystem(int workerCount) {
+	if (workerCount <= 0) {
+		const int hw = static_cast<int>(std::thread::hardware_concurrency());
+		workerCount = std::max(1, hw - 1);
+	}
+
+	m_workers.reserve(static_cast<size_t>(workerCount));
+	for (int i = 0; i < workerCount; ++i) {
+		m_workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+	}
+	LOG_INFO("JobSystem started with " + std::to_string(workerCount) + " worker(s)");
+}
+
+JobSystem::~JobSystem() {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+		m_jobs.clear();
+		m_highJobs.clear();
+	}
+	m_wake.notify_all();
+
+	for (auto& worker : m_workers) {
+		if (worker.joinable()) {
+			worker.join();
+		}
+	}
+}
+
+void JobSystem::Submit(std::function<void()> job, Priority priority) {
+	if (!job) return;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		(priority == Priority::High ? m_highJobs : m_jobs).push_back(std::move(job));
+	}
+	m_wake.notify_one();
+}
+
+int JobSystem::GetCurrentWorkerIndex() {
+	return t_workerIndex;
+}
+
+void JobSystem::WorkerLoop(int workerIndex) {
+	t_workerIndex = workerIndex;
+	for (;;) {
+		std::function<void()> job;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wake.wait(lock, [this] { return m_stopping || !m_highJobs.empty() || !m_jobs.empty(); });
+			if (m_stopping) {
+				return;
+			}
+			auto& queue = m_highJobs.empty() ? m_jobs : m_highJobs;
+			job = std::move(queue.front());
+			queue.pop_front();
+		}
+
+		// A throwing job must not take the worker (and the process) down with it.
+		try {
+			job();
+		}
+		catch (const std::exception& e) {
+			LOG_ERROR(std::string("Unhandled exception in job: ") + e.what());
+		}
+	}
+}
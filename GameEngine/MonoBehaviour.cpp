@@ -291,6 +291,25 @@ void MonoBehaviour::OnEnabledStateChanged(bool enabled) {
 
 // Lifecycle triggers
 
+void MonoBehaviour::SetPhysicsCallbacks(std::uint8_t callbacks) {
+	m_physicsCallbacksDeclared = true;
+	m_physicsCallbacks = static_cast<std::uint8_t>(callbacks & kAllPhysicsCallbacks);
+	if (auto* gameObject = GetGameObject()) {
+		gameObject->m_physicsListenersDirty = true;
+	}
+}
+
+void MonoBehaviour::IgnorePhysicsCallback(PhysicsCallbackFlags callback) {
+	if (m_physicsCallbacksDeclared || !(m_physicsCallbacks & callback)) {
+		return;
+	}
+
+	m_physicsCallbacks &= static_cast<std::uint8_t>(~callback);
+	if (auto* gameObject = GetGameObject()) {
+		gameObject->m_physicsListenersDirty = true;
+	}
+}
+
 void MonoBehaviour::TriggerAwake() {
 	if (m_didAwake) return;
 	m_didAwake = true;
@@ -14,6 +14,17 @@ class MonoBehaviour : public Behaviour {
 public:
 	using InvokeHandle = std::uint64_t;
 
+	// Physics callbacks a behaviour can implement (see GetPhysicsCallbacks).
+	enum PhysicsCallbackFlags : std::uint8_t {
+		kCollisionEnter = 1 << 0,
+		kCollisionStay = 1 << 1,
+		kCollisionExit = 1 << 2,
+		kTriggerEnter = 1 << 3,
+		kTriggerStay = 1 << 4,
+		kTriggerExit = 1 << 5,
+		kAllPhysicsCallbacks = 0x3F
+	};
+
 	// Controls when an invoke advances time.
 	enum class InvokeTickPolicy : std::uint8_t {
 		WhileGameObjectActive,   // Advances while the GameObject is active in hierarchy
@@ -31,6 +42,11 @@ public:
 	bool DidAwake() const { return m_didAwake; }
 	// Returns true if Start has been called
 	bool DidStart() const { return m_didStart; }
+	// Physics callbacks this behaviour overrides. Starts with all of them; each empty base
+	// version clears its flag the first time it runs, after which Physics2DWorld stops calling it.
+	// An override that calls the base version would clear its own flag that way, so such a
+	// behaviour must declare its callbacks with SetPhysicsCallbacks instead.
+	std::uint8_t GetPhysicsCallbacks() const { return m_physicsCallbacks; }
 
 	
 
@@ -127,17 +143,22 @@ protected:
 	virtual void OnDestroy() {}
 
 	// Called when a collision begins
-	virtual void OnCollisionEnter(Collider2D* other) {}
+	virtual void OnCollisionEnter(Collider2D* other) { IgnorePhysicsCallback(kCollisionEnter); }
 	// Called while a collision continues
-	virtual void OnCollisionStay(Collider2D* other) {}
+	virtual void OnCollisionStay(Collider2D* other) { IgnorePhysicsCallback(kCollisionStay); }
 	// Called when a collision ends
-	virtual void OnCollisionExit(Collider2D* other) {}
+	virtual void OnCollisionExit(Collider2D* other) { IgnorePhysicsCallback(kCollisionExit); }
 	// Called when a trigger begins
-	virtual void OnTriggerEnter(Collider2D* other) {}
+	virtual void OnTriggerEnter(Collider2D* other) { IgnorePhysicsCallback(kTriggerEnter); }
 	// Called while a trigger continues
-	virtual void OnTriggerStay(Collider2D* other) {}
+	virtual void OnTriggerStay(Collider2D* other) { IgnorePhysicsCallback(kTriggerStay); }
 	// Called when a trigger ends
-	virtual void OnTriggerExit(Collider2D* other) {}
+	virtual void OnTriggerExit(Collider2D* other) { IgnorePhysicsCallback(kTriggerExit); }
+
+	// Declares exactly which physics callbacks this behaviour implements (PhysicsCallbackFlags) and
+	// turns off the detection above, so calling a base OnCollision* / OnTrigger* no longer disables
+	// anything. Call it from the constructor or Awake.
+	void SetPhysicsCallbacks(std::uint8_t callbacks);
 
 	// Receives a string invoke call
 	virtual void ReceiveMessage(const std::string& methodName);
@@ -182,6 +203,9 @@ private:
 		float pausedRemaining = 0.0f;
 	};
 
+	// Records that a physics callback is not overridden and refreshes the owner's listener cache
+	void IgnorePhysicsCallback(PhysicsCallbackFlags callback);
+
 	// Runs Awake if needed
 	void TriggerAwake();
 
@@ -220,6 +244,10 @@ private:
 	bool m_hasEverBeenActive = false;
 	// Whether destroy callbacks have been sent
 	bool m_destroyCallbacksSent = false;
+	// PhysicsCallbackFlags this behaviour is still assumed to implement
+	std::uint8_t m_physicsCallbacks = kAllPhysicsCallbacks;
+	// Set by SetPhysicsCallbacks; the base callbacks stop clearing flags
+	bool m_physicsCallbacksDeclared = false;
 
 	std::vector<InvokeRequest> m_invokes; // Scheduled invokes
 	std::unordered_map<std::string, std::function<void()>> m_invokeHandlers; // Named invoke handlers
@@ -1,11 +1,24 @@
 #include "Physics2D.h"
 #include "Collider2D.h"
 #include "GameObject.h"
+#include "JobSystem.h"
+#include "Logger.h"
 #include "MonoBehaviour.h"
 #include "Renderer.h"
 #include "Rigidbody2D.h"
 #include "Transform.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+namespace {
+	// Box2D's compile-time limit on b2WorldDef::workerCount.
+	constexpr int kMaxBox2DWorkers = 64;
+}
+
 Physics2DWorld::~Physics2DWorld() {
 	Shutdown();
 }
@@ -17,9 +30,154 @@ void Physics2DWorld::Initialize(const Vector2f& gravity) {
 
 	b2WorldDef worldDef = b2DefaultWorldDef();
 	worldDef.gravity = { gravity.x, gravity.y };
+
+	// Box2D worker 0 is the main thread; job worker i runs as Box2D worker i + 1.
+	m_workerCount = 1;
+	const int jobWorkers = m_jobSystem ? m_jobSystem->GetWorkerCount() : 0;
+	if (jobWorkers + 1 > kMaxBox2DWorkers) {
+		LOG_WARN("Physics2DWorld: " + std::to_string(jobWorkers) + " job workers exceed Box2D's limit, solving on the main thread");
+	}
+	else if (jobWorkers > 0) {
+		m_workerCount = jobWorkers + 1;
+		worldDef.workerCount = m_workerCount;
+		worldDef.enqueueTask = &Physics2DWorld::EnqueueTask;
+		worldDef.finishTask = &Physics2DWorld::FinishTask;
+		worldDef.userTaskContext = this;
+	}
+
 	m_worldId = b2CreateWorld(&worldDef);
 }
 
+bool Physics2DWorld::CheckJobSystemDeterminism(JobSystem& jobs, int steps) {
+	if (jobs.GetWorkerCount() + 1 > kMaxBox2DWorkers) {
+		return true;
+	}
+
+	// Only the task callbacks' state is used; both worlds are created here, not by Initialize.
+	Physics2DWorld threaded;
+	threaded.m_jobSystem = &jobs;
+	threaded.m_workerCount = jobs.GetWorkerCount() + 1;
+
+	b2WorldDef serialDef = b2DefaultWorldDef();
+	b2WorldDef threadedDef = serialDef;
+	threadedDef.workerCount = threaded.m_workerCount;
+	threadedDef.enqueueTask = &Physics2DWorld::EnqueueTask;
+	threadedDef.finishTask = &Physics2DWorld::FinishTask;
+	threadedDef.userTaskContext = &threaded;
+
+	const std::array<b2WorldId, 2> worlds = { b2CreateWorld(&serialDef), b2CreateWorld(&threadedDef) };
+	std::array<std::vector<b2BodyId>, 2> bodies;
+	for (size_t w = 0; w < worlds.size(); w++) {
+		b2BodyDef groundDef = b2DefaultBodyDef();
+		const b2BodyId ground = b2CreateBody(worlds[w], &groundDef);
+		const b2Polygon groundBox = b2MakeOffsetBox(40.0f, 1.0f, { 0.0f, -1.0f }, b2Rot_identity);
+		b2ShapeDef groundShape = b2DefaultShapeDef();
+		b2CreatePolygonShape(ground, &groundShape, &groundBox);
+
+		// Columns of boxes and circles, enough contacts to split every solver stage into chunks
+		for (int column = 0; column < 16; column++) {
+			for (int row = 0; row < 16; row++) {
+				b2BodyDef bodyDef = b2DefaultBodyDef();
+				bodyDef.type = b2_dynamicBody;
+				bodyDef.position = { -30.0f + 4.0f * column + 0.1f * row, 0.5f + 1.05f * row };
+				const b2BodyId body = b2CreateBody(worlds[w], &bodyDef);
+				b2ShapeDef shapeDef = b2DefaultShapeDef();
+				if ((column + row) % 3 == 0) {
+					const b2Circle circle = { { 0.0f, 0.0f }, 0.5f };
+					b2CreateCircleShape(body, &shapeDef, &circle);
+				}
+				else {
+					const b2Polygon box = b2MakeBox(0.5f, 0.5f);
+					b2CreatePolygonShape(body, &shapeDef, &box);
+				}
+				bodies[w].push_back(body);
+			}
+		}
+	}
+
+	for (int step = 0; step < steps; step++) {
+		b2World_Step(worlds[0], 1.0f / 60.0f, 4);
+		threaded.m_taskCount = 0;
+		b2World_Step(worlds[1], 1.0f / 60.0f, 4);
+	}
+
+	bool identical = true;
+	for (size_t i = 0; i < bodies[0].size() && identical; i++) {
+		const b2Transform a = b2Body_GetTransform(bodies[0][i]);
+		const b2Transform b = b2Body_GetTransform(bodies[1][i]);
+		identical = std::memcmp(&a, &b, sizeof(b2Transform)) == 0;
+	}
+
+	for (const b2WorldId world : worlds) {
+		b2DestroyWorld(world);
+	}
+	return identical;
+}
+
+void* Physics2DWorld::EnqueueTask(b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext) {
+	auto* world = static_cast<Physics2DWorld*>(userContext);
+	JobSystem* jobs = world->m_jobSystem;
+	if (itemCount <= 0) {
+		return nullptr;
+	}
+
+	// Single-item tasks always go to the pool: the solver enqueues one long-running task per
+	// worker and they spin on each other, so running one inline here would deadlock.
+	if (itemCount == 1) {
+		Box2DTask* userTask = world->AcquireTask(1);
+		jobs->Submit([task, taskContext, userTask] {
+			task(0, 1, static_cast<uint32_t>(JobSystem::GetCurrentWorkerIndex() + 1), taskContext);
+			CompleteChunk(*userTask);
+		}, JobSystem::Priority::High);
+		return userTask;
+	}
+
+	// Parallel-fors keep the last chunk for the calling thread (Box2D worker 0) instead of
+	// blocking in FinishTask while the workers do everything.
+	const int wanted = std::clamp(itemCount / std::max(minRange, 1), 1, world->m_workerCount);
+	const int chunkSize = (itemCount + wanted - 1) / wanted;
+	const int chunkCount = (itemCount + chunkSize - 1) / chunkSize;
+	const int inlineBegin = (chunkCount - 1) * chunkSize;
+	if (chunkCount == 1) {
+		task(0, itemCount, 0, taskContext);
+		return nullptr;
+	}
+
+	Box2DTask* userTask = world->AcquireTask(chunkCount - 1);
+	for (int begin = 0; begin < inlineBegin; begin += chunkSize) {
+		const int end = begin + chunkSize;
+		jobs->Submit([task, taskContext, userTask, begin, end] {
+			task(begin, end, static_cast<uint32_t>(JobSystem::GetCurrentWorkerIndex() + 1), taskContext);
+			CompleteChunk(*userTask);
+		}, JobSystem::Priority::High);
+	}
+	task(inlineBegin, itemCount, 0, taskContext);
+	return userTask;
+}
+
+Physics2DWorld::Box2DTask* Physics2DWorld::AcquireTask(int pending) {
+	if (m_taskCount == m_tasks.size()) {
+		m_tasks.push_back(std::make_unique<Box2DTask>());
+	}
+	Box2DTask* userTask = m_tasks[m_taskCount++].get();
+	userTask->pending.store(pending, std::memory_order_relaxed);
+	return userTask;
+}
+
+void Physics2DWorld::CompleteChunk(Box2DTask& userTask) {
+	if (userTask.pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+		userTask.pending.notify_one();
+	}
+}
+
+void Physics2DWorld::FinishTask(void* userTask, void* userContext) {
+	(void)userContext;
+	auto* task = static_cast<Box2DTask*>(userTask);
+	for (int pending = task->pending.load(std::memory_order_acquire); pending != 0; pending = task->pending.load(std::memory_order_acquire)) {
+		task->pending.wait(pending, std::memory_order_acquire);
+	}
+}
+
 void Physics2DWorld::Reset(const Vector2f& gravity) {
 	auto bodies = m_registeredBodies;
 	auto colliders = m_registeredColliders;
@@ -46,10 +204,18 @@ void Physics2DWorld::Shutdown() {
 		return;
 	}
 
-	m_activeCollisions.clear();
-	m_activeTriggers.clear();
+	m_activeCollisions.Clear();
+	m_activeTriggers.Clear();
 	m_registeredBodies.clear();
+	m_interpolatedBodies.clear();
 	m_registeredColliders.clear();
+	// Colliders keep their old id; GetContactId no longer matches it.
+	m_collidersByContactId.clear();
+	m_freeContactIds.clear();
+	m_syncedBodyCount = 0;
+	// Parked bodies go down with the world.
+	m_bodyPool.clear();
+	m_releasedBodies.clear();
 	b2DestroyWorld(m_worldId);
 	m_worldId = b2_nullWorldId;
 }
@@ -61,31 +227,142 @@ Collider2D* ResolveColliderFromShape(b2ShapeId shapeId) {
 	return static_cast<Collider2D*>(b2Shape_GetUserData(shapeId));
 }
 
+namespace {
+	b2QueryFilter MakeQueryFilter(std::uint64_t layerMask) {
+		// Report every shape on a requested layer, whatever that shape's own mask says.
+		b2QueryFilter filter = b2DefaultQueryFilter();
+		filter.categoryBits = CollisionLayerMatrix::kEveryLayer;
+		filter.maskBits = layerMask;
+		return filter;
+	}
+
+	struct OverlapCollector {
+		std::span<Collider2D*> results;
+		int count = 0;
+	};
+
+	bool CollectOverlap(b2ShapeId shapeId, void* context) {
+		auto* collector = static_cast<OverlapCollector*>(context);
+		if (Collider2D* collider = ResolveColliderFromShape(shapeId)) {
+			collector->results[static_cast<size_t>(collector->count++)] = collider;
+		}
+		return collector->count < static_cast<int>(collector->results.size());
+	}
+
+	struct RayCollector {
+		std::span<RaycastHit2D> results;
+		int count = 0;
+	};
+
+	float CollectRayHit(b2ShapeId shapeId, b2Vec2 point, b2Vec2 normal, float fraction, void* context) {
+		auto* collector = static_cast<RayCollector*>(context);
+		Collider2D* collider = ResolveColliderFromShape(shapeId);
+		if (!collider) {
+			return -1.0f; // ignore this shape
+		}
+
+		collector->results[static_cast<size_t>(collector->count++)] = { collider, Vector2f(point.x, point.y), Vector2f(normal.x, normal.y), fraction };
+		// 1 keeps the full ray so every hit is reported; 0 stops once the buffer is full.
+		return collector->count < static_cast<int>(collector->results.size()) ? 1.0f : 0.0f;
+	}
+
+	struct NearestSearch {
+		b2Vec2 point{};
+		const Collider2D* ignore = nullptr;
+		Collider2D* best = nullptr;
+		float bestDistanceSq = 0.0f;
+	};
+
+	bool VisitNearest(b2ShapeId shapeId, void* context) {
+		auto* search = static_cast<NearestSearch*>(context);
+		Collider2D* collider = ResolveColliderFromShape(shapeId);
+		if (!collider || collider == search->ignore) {
+			return true;
+		}
+
+		const b2Vec2 closest = b2Shape_GetClosestPoint(shapeId, search->point);
+		const float distanceSq = b2DistanceSquared(closest, search->point);
+		if (!search->best || distanceSq < search->bestDistanceSq) {
+			search->best = collider;
+			search->bestDistanceSq = distanceSq;
+		}
+		return true;
+	}
+}
+
 using CollisionCallback = void (MonoBehaviour::*)(Collider2D* other);
 
-void DispatchCollisionEvent(Collider2D* collider, Collider2D* other, CollisionCallback callback) {
+// Calls 'callback' on the behaviours of collider's GameObject that implement it. Uses the
+// GameObject's cached listener list, so nothing is allocated per event.
+void DispatchCollisionEvent(Collider2D* collider, Collider2D* other, CollisionCallback callback, MonoBehaviour::PhysicsCallbackFlags flag) {
 	if (!collider) {
 		return;
 	}
 
 	auto* gameObject = collider->GetGameObject();
-	if (!gameObject) {
+	if (!gameObject || !gameObject->HasPhysicsListener(flag)) {
 		return;
 	}
 
-	auto behaviours = gameObject->GetComponents<MonoBehaviour>();
-	for (const auto& behaviour : behaviours) {
-		if (behaviour && behaviour->IsActiveAndEnabled()) {
+	// Indexed: a callback may add or remove components, which only marks the list for a rebuild.
+	// The list and the local copy keep each behaviour alive while it runs, even if it is removed.
+	const auto& listeners = gameObject->GetPhysicsListeners();
+	for (size_t i = 0; i < listeners.size(); ++i) {
+		const std::shared_ptr<MonoBehaviour> behaviour = listeners[i];
+		if ((behaviour->GetPhysicsCallbacks() & flag) && !behaviour->IsMarkedForDestruction() && behaviour->IsActiveAndEnabled()) {
 			((*behaviour).*callback)(other);
 		}
 	}
 }
 
+// True if either side of a pair has a behaviour implementing the callback.
+bool HasPairListener(Collider2D* a, Collider2D* b, MonoBehaviour::PhysicsCallbackFlags flag) {
+	GameObject* objectA = a ? a->GetGameObject() : nullptr;
+	GameObject* objectB = b ? b->GetGameObject() : nullptr;
+	return (objectA && objectA->HasPhysicsListener(flag)) || (objectB && objectB->HasPhysicsListener(flag));
+}
+
+void Physics2DWorld::SetSubStepRange(int minSubSteps, int maxSubSteps, float contactsPerBodyForMax) {
+	m_minSubSteps = std::max(1, minSubSteps);
+	m_maxSubSteps = std::max(m_minSubSteps, maxSubSteps);
+	m_contactsPerBodyForMaxSubSteps = std::max(0.0f, contactsPerBodyForMax);
+}
+
+int Physics2DWorld::ChooseSubStepCount() const {
+	if (!IsValid() || m_maxSubSteps == m_minSubSteps) {
+		return m_minSubSteps;
+	}
+
+	const int awakeBodies = b2World_GetAwakeBodyCount(m_worldId);
+	if (awakeBodies <= 0) {
+		return m_minSubSteps;
+	}
+
+	// Substeps mostly buy contact stiffness, so scale with how crowded the awake bodies are.
+	const b2Counters counters = b2World_GetCounters(m_worldId);
+	const float contactsPerBody = static_cast<float>(counters.contactCount) / static_cast<float>(awakeBodies);
+	const float t = m_contactsPerBodyForMaxSubSteps > 0.0f
+		? std::min(contactsPerBody / m_contactsPerBodyForMaxSubSteps, 1.0f)
+		: 1.0f;
+	return m_minSubSteps + static_cast<int>(std::lround(t * static_cast<float>(m_maxSubSteps - m_minSubSteps)));
+}
+
 void Physics2DWorld::Step(float timeStep, int subStepCount) {
 	if (!IsValid()) {
 		return;
 	}
 
+	for (size_t i = 0; i < m_interpolatedBodies.size(); ++i) {
+		m_interpolatedBodies[i]->BeginInterpolationStep();
+	}
+
+	// Bodies released from here on (e.g. by a callback below) can still be named by the next
+	// step's end events, so only the ones released before this step are handed back to the pool.
+	const size_t releasedBeforeStep = m_releasedBodies.size();
+
+	// Box2D finishes every task it enqueued before b2World_Step returns.
+	m_taskCount = 0;
+	m_lastSubStepCount = subStepCount;
 	b2World_Step(m_worldId, timeStep, subStepCount);
 
 	const b2ContactEvents contactEvents = b2World_GetContactEvents(m_worldId);
@@ -93,11 +370,11 @@ void Physics2DWorld::Step(float timeStep, int subStepCount) {
 		const auto& event = contactEvents.beginEvents[i];
 		Collider2D* colliderA = ResolveColliderFromShape(event.shapeIdA);
 		Collider2D* colliderB = ResolveColliderFromShape(event.shapeIdB);
-		DispatchCollisionEvent(colliderA, colliderB, &MonoBehaviour::InternalOnCollisionEnter);
-		DispatchCollisionEvent(colliderB, colliderA, &MonoBehaviour::InternalOnCollisionEnter);
+		DispatchCollisionEvent(colliderA, colliderB, &MonoBehaviour::InternalOnCollisionEnter, MonoBehaviour::kCollisionEnter);
+		DispatchCollisionEvent(colliderB, colliderA, &MonoBehaviour::InternalOnCollisionEnter, MonoBehaviour::kCollisionEnter);
 
 		if (colliderA && colliderB) {
-			m_activeCollisions.insert(MakePair(colliderA, colliderB));
+			m_activeCollisions.Insert(GetContactId(colliderA), colliderA, GetContactId(colliderB), colliderB);
 		}
 	}
 
@@ -105,11 +382,11 @@ void Physics2DWorld::Step(float timeStep, int subStepCount) {
 		const auto& event = contactEvents.endEvents[i];
 		Collider2D* colliderA = ResolveColliderFromShape(event.shapeIdA);
 		Collider2D* colliderB = ResolveColliderFromShape(event.shapeIdB);
-		DispatchCollisionEvent(colliderA, colliderB, &MonoBehaviour::InternalOnCollisionExit);
-		DispatchCollisionEvent(colliderB, colliderA, &MonoBehaviour::InternalOnCollisionExit);
+		DispatchCollisionEvent(colliderA, colliderB, &MonoBehaviour::InternalOnCollisionExit, MonoBehaviour::kCollisionExit);
+		DispatchCollisionEvent(colliderB, colliderA, &MonoBehaviour::InternalOnCollisionExit, MonoBehaviour::kCollisionExit);
 
 		if (colliderA && colliderB) {
-			m_activeCollisions.erase(MakePair(colliderA, colliderB));
+			m_activeCollisions.Erase(GetContactId(colliderA), GetContactId(colliderB));
 		}
 	}
 
@@ -118,11 +395,11 @@ void Physics2DWorld::Step(float timeStep, int subStepCount) {
 		const auto& event = sensorEvents.beginEvents[i];
 		Collider2D* sensor = ResolveColliderFromShape(event.sensorShapeId);
 		Collider2D* visitor = ResolveColliderFromShape(event.visitorShapeId);
-		DispatchCollisionEvent(sensor, visitor, &MonoBehaviour::InternalOnTriggerEnter);
-		DispatchCollisionEvent(visitor, sensor, &MonoBehaviour::InternalOnTriggerEnter);
+		DispatchCollisionEvent(sensor, visitor, &MonoBehaviour::InternalOnTriggerEnter, MonoBehaviour::kTriggerEnter);
+		DispatchCollisionEvent(visitor, sensor, &MonoBehaviour::InternalOnTriggerEnter, MonoBehaviour::kTriggerEnter);
 
 		if (sensor && visitor) {
-			m_activeTriggers.insert(MakePair(sensor, visitor));
+			m_activeTriggers.Insert(GetContactId(sensor), sensor, GetContactId(visitor), visitor);
 		}
 	}
 
@@ -130,31 +407,153 @@ void Physics2DWorld::Step(float timeStep, int subStepCount) {
 		const auto& event = sensorEvents.endEvents[i];
 		Collider2D* sensor = ResolveColliderFromShape(event.sensorShapeId);
 		Collider2D* visitor = ResolveColliderFromShape(event.visitorShapeId);
-		DispatchCollisionEvent(sensor, visitor, &MonoBehaviour::InternalOnTriggerExit);
-		DispatchCollisionEvent(visitor, sensor, &MonoBehaviour::InternalOnTriggerExit);
+		DispatchCollisionEvent(sensor, visitor, &MonoBehaviour::InternalOnTriggerExit, MonoBehaviour::kTriggerExit);
+		DispatchCollisionEvent(visitor, sensor, &MonoBehaviour::InternalOnTriggerExit, MonoBehaviour::kTriggerExit);
 
 		if (sensor && visitor) {
-			m_activeTriggers.erase(MakePair(sensor, visitor));
+			m_activeTriggers.Erase(GetContactId(sensor), GetContactId(visitor));
 		}
 	}
 
 	// "Stay" is not provided by Box2D 3's event API, so we synthesize it.
 	// Anything still present in our active sets after processing Begin/End is considered "staying".
-	for (const auto& p : m_activeCollisions) {
-		DispatchCollisionEvent(p.a, p.b, &MonoBehaviour::InternalOnCollisionStay);
-		DispatchCollisionEvent(p.b, p.a, &MonoBehaviour::InternalOnCollisionStay);
+	// Pairs where neither side implements Stay are skipped outright.
+	// Indexed loops with a copied pair: a callback may drop pairs (swap-remove), which at worst
+	// skips one Stay this step instead of invalidating the iteration.
+	const auto& collisions = m_activeCollisions.GetPairs();
+	for (size_t i = 0; i < collisions.size(); ++i) {
+		const ContactCache::Pair p = collisions[i];
+		if (!HasPairListener(p.a, p.b, MonoBehaviour::kCollisionStay)) continue;
+		DispatchCollisionEvent(p.a, p.b, &MonoBehaviour::InternalOnCollisionStay, MonoBehaviour::kCollisionStay);
+		DispatchCollisionEvent(p.b, p.a, &MonoBehaviour::InternalOnCollisionStay, MonoBehaviour::kCollisionStay);
 	}
 
-	for (const auto& p : m_activeTriggers) {
-		DispatchCollisionEvent(p.a, p.b, &MonoBehaviour::InternalOnTriggerStay);
-		DispatchCollisionEvent(p.b, p.a, &MonoBehaviour::InternalOnTriggerStay);
+	const auto& triggers = m_activeTriggers.GetPairs();
+	for (size_t i = 0; i < triggers.size(); ++i) {
+		const ContactCache::Pair p = triggers[i];
+		if (!HasPairListener(p.a, p.b, MonoBehaviour::kTriggerStay)) continue;
+		DispatchCollisionEvent(p.a, p.b, &MonoBehaviour::InternalOnTriggerStay, MonoBehaviour::kTriggerStay);
+		DispatchCollisionEvent(p.b, p.a, &MonoBehaviour::InternalOnTriggerStay, MonoBehaviour::kTriggerStay);
 	}
 
-	for (auto* body : m_registeredBodies) {
+	// Only bodies the solver actually moved are written back; static, sleeping and
+	// resting bodies produce no move event. The event already carries the new pose.
+	m_syncedBodyCount = 0;
+	b2BodyEvents bodyEvents = b2World_GetBodyEvents(m_worldId);
+	for (int i = 0; i < bodyEvents.moveCount; ++i) {
+		const b2BodyMoveEvent& moveEvent = bodyEvents.moveEvents[i];
+		// A contact callback above may have destroyed the body or released it to the pool
+		// (which clears its user data), so the event's copy of the user data can be stale.
+		if (!b2Body_IsValid(moveEvent.bodyId) || b2Body_GetUserData(moveEvent.bodyId) != moveEvent.userData) {
+			continue;
+		}
+
+		auto* body = static_cast<Rigidbody2D*>(moveEvent.userData);
 		if (body) {
-			body->SyncTransformFromBody();
+			body->SyncTransformFromBody(moveEvent.transform);
+			++m_syncedBodyCount;
 		}
 	}
+
+	for (size_t i = 0; i < m_interpolatedBodies.size(); ++i) {
+		m_interpolatedBodies[i]->EndInterpolationStep();
+	}
+
+	// This step's events were the last that could name shapes on bodies released before it.
+	const auto released = m_releasedBodies.begin() + static_cast<std::ptrdiff_t>(releasedBeforeStep);
+	m_bodyPool.insert(m_bodyPool.end(), m_releasedBodies.begin(), released);
+	m_releasedBodies.erase(m_releasedBodies.begin(), released);
+}
+
+void Physics2DWorld::Interpolate(float alpha) {
+	for (auto* body : m_interpolatedBodies) {
+		body->ApplyInterpolation(alpha);
+	}
+}
+
+void Physics2DWorld::RestoreSimulatedPoses() {
+	for (auto* body : m_interpolatedBodies) {
+		body->RestoreSimulatedPose();
+	}
+}
+
+int Physics2DWorld::OverlapAABB(const Vector2f& min, const Vector2f& max, std::span<Collider2D*> results, std::uint64_t layerMask) const {
+	if (!IsValid() || results.empty()) {
+		return 0;
+	}
+
+	b2AABB aabb{ { min.x, min.y }, { max.x, max.y } };
+	OverlapCollector collector{ results };
+	b2World_OverlapAABB(m_worldId, aabb, MakeQueryFilter(layerMask), &CollectOverlap, &collector);
+	return collector.count;
+}
+
+int Physics2DWorld::OverlapCircle(const Vector2f& center, float radius, std::span<Collider2D*> results, std::uint64_t layerMask) const {
+	if (!IsValid() || results.empty()) {
+		return 0;
+	}
+
+	const b2Vec2 point{ center.x, center.y };
+	const b2ShapeProxy proxy = b2MakeProxy(&point, 1, radius);
+	OverlapCollector collector{ results };
+	b2World_OverlapShape(m_worldId, &proxy, MakeQueryFilter(layerMask), &CollectOverlap, &collector);
+	return collector.count;
+}
+
+int Physics2DWorld::OverlapBox(const Vector2f& center, const Vector2f& size, float angleDegrees, std::span<Collider2D*> results, std::uint64_t layerMask) const {
+	if (!IsValid() || results.empty()) {
+		return 0;
+	}
+
+	const b2Polygon box = b2MakeOffsetBox(size.x * 0.5f, size.y * 0.5f, { center.x, center.y },
+		b2MakeRot(angleDegrees * Math::Constants<float>::Deg2Rad));
+	const b2ShapeProxy proxy = b2MakeProxy(box.vertices, box.count, 0.0f);
+	OverlapCollector collector{ results };
+	b2World_OverlapShape(m_worldId, &proxy, MakeQueryFilter(layerMask), &CollectOverlap, &collector);
+	return collector.count;
+}
+
+bool Physics2DWorld::Raycast(const Vector2f& origin, const Vector2f& translation, RaycastHit2D& hit, std::uint64_t layerMask) const {
+	if (!IsValid()) {
+		return false;
+	}
+
+	const b2RayResult result = b2World_CastRayClosest(m_worldId, { origin.x, origin.y }, { translation.x, translation.y }, MakeQueryFilter(layerMask));
+	Collider2D* collider = result.hit ? ResolveColliderFromShape(result.shapeId) : nullptr;
+	if (!collider) {
+		return false;
+	}
+
+	hit = { collider, Vector2f(result.point.x, result.point.y), Vector2f(result.normal.x, result.normal.y), result.fraction };
+	return true;
+}
+
+int Physics2DWorld::RaycastAll(const Vector2f& origin, const Vector2f& translation, std::span<RaycastHit2D> results, std::uint64_t layerMask) const {
+	if (!IsValid() || results.empty()) {
+		return 0;
+	}
+
+	RayCollector collector{ results };
+	b2World_CastRay(m_worldId, { origin.x, origin.y }, { translation.x, translation.y }, MakeQueryFilter(layerMask), &CollectRayHit, &collector);
+
+	// Box2D reports hits in tree order.
+	std::sort(results.begin(), results.begin() + collector.count,
+		[](const RaycastHit2D& a, const RaycastHit2D& b) { return a.fraction < b.fraction; });
+	return collector.count;
+}
+
+Collider2D* Physics2DWorld::FindNearest(const Vector2f& point, float radius, std::uint64_t layerMask, const Collider2D* ignore) const {
+	if (!IsValid() || radius <= 0.0f) {
+		return nullptr;
+	}
+
+	NearestSearch search;
+	search.point = { point.x, point.y };
+	search.ignore = ignore;
+
+	const b2ShapeProxy proxy = b2MakeProxy(&search.point, 1, radius);
+	b2World_OverlapShape(m_worldId, &proxy, MakeQueryFilter(layerMask), &VisitNearest, &search);
+	return search.best;
 }
 
 void Physics2DWorld::SetGravity(const Vector2f& gravity) {
@@ -174,6 +573,143 @@ Vector2f Physics2DWorld::GetGravity() const {
 	return Vector2f(gravity.x, gravity.y);
 }
 
+void Physics2DWorld::SetCollisionLayers(const CollisionLayerMatrix& layers) {
+	m_collisionLayers = layers;
+	for (auto* collider : m_registeredColliders) {
+		if (collider) {
+			collider->RefreshFilter();
+		}
+	}
+}
+
+b2Filter Physics2DWorld::MakeFilter(int layer) const {
+	b2Filter filter = b2DefaultFilter();
+	filter.categoryBits = CollisionLayerMatrix::GetCategoryBits(layer);
+	filter.maskBits = m_collisionLayers.GetMaskBits(layer);
+	return filter;
+}
+
+b2BodyId Physics2DWorld::AcquireBody(const b2BodyDef& def) {
+	if (!IsValid()) {
+		return b2_nullBodyId;
+	}
+
+	if (m_bodyPool.empty()) {
+		++m_poolStats.bodyMisses;
+		return b2CreateBody(m_worldId, &def);
+	}
+
+	++m_poolStats.bodyHits;
+	const b2BodyId bodyId = m_bodyPool.back();
+	m_bodyPool.pop_back();
+
+	// Enable first so the proxies exist before the transform moves them.
+	b2Body_Enable(bodyId);
+	b2Body_SetType(bodyId, def.type);
+	b2Body_SetTransform(bodyId, def.position, def.rotation);
+	b2Body_SetLinearVelocity(bodyId, def.linearVelocity);
+	b2Body_SetAngularVelocity(bodyId, def.angularVelocity);
+	b2Body_SetLinearDamping(bodyId, def.linearDamping);
+	b2Body_SetAngularDamping(bodyId, def.angularDamping);
+	b2Body_SetGravityScale(bodyId, def.gravityScale);
+	b2Body_SetMotionLocks(bodyId, def.motionLocks);
+	b2Body_SetBullet(bodyId, def.isBullet);
+	b2Body_EnableSleep(bodyId, def.enableSleep);
+	b2Body_SetUserData(bodyId, def.userData);
+	b2Body_SetAwake(bodyId, def.isAwake);
+	// Parked shapes have no density, so this gives the mass of an empty body until colliders claim them.
+	b2Body_ApplyMassFromShapes(bodyId);
+	if (!def.isEnabled) {
+		b2Body_Disable(bodyId);
+	}
+	return bodyId;
+}
+
+void Physics2DWorld::ReleaseBody(b2BodyId bodyId) {
+	if (!IsValid() || !b2Body_IsValid(bodyId)) {
+		return;
+	}
+
+	GatherShapes(bodyId);
+	for (const b2ShapeId shapeId : m_shapeScratch) {
+		if (auto* collider = static_cast<Collider2D*>(b2Shape_GetUserData(shapeId))) {
+			ClearContactCacheFor(collider);
+			collider->m_shapeId = b2_nullShapeId;
+		}
+	}
+
+	if (GetPooledBodyCount() >= m_bodyPoolCapacity) {
+		b2DestroyBody(bodyId);
+		return;
+	}
+
+	// Park the shapes while they still have proxies, then take the body out of the simulation.
+	for (const b2ShapeId shapeId : m_shapeScratch) {
+		ParkShape(shapeId);
+	}
+	b2Body_SetUserData(bodyId, nullptr);
+	b2Body_Disable(bodyId);
+	m_releasedBodies.push_back(bodyId);
+}
+
+b2ShapeId Physics2DWorld::AcquireShape(b2BodyId bodyId, const b2ShapeDef& def) {
+	if (!IsValid() || !b2Body_IsValid(bodyId)) {
+		return b2_nullShapeId;
+	}
+
+	// Only bodies that came from the pool carry parked shapes; a body has a handful of shapes.
+	GatherShapes(bodyId);
+	for (const b2ShapeId shapeId : m_shapeScratch) {
+		// Box2D cannot turn a sensor into a solid shape or back.
+		if (b2Shape_GetUserData(shapeId) != nullptr || b2Shape_IsSensor(shapeId) != def.isSensor) {
+			continue;
+		}
+
+		++m_poolStats.shapeHits;
+		b2Shape_SetUserData(shapeId, def.userData);
+		b2Shape_SetDensity(shapeId, def.density, false);
+		b2Shape_SetFriction(shapeId, def.material.friction);
+		b2Shape_SetRestitution(shapeId, def.material.restitution);
+		b2Shape_EnableContactEvents(shapeId, def.enableContactEvents);
+		b2Shape_EnableSensorEvents(shapeId, def.enableSensorEvents);
+		b2Shape_SetFilter(shapeId, def.filter);
+		return shapeId;
+	}
+
+	++m_poolStats.shapeMisses;
+	return b2_nullShapeId;
+}
+
+void Physics2DWorld::SetBodyPoolCapacity(int capacity) {
+	m_bodyPoolCapacity = std::max(0, capacity);
+	while (!m_bodyPool.empty() && GetPooledBodyCount() > m_bodyPoolCapacity) {
+		if (IsValid()) {
+			b2DestroyBody(m_bodyPool.back());
+		}
+		m_bodyPool.pop_back();
+	}
+}
+
+void Physics2DWorld::ParkShape(b2ShapeId shapeId) {
+	// No category or mask bits: no contacts, no sensor overlaps, invisible to queries.
+	b2Filter filter = b2DefaultFilter();
+	filter.categoryBits = 0;
+	filter.maskBits = 0;
+
+	b2Shape_SetUserData(shapeId, nullptr);
+	b2Shape_EnableContactEvents(shapeId, false);
+	b2Shape_EnableSensorEvents(shapeId, false);
+	b2Shape_SetDensity(shapeId, 0.0f, false);
+	b2Shape_SetFilter(shapeId, filter);
+}
+
+void Physics2DWorld::GatherShapes(b2BodyId bodyId) {
+	m_shapeScratch.resize(static_cast<size_t>(b2Body_GetShapeCount(bodyId)));
+	if (!m_shapeScratch.empty()) {
+		b2Body_GetShapes(bodyId, m_shapeScratch.data(), static_cast<int>(m_shapeScratch.size()));
+	}
+}
+
 void Physics2DWorld::RegisterBody(Rigidbody2D* body) {
 	if (!body) {
 		return;
@@ -188,11 +724,41 @@ void Physics2DWorld::UnregisterBody(Rigidbody2D* body) {
 	m_registeredBodies.erase(body);
 }
 
+void Physics2DWorld::RegisterInterpolatedBody(Rigidbody2D* body) {
+	if (!body) {
+		return;
+	}
+	if (std::find(m_interpolatedBodies.begin(), m_interpolatedBodies.end(), body) == m_interpolatedBodies.end()) {
+		m_interpolatedBodies.push_back(body);
+	}
+}
+
+void Physics2DWorld::UnregisterInterpolatedBody(Rigidbody2D* body) {
+	auto it = std::find(m_interpolatedBodies.begin(), m_interpolatedBodies.end(), body);
+	if (it != m_interpolatedBodies.end()) {
+		*it = m_interpolatedBodies.back();
+		m_interpolatedBodies.pop_back();
+	}
+}
+
 void Physics2DWorld::RegisterCollider(Collider2D* collider) {
 	if (!collider) {
 		return;
 	}
 	m_registeredColliders.insert(collider);
+
+	if (GetContactId(collider) != ContactCache::kInvalidId) {
+		return;
+	}
+	if (!m_freeContactIds.empty()) {
+		collider->m_contactId = m_freeContactIds.back();
+		m_freeContactIds.pop_back();
+		m_collidersByContactId[collider->m_contactId] = collider;
+	}
+	else {
+		collider->m_contactId = static_cast<std::uint32_t>(m_collidersByContactId.size());
+		m_collidersByContactId.push_back(collider);
+	}
 }
 
 void Physics2DWorld::UnregisterCollider(Collider2D* collider) {
@@ -201,33 +767,59 @@ void Physics2DWorld::UnregisterCollider(Collider2D* collider) {
 	}
 	ClearContactCacheFor(collider);
 	m_registeredColliders.erase(collider);
+
+	const std::uint32_t id = GetContactId(collider);
+	if (id != ContactCache::kInvalidId) {
+		m_collidersByContactId[id] = nullptr;
+		m_freeContactIds.push_back(id);
+		collider->m_contactId = ContactCache::kInvalidId;
+	}
 }
 
 void Physics2DWorld::ClearContactCacheFor(Collider2D* collider) {
-	if (!collider) {
+	const std::uint32_t id = GetContactId(collider);
+	if (id == ContactCache::kInvalidId) {
 		return;
 	}
 
-	for (auto it = m_activeCollisions.begin(); it != m_activeCollisions.end(); ) {
-		if (it->a == collider || it->b == collider) {
-			it = m_activeCollisions.erase(it);
-		}
-		else {
-			++it;
-		}
+	m_activeCollisions.EraseAll(id);
+	m_activeTriggers.EraseAll(id);
+}
+
+std::uint32_t Physics2DWorld::GetContactId(const Collider2D* collider) const {
+	if (!collider) {
+		return ContactCache::kInvalidId;
 	}
 
-	for (auto it = m_activeTriggers.begin(); it != m_activeTriggers.end(); ) {
-		if (it->a == collider || it->b == collider) {
-			it = m_activeTriggers.erase(it);
-		}
-		else {
-			++it;
-		}
+	// Ids left over from before a Reset, or already handed to another collider, fail the check.
+	const std::uint32_t id = collider->m_contactId;
+	if (id < m_collidersByContactId.size() && m_collidersByContactId[id] == collider) {
+		return id;
+	}
+	return ContactCache::kInvalidId;
+}
+
+namespace {
+	constexpr int kDebugCircleSegments = 32;
+
+	// Unit circle points, computed once; circles are scaled and offset copies of it.
+	const std::array<Vector2f, kDebugCircleSegments>& GetUnitCircle() {
+		static const std::array<Vector2f, kDebugCircleSegments> points = [] {
+			std::array<Vector2f, kDebugCircleSegments> table{};
+			for (int i = 0; i < kDebugCircleSegments; ++i) {
+				const float angle = Math::Constants<float>::TwoPi * static_cast<float>(i) / static_cast<float>(kDebugCircleSegments);
+				table[static_cast<size_t>(i)] = Vector2f(std::cos(angle), std::sin(angle));
+			}
+			return table;
+		}();
+		return points;
 	}
 }
 
 void Physics2DWorld::DebugDraw(Renderer& renderer) const {
+	const auto& unitCircle = GetUnitCircle();
+	m_debugLines.clear();
+
 	for (auto* collider : m_registeredColliders) {
 		if (!collider) continue;
 
@@ -239,15 +831,38 @@ void Physics2DWorld::DebugDraw(Renderer& renderer) const {
 
 		// Collider offset is in the object's LOCAL space: rotate it into WORLD space.
 		const Vector2f worldPosition = transform->GetWorldPosition() + transform->TransformDirection(collider->GetOffset());
-		const float worldRotation = transform->GetWorldRotation();
-		const Vector3 color = collider->IsTrigger() ? Vector3(200, 0, 0) : Vector3(0, 200, 0);
+		const Vector3i color = collider->IsTrigger() ? Vector3i(200, 0, 0) : Vector3i(0, 200, 0);
 
-		if (auto* box = dynamic_cast<BoxCollider2D*>(collider)) {
+		switch (collider->GetShapeType()) {
+		case Collider2D::ShapeType::Box: {
 			// Draw rotated, matching how Box2D actually uses the body's angle.
-			renderer.DrawRectOutlineRotated(worldPosition, box->GetSize(), worldRotation, color);
+			const Vector2f half = static_cast<BoxCollider2D*>(collider)->GetSize() * 0.5f;
+			const float radians = transform->GetWorldRotation() * Math::Constants<float>::Deg2Rad;
+			const Vector2f axisX = Vector2f(std::cos(radians), std::sin(radians)) * half.x;
+			const Vector2f axisY = Vector2f(-std::sin(radians), std::cos(radians)) * half.y;
+			const Vector2f corners[4] = {
+				worldPosition - axisX - axisY,
+				worldPosition + axisX - axisY,
+				worldPosition + axisX + axisY,
+				worldPosition - axisX + axisY
+			};
+			for (int i = 0; i < 4; ++i) {
+				m_debugLines.push_back(LineSegment{ corners[i], corners[(i + 1) % 4], color });
+			}
+			break;
+		}
+		case Collider2D::ShapeType::Circle: {
+			const float radius = static_cast<CircleCollider2D*>(collider)->GetRadius();
+			Vector2f previous = worldPosition + unitCircle.back() * radius;
+			for (const Vector2f& point : unitCircle) {
+				const Vector2f current = worldPosition + point * radius;
+				m_debugLines.push_back(LineSegment{ previous, current, color });
+				previous = current;
+			}
+			break;
 		}
-		else if (auto* circle = dynamic_cast<CircleCollider2D*>(collider)) {
-			renderer.DrawCircleOutline(worldPosition, circle->GetRadius(), color, 32);
 		}
 	}
+
+	renderer.DrawLineBatch(m_debugLines);
 }
@@ -1,13 +1,37 @@
 #pragma once
 
-#include <set>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <span>
 #include <unordered_set>
+#include <vector>
 #include <box2d/box2d.h>
+#include "CollisionLayers.h"
+#include "ContactCache.h"
+#include "Renderer.h"
 #include "Types.hpp"
 
 class Rigidbody2D;
 class Collider2D;
-class Renderer;
+class JobSystem;
+
+// Closest-first hit returned by Physics2DWorld's ray casts
+struct RaycastHit2D {
+	Collider2D* collider = nullptr;
+	Vector2f point = Vector2f::Zero();
+	Vector2f normal = Vector2f::Zero();
+	// Hit distance as a fraction of the cast translation [0, 1]
+	float fraction = 0.0f;
+};
+
+// Hit/miss counters for Physics2DWorld's body and shape pool
+struct PhysicsPoolStats {
+	int bodyHits = 0;    // AcquireBody served from the pool
+	int bodyMisses = 0;  // AcquireBody had to call b2CreateBody
+	int shapeHits = 0;   // AcquireShape retuned a parked shape
+	int shapeMisses = 0; // no parked shape fit; the collider created one
+};
 
 // Wraps a Box2D world and registered physics components
 class Physics2DWorld {
@@ -23,10 +47,27 @@ public:
 	void Reset(const Vector2f& gravity = Vector2f(0.0f, 0.0f));
 	// Shuts down the Box2D world
 	void Shutdown();
+	// Runs Box2D's parallel solver stages on the job workers (nullptr = main thread only).
+	// Takes effect the next time the world is created by Initialize or Reset.
+	void SetJobSystem(JobSystem* jobs) { m_jobSystem = jobs; }
+	// Returns the number of threads Box2D solves on: the job workers plus the stepping thread,
+	// which runs a share of every parallel stage itself. 1 when the job system is not used.
+	int GetWorkerCount() const { return m_workerCount; }
+	// Steps a small stack of boxes for the given number of steps once on the calling thread and
+	// once through the job system, and returns true if every body ends in a bit-identical pose.
+	// Run by the physics-determinism check in Tools/EngineChecks.
+	static bool CheckJobSystemDeterminism(JobSystem& jobs, int steps = 120);
 	// Steps the Box2D world simulation
 	void Step(float timeStep, int subStepCount = 1);
+	// Range ChooseSubStepCount picks from. The count climbs from min to max as the contacts per
+	// awake body approach contactsPerBodyForMax; a world with nothing awake uses min.
+	void SetSubStepRange(int minSubSteps, int maxSubSteps, float contactsPerBodyForMax);
+	// Substep count for the next Step, from the current awake body and contact counts
+	int ChooseSubStepCount() const;
+	// Returns the substep count the last Step ran with
+	int GetLastSubStepCount() const { return m_lastSubStepCount; }
 
-	// Debug draw registered collider shapes
+	// Debug draw registered collider shapes (one batched submit for all of them)
 	void DebugDraw(Renderer& renderer) const;
 
 	// Returns the Box2D world handle
@@ -43,36 +84,105 @@ public:
 	void RegisterBody(Rigidbody2D* body);
 	// Unregisters a rigidbody from the world
 	void UnregisterBody(Rigidbody2D* body);
+	// Tracks a rigidbody whose Transform is interpolated between steps
+	void RegisterInterpolatedBody(Rigidbody2D* body);
+	// Stops interpolating a rigidbody
+	void UnregisterInterpolatedBody(Rigidbody2D* body);
+	// Blends interpolated rigidbodies' Transforms between the last two steps.
+	// alpha = fraction of a fixed step left in the accumulator (Time::FixedStepAlpha).
+	// Call only for drawing and follow with RestoreSimulatedPoses: gameplay must never see
+	// (or push back into Box2D through Transform::SetPosition) the blended pose.
+	void Interpolate(float alpha);
+	// Puts interpolated Transforms back on their bodies' simulated pose
+	void RestoreSimulatedPoses();
 	// Registers a collider with the world
 	void RegisterCollider(Collider2D* collider);
 	// Unregisters a collider from the world
 	void UnregisterCollider(Collider2D* collider);
 
+	// Replaces the layer collision matrix and refilters every registered collider.
+	// Kept across Reset, so a scene can configure it once.
+	void SetCollisionLayers(const CollisionLayerMatrix& layers);
+	// Returns the layer collision matrix
+	const CollisionLayerMatrix& GetCollisionLayers() const { return m_collisionLayers; }
+	// Returns the Box2D filter for a collider on the given layer
+	b2Filter MakeFilter(int layer) const;
+
+	// --- Scene queries ---
+	// Layer masks are CollisionLayerMatrix::GetCategoryBits(layer) values OR-ed together; only
+	// colliders on those layers are reported. Overlap queries write at most results.size()
+	// colliders into the caller's buffer and return how many they wrote.
+
+	// Colliders whose bounding boxes overlap the box (broadphase only, no exact shape test)
+	int OverlapAABB(const Vector2f& min, const Vector2f& max, std::span<Collider2D*> results,
+		std::uint64_t layerMask = CollisionLayerMatrix::kEveryLayer) const;
+	// Colliders overlapping the circle
+	int OverlapCircle(const Vector2f& center, float radius, std::span<Collider2D*> results,
+		std::uint64_t layerMask = CollisionLayerMatrix::kEveryLayer) const;
+	// Colliders overlapping a box of the given size, rotated by angleDegrees around its center
+	int OverlapBox(const Vector2f& center, const Vector2f& size, float angleDegrees, std::span<Collider2D*> results,
+		std::uint64_t layerMask = CollisionLayerMatrix::kEveryLayer) const;
+	// Casts a ray from origin to origin + translation; returns true and the closest hit if anything was hit
+	bool Raycast(const Vector2f& origin, const Vector2f& translation, RaycastHit2D& hit,
+		std::uint64_t layerMask = CollisionLayerMatrix::kEveryLayer) const;
+	// Every collider along the ray (up to results.size()), sorted closest first; returns the count
+	int RaycastAll(const Vector2f& origin, const Vector2f& translation, std::span<RaycastHit2D> results,
+		std::uint64_t layerMask = CollisionLayerMatrix::kEveryLayer) const;
+	// Collider on one of the layers whose surface is closest to 'point', within 'radius'.
+	// 'ignore' is skipped (usually the caller's own collider). Returns nullptr if none.
+	Collider2D* FindNearest(const Vector2f& point, float radius, std::uint64_t layerMask,
+		const Collider2D* ignore = nullptr) const;
+
+	// --- Body pool ---
+	// Released bodies are disabled (b2Body_Disable) and parked together with their shapes
+	// instead of being destroyed. They become available again after the next Step, once any
+	// end events still naming their shapes have been delivered.
+
+	// Returns a body set up from 'def': a parked one when available, otherwise a new one
+	b2BodyId AcquireBody(const b2BodyDef& def);
+	// Parks the body and its shapes for reuse (or destroys it when the pool is full).
+	// Colliders still on the body lose their shape.
+	void ReleaseBody(b2BodyId bodyId);
+	// Claims a parked shape on the body with the same sensor flag and retunes it to 'def'.
+	// The caller sets the geometry. Returns b2_nullShapeId if the body has no such shape.
+	b2ShapeId AcquireShape(b2BodyId bodyId, const b2ShapeDef& def);
+	// Most bodies kept parked; 0 turns pooling off
+	void SetBodyPoolCapacity(int capacity);
+	// Returns the number of parked bodies
+	int GetPooledBodyCount() const { return static_cast<int>(m_bodyPool.size() + m_releasedBodies.size()); }
+	// Returns the pool counters since the last ResetPoolStats
+	const PhysicsPoolStats& GetPoolStats() const { return m_poolStats; }
+	void ResetPoolStats() { m_poolStats = PhysicsPoolStats{}; }
+
+	// Returns the number of registered rigidbodies
+	int GetRegisteredBodyCount() const { return static_cast<int>(m_registeredBodies.size()); }
+	// Returns how many rigidbodies the last Step wrote back to their Transform (moved bodies only)
+	int GetSyncedBodyCount() const { return m_syncedBodyCount; }
+
 	// Removes any cached collision/trigger pairs involving this collider.
 	// Calling this prevents phantom OnCollisionStay / OnTriggerStay.
 	void ClearContactCacheFor(Collider2D* collider);
 
 private:
-	// Canonical (order-independent) pair of colliders.
-	// We always store the smaller pointer in 'a' so (A,B) and (B,A) are the same key.
-	struct ColliderPair {
-		Collider2D* a = nullptr;
-		Collider2D* b = nullptr;
+	// One Box2D parallel-for split into jobs; FinishTask waits until every submitted chunk has run.
+	struct Box2DTask {
+		std::atomic<int> pending{ 0 };
 	};
 
-	static ColliderPair MakePair(Collider2D* a, Collider2D* b) {
-		return (a < b) ? ColliderPair{ a, b } : ColliderPair{ b, a };
-	}
-
-	// Ordering for std::set
-	struct ColliderPairLess {
-		bool operator()(const ColliderPair& x, const ColliderPair& y) const noexcept {
-			if (x.a != y.a) {
-				return x.a < y.a;
-			}
-			return x.b < y.b;
-		}
-	};
+	static void* EnqueueTask(b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext);
+	static void FinishTask(void* userTask, void* userContext);
+	// Takes the next free task object, expecting the given number of submitted chunks
+	Box2DTask* AcquireTask(int pending);
+	// Marks one submitted chunk done and wakes FinishTask after the last one
+	static void CompleteChunk(Box2DTask& userTask);
+
+	// Makes a shape inert (no owner, no filter bits, no events, no mass) until it is claimed
+	static void ParkShape(b2ShapeId shapeId);
+	// Fills m_shapeScratch with the body's shapes
+	void GatherShapes(b2BodyId bodyId);
+
+	// Returns the collider's contact cache id, or ContactCache::kInvalidId if it is not registered
+	std::uint32_t GetContactId(const Collider2D* collider) const;
 
 	// Stored Box2D world handle
 	b2WorldId m_worldId = b2_nullWorldId;
@@ -80,9 +190,41 @@ private:
 	std::unordered_set<Rigidbody2D*> m_registeredBodies;
 	// Registered colliders
 	std::unordered_set<Collider2D*> m_registeredColliders;
+	// Registered colliders by contact id (nullptr = free id), plus the free ids
+	std::vector<Collider2D*> m_collidersByContactId;
+	std::vector<std::uint32_t> m_freeContactIds;
+	// Layer names and which layer pairs may touch
+	CollisionLayerMatrix m_collisionLayers;
+	// Rigidbodies with Interpolation::Interpolate
+	std::vector<Rigidbody2D*> m_interpolatedBodies;
+	// Bodies synced from move events during the last Step
+	int m_syncedBodyCount = 0;
+	// Adaptive substep range (SetSubStepRange)
+	int m_minSubSteps = 4;
+	int m_maxSubSteps = 20;
+	float m_contactsPerBodyForMaxSubSteps = 2.0f;
+	int m_lastSubStepCount = 0;
+
+	// Parked bodies ready for reuse, and those released since the last Step
+	std::vector<b2BodyId> m_bodyPool;
+	std::vector<b2BodyId> m_releasedBodies;
+	int m_bodyPoolCapacity = 256;
+	PhysicsPoolStats m_poolStats;
+	std::vector<b2ShapeId> m_shapeScratch;
+
+	// Job workers backing Box2D's task callbacks
+	JobSystem* m_jobSystem = nullptr;
+	// Box2D worker count the world was created with
+	int m_workerCount = 1;
+	// Task objects reused every Step; [0, m_taskCount) are in flight
+	std::vector<std::unique_ptr<Box2DTask>> m_tasks;
+	size_t m_taskCount = 0;
+
+	// Debug draw segments, rebuilt by every DebugDraw call
+	mutable std::vector<LineSegment> m_debugLines;
 
 	// Active non-trigger contacts (used to synthesize OnCollisionStay)
-	std::set<ColliderPair, ColliderPairLess> m_activeCollisions;
-	// Active trigger overlaps (used to synthesize OnTriggerStay.
-	std::set<ColliderPair, ColliderPairLess> m_activeTriggers;
+	ContactCache m_activeCollisions;
+	// Active trigger overlaps (used to synthesize OnTriggerStay)
+	ContactCache m_activeTriggers;
 };
@@ -0,0 +1,173 @@
+#include "PixelConvertKernels.h"
+
+#include <SDL3/SDL.h>
+
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define PIXEL_CONVERT_X86 1
+#include <immintrin.h>
+#else
+#define PIXEL_CONVERT_X86 0
+#endif
+
+// MSVC emits SSSE3/AVX2 intrinsics regardless of /arch; GCC/Clang need the function to opt in.
+#if PIXEL_CONVERT_X86 && (defined(__GNUC__) || defined(__clang__))
+#define PIXEL_CONVERT_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define PIXEL_CONVERT_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define PIXEL_CONVERT_TARGET_SSSE3
+#define PIXEL_CONVERT_TARGET_AVX2
+#endif
+
+namespace {
+	constexpr std::uint32_t kRgbMask = 0x00FFFFFFu;
+	constexpr std::uint32_t kAlphaMask = 0xFF000000u;
+
+	inline void StorePixel(std::uint8_t* dst, std::uint32_t rgba) {
+		std::memcpy(dst, &rgba, 4); // little-endian: R lands first
+	}
+
+	inline std::uint32_t KeyPixel(std::uint32_t rgba, std::uint32_t key) {
+		return (rgba & kRgbMask) == key ? (rgba & kRgbMask) : rgba;
+	}
+
+	// ---------------- Scalar ----------------
+
+	void Bgr24ToRgbaScalar(const std::uint8_t* src, std::uint8_t* dst, int pixels, std::uint32_t key) {
+		for (int i = 0; i < pixels; ++i, src += 3, dst += 4) {
+			const std::uint32_t rgba = src[2] | (src[1] << 8) | (src[0] << 16) | kAlphaMask;
+			StorePixel(dst, KeyPixel(rgba, key));
+		}
+	}
+
+	void Bgra32ToRgbaScalar(const std::uint8_t* src, std::uint8_t* dst, int pixels, std::uint32_t key, bool opaque) {
+		for (int i = 0; i < pixels; ++i, src += 4, dst += 4) {
+			const std::uint32_t alpha = opaque ? kAlphaMask : (static_cast<std::uint32_t>(src[3]) << 24);
+			const std::uint32_t rgba = src[2] | (src[1] << 8) | (src[0] << 16) | alpha;
+			StorePixel(dst, KeyPixel(rgba, key));
+		}
+	}
+
+#if PIXEL_CONVERT_X86
+	// Clears alpha where RGB == key. A key of kNoColorKey never matches (its top byte survives the RGB mask compare).
+	PIXEL_CONVERT_TARGET_SSSE3 inline __m128i ApplyKey128(__m128i rgba, __m128i key) {
+		const __m128i hit = _mm_cmpeq_epi32(_mm_and_si128(rgba, _mm_set1_epi32(static_cast<int>(kRgbMask))), key);
+		return _mm_andnot_si128(_mm_and_si128(hit, _mm_set1_epi32(static_cast<int>(kAlphaMask))), rgba);
+	}
+
+	PIXEL_CONVERT_TARGET_AVX2 inline __m256i ApplyKey256(__m256i rgba, __m256i key) {
+		const __m256i hit = _mm256_cmpeq_epi32(_mm256_and_si256(rgba, _mm256_set1_epi32(static_cast<int>(kRgbMask))), key);
+		return _mm256_andnot_si256(_mm256_and_si256(hit, _mm256_set1_epi32(static_cast<int>(kAlphaMask))), rgba);
+	}
+
+	// ---------------- SSSE3 (4 pixels per vector) ----------------
+	// SSE2 alone has no byte shuffle, so the swizzle needs pshufb.
+
+	PIXEL_CONVERT_TARGET_SSSE3 void Bgr24ToRgbaSSSE3(const std::uint8_t* src, std::uint8_t* dst, int pixels, std::uint32_t key) {
+		const __m128i shuffle = _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+		const __m128i alpha = _mm_set1_epi32(static_cast<int>(kAlphaMask));
+		const __m128i keyVec = _mm_set1_epi32(static_cast<int>(key));
+
+		int i = 0;
+		// Each load reads 16 bytes for 12 bytes of pixels; stop while the overread stays inside the row.
+		for (; (i + 4) * 3 + 4 <= pixels * 3; i += 4) {
+			const __m128i bgr = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3));
+			const __m128i rgba = _mm_or_si128(_mm_shuffle_epi8(bgr, shuffle), alpha);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), ApplyKey128(rgba, keyVec));
+		}
+		Bgr24ToRgbaScalar(src + i * 3, dst + i * 4, pixels - i, key);
+	}
+
+	PIXEL_CONVERT_TARGET_SSSE3 void Bgra32ToRgbaSSSE3(const std::uint8_t* src, std::uint8_t* dst, int pixels, std::uint32_t key, bool opaque) {
+		const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+		const __m128i alpha = _mm_set1_epi32(opaque ? static_cast<int>(kAlphaMask) : 0);
+		const __m128i keyVec = _mm_set1_epi32(static_cast<int>(key));
+
+		int i = 0;
+		for (; i + 4 <= pixels; i += 4) {
+			const __m128i bgra = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+			const __m128i rgba = _mm_or_si128(_mm_shuffle_epi8(bgra, shuffle), alpha);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), ApplyKey128(rgba, keyVec));
+		}
+		Bgra32ToRgbaScalar(src + i * 4, dst + i * 4, pixels - i, key, opaque);
+	}
+
+	// ---------------- AVX2 (8 pixels per vector) ----------------
+
+	PIXEL_CONVERT_TARGET_AVX2 void Bgr24ToRgbaAVX2(const std::uint8_t* src, std::uint8_t* dst, int pixels, std::uint32_t key) {
+		// pshufb works per 128-bit lane, so each lane gets its own 12 source bytes.
+		const __m256i shuffle = _mm256_setr_epi8(
+			2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1,
+			2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+		const __m256i alpha = _mm256_set1_epi32(static_cast<int>(kAlphaMask));
+		const __m256i keyVec = _mm256_set1_epi32(static_cast<int>(key));
+
+		int i = 0;
+		// The upper lane loads 16 bytes starting 12 bytes in: 28 bytes read for 24 used.
+		for (; i * 3 + 28 <= pixels * 3; i += 8) {
+			const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3));
+			const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3 + 12));
+			const __m256i bgr = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+			const __m256i rgba = _mm256_or_si256(_mm256_shuffle_epi8(bgr, shuffle), alpha);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), ApplyKey256(rgba, keyVec));
+		}
+		Bgr24ToRgbaScalar(src + i * 3, dst + i * 4, pixels - i, key);
+	}
+
+	PIXEL_CONVERT_TARGET_AVX2 void Bgra32ToRgbaAVX2(const std::uint8_t* src, std::uint8_t* dst, int pixels, std::uint32_t key, bool opaque) {
+		const __m256i shuffle = _mm256_setr_epi8(
+			2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+			2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+		const __m256i alpha = _mm256_set1_epi32(opaque ? static_cast<int>(kAlphaMask) : 0);
+		const __m256i keyVec = _mm256_set1_epi32(static_cast<int>(key));
+
+		int i = 0;
+		for (; i + 8 <= pixels; i += 8) {
+			const __m256i bgra = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 4));
+			const __m256i rgba = _mm256_or_si256(_mm256_shuffle_epi8(bgra, shuffle), alpha);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), ApplyKey256(rgba, keyVec));
+		}
+		Bgra32ToRgbaScalar(src + i * 4, dst + i * 4, pixels - i, key, opaque);
+	}
+#endif
+
+	const PixelConvertKernels kScalarKernels{ Bgr24ToRgbaScalar, Bgra32ToRgbaScalar, "scalar" };
+#if PIXEL_CONVERT_X86
+	const PixelConvertKernels kSSSE3Kernels{ Bgr24ToRgbaSSSE3, Bgra32ToRgbaSSSE3, "SSSE3" };
+	const PixelConvertKernels kAVX2Kernels{ Bgr24ToRgbaAVX2, Bgra32ToRgbaAVX2, "AVX2" };
+#endif
+}
+
+const PixelConvertKernels& SelectPixelConvertKernels() {
+#if PIXEL_CONVERT_X86
+	if (SDL_HasAVX2()) {
+		return kAVX2Kernels;
+	}
+	// SDL has no SSSE3 query; every SSE4.1 CPU has SSSE3.
+	if (SDL_HasSSE41()) {
+		return kSSSE3Kernels;
+	}
+#endif
+	return kScalarKernels;
+}
+
+std::span<const PixelConvertKernels* const> GetSupportedPixelConvertKernels() {
+	static const auto supported = [] {
+		struct List {
+			const PixelConvertKernels* sets[3] = {};
+			size_t count = 0;
+		} list;
+		list.sets[list.count++] = &kScalarKernels;
+#if PIXEL_CONVERT_X86
+		if (SDL_HasSSE41()) {
+			list.sets[list.count++] = &kSSSE3Kernels;
+		}
+		if (SDL_HasAVX2()) {
+			list.sets[list.count++] = &kAVX2Kernels;
+		}
+#endif
+		return list;
+	}();
+	return { supported.sets, supported.count };
+}
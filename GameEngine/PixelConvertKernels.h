@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+// Row converters from BMP pixel layouts to RGBA8 (R first in memory, SDL_PIXELFORMAT_RGBA32) with the
+// color key applied: pixels whose RGB equals the key get alpha 0, everything else keeps its color.
+// Scalar, SSSE3 and AVX2 flavours produce identical bytes; SelectPixelConvertKernels() picks one.
+struct PixelConvertKernels {
+	// Pass as 'key' when no color key is wanted (can never match a 24-bit color).
+	static constexpr std::uint32_t kNoColorKey = 0xFFFFFFFFu;
+
+	// Packs a color key the way the kernels compare it.
+	static constexpr std::uint32_t PackKey(int r, int g, int b) {
+		return static_cast<std::uint32_t>(r & 0xFF) | (static_cast<std::uint32_t>(g & 0xFF) << 8) | (static_cast<std::uint32_t>(b & 0xFF) << 16);
+	}
+
+	// 'pixels' BGR24 pixels to RGBA8, alpha 255 unless keyed.
+	void (*bgr24ToRgba)(const std::uint8_t* src, std::uint8_t* dst, int pixels, std::uint32_t key);
+
+	// 'pixels' BGRA32 pixels to RGBA8. opaque = ignore the source alpha (BGRX) and write 255 unless keyed.
+	void (*bgra32ToRgba)(const std::uint8_t* src, std::uint8_t* dst, int pixels, std::uint32_t key, bool opaque);
+
+	const char* name;
+};
+
+// Returns the fastest kernel set supported by the running CPU (AVX2 > SSSE3 > scalar).
+const PixelConvertKernels& SelectPixelConvertKernels();
+
+// Every kernel set the running CPU supports, scalar first (for equivalence checks and benchmarks).
+std::span<const PixelConvertKernels* const> GetSupportedPixelConvertKernels();
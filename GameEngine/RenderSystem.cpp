@@ -5,8 +5,34 @@
 #include "SpriteRenderer.h"
 #include "TextRenderer.h"
 #include "GameObject.h"
+#include "Transform.h"
+#include "ViewportUtils.h"
 
 #include <algorithm>
+#include <cmath>
+
+namespace {
+	// Conservative overlap test between the sprite's drawn rect and the view.
+	bool OverlapsView(const SpriteRenderer& sprite, const Viewport::Bounds& view) {
+		const Transform* transform = sprite.GetTransform();
+		if (!transform) {
+			return false;
+		}
+
+		const Vector2i frameSize = sprite.GetResolvedFrameSize();
+		const Vector2f scale = transform->GetWorldScale();
+		float halfW = 0.5f * frameSize.x * std::abs(scale.x);
+		float halfH = 0.5f * frameSize.y * std::abs(scale.y);
+		if (!Math::Approximately(transform->GetWorldRotation(), 0.0f)) {
+			// Rotated around the center: the circumscribed square covers every angle.
+			halfW = halfH = std::sqrt(halfW * halfW + halfH * halfH);
+		}
+
+		const Vector2f p = transform->GetWorldPosition();
+		return p.x + halfW >= view.left && p.x - halfW <= view.right
+			&& p.y + halfH >= view.bottom && p.y - halfH <= view.top;
+	}
+}
 
 RenderSystem& RenderSystem::Get() {
 	static RenderSystem instance;
@@ -63,13 +89,19 @@ void RenderSystem::Unregister(RenderableComponent* renderable) {
 	}
 }
 
-void RenderSystem::BuildQueue(RenderQueue& outQueue) const {
+void RenderSystem::BuildQueue(RenderQueue& outQueue, const Vector2i& viewSize) const {
+	const bool cull = viewSize.x > 0 && viewSize.y > 0;
+	const Viewport::Bounds view = Viewport::GetWorldBounds(viewSize);
+
 	// NOTE: We filter here to keep the registry stable even if objects are toggled active.
-	for (const auto* sprite : m_sprites) {
+	for (auto* sprite : m_sprites) {
 		if (!sprite) continue;
+		sprite->m_inView = false;
 		if (!sprite->IsVisible()) continue;
 		auto* go = sprite->GetGameObject();
 		if (!go || !go->IsActiveInHierarchy()) continue;
+		if (cull && !OverlapsView(*sprite, view)) continue;
+		sprite->m_inView = true;
 		outQueue.Add(sprite);
 	}
 
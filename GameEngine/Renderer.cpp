@@ -4,12 +4,18 @@
 #include <string>
 #include <cmath>
 #include <algorithm>
+#include <vector>
 
 static SDL_Renderer* R(void* p) { return static_cast<SDL_Renderer*>(p); }
 static SDL_Window* W(void* p) { return static_cast<SDL_Window*>(p); }
 
+struct Renderer::GeometryScratch {
+	std::vector<SDL_Vertex> vertices;
+	std::vector<int> indices;
+};
+
 Renderer::Renderer(Window& window)
-	: m_renderer(nullptr) {
+	: m_renderer(nullptr), m_geometry(std::make_unique<GeometryScratch>()) {
 
 	LOG_INFO("Initializing renderer");
 
@@ -39,7 +45,8 @@ Renderer::Renderer(Renderer&& other) noexcept
 	m_integerScale(other.m_integerScale),
 	m_clearColor(other.m_clearColor),
 	m_letterboxColor(other.m_letterboxColor),
-	m_cacheValid(false) {
+	m_cacheValid(false),
+	m_geometry(std::move(other.m_geometry)) {
 
 	other.m_renderer = nullptr;
 	other.m_window = nullptr;
@@ -61,6 +68,7 @@ Renderer& Renderer::operator=(Renderer&& other) noexcept {
 		m_integerScale = other.m_integerScale;
 		m_clearColor = other.m_clearColor;
 		m_letterboxColor = other.m_letterboxColor;
+		std::swap(m_geometry, other.m_geometry);
 
 		m_cacheValid = false;
 	}
@@ -392,7 +400,9 @@ bool Renderer::DrawTextureTinted(
 	SDL_GetTextureColorMod(sdlTex, &oldR, &oldG, &oldB);
 	SDL_GetTextureAlphaMod(sdlTex, &oldA);
 
-	SDL_SetTextureColorMod(sdlTex, (Uint8)tint.x, (Uint8)tint.y, (Uint8)tint.z);
+	// Premultiplied textures need the tint's alpha folded into the color too.
+	const int colorScale = texture.IsPremultiplied() ? tint.w : 255;
+	SDL_SetTextureColorMod(sdlTex, (Uint8)(tint.x * colorScale / 255), (Uint8)(tint.y * colorScale / 255), (Uint8)(tint.z * colorScale / 255));
 	SDL_SetTextureAlphaMod(sdlTex, (Uint8)tint.w);
 
 	const SDL_FRect src{ sourcePosition.x, sourcePosition.y, sourceSize.x, sourceSize.y };
@@ -455,6 +465,72 @@ bool Renderer::DrawTextureRotated(
 	return true;
 }
 
+bool Renderer::DrawTextureBatch(const Texture& texture, std::span<const TextureQuad> quads) {
+	if (!m_renderer) return false;
+	if (!texture.IsValid()) return false;
+	if (quads.empty()) return true;
+	EnsureViewportAndClipApplied();
+
+	SDL_Texture* sdlTex = static_cast<SDL_Texture*>(texture.GetNative());
+	if (!sdlTex) return false;
+
+	const Vector2i texSize = texture.GetSize();
+	if (texSize.x <= 0 || texSize.y <= 0) return false;
+	const float invW = 1.0f / static_cast<float>(texSize.x);
+	const float invH = 1.0f / static_cast<float>(texSize.y);
+
+	UpdateViewportCache();
+	const float sx = m_cacheValid ? m_cachedScaleX : 1.0f;
+	const float sy = m_cacheValid ? m_cachedScaleY : 1.0f;
+
+	std::vector<SDL_Vertex>& vertices = m_geometry->vertices;
+	std::vector<int>& indices = m_geometry->indices;
+	vertices.resize(quads.size() * 4);
+	indices.resize(quads.size() * 6);
+
+	const SDL_FColor white{ 1.0f, 1.0f, 1.0f, 1.0f };
+	for (size_t q = 0; q < quads.size(); ++q) {
+		const TextureQuad& quad = quads[q];
+		const Vector2f c = WorldToScreenPoint(quad.center);
+		const float hw = quad.size.x * 0.5f * sx;
+		const float hh = quad.size.y * 0.5f * sy;
+
+		// Screen Y is down, so a CCW world angle is clockwise on screen.
+		const float rad = -quad.angleDegrees * Math::Constants<float>::Deg2Rad;
+		const float cs = std::cos(rad);
+		const float sn = std::sin(rad);
+
+		const float u0 = quad.sourcePosition.x * invW;
+		const float v0 = quad.sourcePosition.y * invH;
+		const float u1 = (quad.sourcePosition.x + quad.sourceSize.x) * invW;
+		const float v1 = (quad.sourcePosition.y + quad.sourceSize.y) * invH;
+
+		// Corners in screen space: top-left, top-right, bottom-right, bottom-left.
+		const float cornerX[4] = { -hw, hw, hw, -hw };
+		const float cornerY[4] = { -hh, -hh, hh, hh };
+		const float cornerU[4] = { u0, u1, u1, u0 };
+		const float cornerV[4] = { v0, v0, v1, v1 };
+
+		SDL_Vertex* v = &vertices[q * 4];
+		for (int i = 0; i < 4; ++i) {
+			v[i].position = SDL_FPoint{ c.x + cornerX[i] * cs - cornerY[i] * sn, c.y + cornerX[i] * sn + cornerY[i] * cs };
+			v[i].color = white;
+			v[i].tex_coord = SDL_FPoint{ cornerU[i], cornerV[i] };
+		}
+
+		const int base = static_cast<int>(q * 4);
+		int* idx = &indices[q * 6];
+		idx[0] = base; idx[1] = base + 1; idx[2] = base + 2;
+		idx[3] = base; idx[4] = base + 2; idx[5] = base + 3;
+	}
+
+	if (!SDL_RenderGeometry(R(m_renderer), sdlTex, vertices.data(), static_cast<int>(vertices.size()), indices.data(), static_cast<int>(indices.size()))) {
+		LOG_WARN("Renderer draw texture batch failed: " + std::string(SDL_GetError()));
+		return false;
+	}
+	return true;
+}
+
 bool Renderer::DrawRectOutline(const Vector2f& worldTopLeft, const Vector2f& size, const Vector3i& color) {
 	if (!m_renderer) return false;
 	EnsureViewportAndClipApplied();
@@ -574,3 +650,48 @@ bool Renderer::DrawCircleOutline(const Vector2f& worldCenter, float radius, cons
 
 	return true;
 }
+
+bool Renderer::DrawLineBatch(std::span<const LineSegment> lines, float thickness) {
+	if (!m_renderer) return false;
+	if (lines.empty()) return true;
+	EnsureViewportAndClipApplied();
+
+	std::vector<SDL_Vertex>& vertices = m_geometry->vertices;
+	std::vector<int>& indices = m_geometry->indices;
+	vertices.clear();
+	indices.clear();
+	vertices.reserve(lines.size() * 4);
+	indices.reserve(lines.size() * 6);
+
+	// Each segment becomes a thin quad, so every color goes out in the same submit.
+	const float halfWidth = std::max(thickness, 1.0f) * 0.5f;
+	for (const LineSegment& line : lines) {
+		const Vector2f a = WorldToScreenPoint(line.from);
+		const Vector2f b = WorldToScreenPoint(line.to);
+		const float dx = b.x - a.x;
+		const float dy = b.y - a.y;
+		const float length = std::sqrt(dx * dx + dy * dy);
+		if (length <= 0.0f) continue;
+
+		const float nx = -dy / length * halfWidth;
+		const float ny = dx / length * halfWidth;
+		const SDL_FColor color{ line.color.x / 255.0f, line.color.y / 255.0f, line.color.z / 255.0f, 1.0f };
+		const SDL_FPoint noTexture{ 0.0f, 0.0f };
+
+		const int base = static_cast<int>(vertices.size());
+		vertices.push_back(SDL_Vertex{ SDL_FPoint{ a.x + nx, a.y + ny }, color, noTexture });
+		vertices.push_back(SDL_Vertex{ SDL_FPoint{ b.x + nx, b.y + ny }, color, noTexture });
+		vertices.push_back(SDL_Vertex{ SDL_FPoint{ b.x - nx, b.y - ny }, color, noTexture });
+		vertices.push_back(SDL_Vertex{ SDL_FPoint{ a.x - nx, a.y - ny }, color, noTexture });
+
+		indices.insert(indices.end(), { base, base + 1, base + 2, base, base + 2, base + 3 });
+	}
+
+	if (vertices.empty()) return true;
+
+	if (!SDL_RenderGeometry(R(m_renderer), nullptr, vertices.data(), static_cast<int>(vertices.size()), indices.data(), static_cast<int>(indices.size()))) {
+		LOG_WARN("Renderer draw line batch failed: " + std::string(SDL_GetError()));
+		return false;
+	}
+	return true;
+}
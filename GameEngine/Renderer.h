@@ -5,6 +5,8 @@
 #include "Logger.h"
 #include "Window.h"
 #include <cstdint>
+#include <memory>
+#include <span>
 
 class Texture;
 
@@ -17,6 +19,22 @@ enum class FlipMode {
 	Both
 };
 
+// One sprite for Renderer::DrawTextureBatch.
+struct TextureQuad {
+	Vector2f center;         // WORLD
+	Vector2f size;           // WORLD
+	Vector2f sourcePosition; // texture pixels
+	Vector2f sourceSize;     // texture pixels
+	float angleDegrees = 0.0f; // CCW around the center
+};
+
+// One colored segment for Renderer::DrawLineBatch.
+struct LineSegment {
+	Vector2f from;   // WORLD
+	Vector2f to;     // WORLD
+	Vector3i color;  // RGB 0-255
+};
+
 /// How the virtual resolution is mapped to the real window.
 /// - Letterbox: preserve aspect, show bars when needed ("contain")
 /// - Stretch: fill the whole window, distort aspect ("stretch")
@@ -125,6 +143,9 @@ public:
 		FlipMode flip = FlipMode::None
 	);
 
+	// Draws many quads from one texture with a single geometry submit, in span order.
+	bool DrawTextureBatch(const Texture& texture, std::span<const TextureQuad> quads);
+
 	// WORLD top-left rect
 	bool DrawRectOutline(const Vector2f& worldTopLeft, const Vector2f& size, const Vector3i& color);
 
@@ -137,12 +158,18 @@ public:
 	// WORLD center
 	bool DrawCircleOutline(const Vector2f& worldCenter, float radius, const Vector3i& color, int segments);
 
+	// Draws many colored segments with a single geometry submit; thickness in screen pixels.
+	bool DrawLineBatch(std::span<const LineSegment> lines, float thickness = 1.0f);
+
 	// Native handle access (native* as void*)
 	void* GetNative() const;
 
 	bool IsValid() const { return m_renderer != nullptr; }
 
 private:
+	// Vertex and index buffers reused by the geometry batches (defined with the SDL types in Renderer.cpp)
+	struct GeometryScratch;
+
 	bool GetOutputSize(int& outW, int& outH) const;
 	Vector2f WorldToScreenPoint(const Vector2f& world) const;
 	Rectf WorldToScreenRect(const Vector2f& worldTopLeft, const Vector2f& size) const;
@@ -178,4 +205,6 @@ private:
 
 	// Tracks whether viewport/clip has been applied since the last clear.
 	mutable bool m_viewportAppliedThisFrame = false;
+
+	std::unique_ptr<GeometryScratch> m_geometry;
 };
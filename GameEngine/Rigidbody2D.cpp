@@ -24,8 +24,9 @@ void Rigidbody2D::Initialize() {
 }
 
 void Rigidbody2D::Shutdown() {
-	DetachExistingColliders();
+	// Release the body first so its shapes are parked with it rather than destroyed.
 	DestroyBody();
+	DetachExistingColliders();
 }
 
 void Rigidbody2D::RecreateBody() {
@@ -164,17 +165,93 @@ void Rigidbody2D::SetIsBullet(bool isBullet)
 	m_isBullet = isBullet;
 }
 
+void Rigidbody2D::SetInterpolation(Interpolation interpolation) {
+	if (m_interpolation == interpolation) {
+		return;
+	}
+
+	m_interpolation = interpolation;
+	auto* physicsWorld = GetPhysicsWorld();
+	if (!physicsWorld || !b2Body_IsValid(m_bodyId)) {
+		return;
+	}
+
+	if (m_interpolation == Interpolation::Interpolate) {
+		m_previousPose = m_stepPose = b2Body_GetTransform(m_bodyId);
+		physicsWorld->RegisterInterpolatedBody(this);
+	}
+	else {
+		physicsWorld->UnregisterInterpolatedBody(this);
+		if (m_transformInterpolated) {
+			SyncTransformFromBody();
+			m_transformInterpolated = false;
+		}
+	}
+}
+
+void Rigidbody2D::BeginInterpolationStep() {
+	if (!b2Body_IsValid(m_bodyId)) {
+		return;
+	}
+
+	m_previousPose = b2Body_GetTransform(m_bodyId);
+}
+
+void Rigidbody2D::RestoreSimulatedPose() {
+	if (!m_transformInterpolated) {
+		return;
+	}
+
+	m_transformInterpolated = false;
+	SyncTransformFromBody();
+}
+
+void Rigidbody2D::EndInterpolationStep() {
+	if (b2Body_IsValid(m_bodyId)) {
+		m_stepPose = b2Body_GetTransform(m_bodyId);
+	}
+}
+
+void Rigidbody2D::ApplyInterpolation(float alpha) {
+	if (!b2Body_IsValid(m_bodyId)) {
+		return;
+	}
+
+	const b2Transform current = b2Body_GetTransform(m_bodyId);
+	const bool teleported = current.p.x != m_stepPose.p.x || current.p.y != m_stepPose.p.y
+		|| current.q.c != m_stepPose.q.c || current.q.s != m_stepPose.q.s;
+	if (teleported) {
+		// Set from gameplay since the step: show it as is rather than sliding there.
+		m_previousPose = m_stepPose = current;
+		return;
+	}
+
+	const bool moved = current.p.x != m_previousPose.p.x || current.p.y != m_previousPose.p.y
+		|| current.q.c != m_previousPose.q.c || current.q.s != m_previousPose.q.s;
+	if (!moved) {
+		return;
+	}
+
+	b2Transform blended;
+	blended.p = b2Lerp(m_previousPose.p, current.p, alpha);
+	blended.q = b2NLerp(m_previousPose.q, current.q, alpha);
+	SyncTransformFromBody(blended);
+	m_transformInterpolated = true;
+}
+
 void Rigidbody2D::SyncTransformFromBody() {
 	if (!b2Body_IsValid(m_bodyId)) {
 		return;
 	}
 
-	b2Vec2 position = b2Body_GetPosition(m_bodyId);
-	b2Rot rotation = b2Body_GetRotation(m_bodyId);
-	float angle = b2Rot_GetAngle(rotation);
+	SyncTransformFromBody(b2Body_GetTransform(m_bodyId));
+}
+
+void Rigidbody2D::SyncTransformFromBody(const b2Transform& pose) {
+	float angle = b2Rot_GetAngle(pose.q);
 
 	auto* transform = GetGameObject()->GetTransform();
-	transform->SetWorldPositionFromPhysics(Vector2f(position.x, position.y));
+	transform->SetWorldPositionFromPhysics(Vector2f(pose.p.x, pose.p.y));
 	transform->SetWorldRotationFromPhysics(angle * Math::Constants<float>::Rad2Deg);
 }
 
@@ -187,6 +264,7 @@ std::shared_ptr<Component> Rigidbody2D::Clone() const {
 	clone->m_fixedRotation = m_fixedRotation;
 	clone->m_allowSleep = m_allowSleep;
 	clone->m_isBullet = m_isBullet;
+	clone->m_interpolation = m_interpolation;
 	return clone;
 }
 
@@ -211,22 +289,59 @@ void Rigidbody2D::CreateBody() {
 	bodyDef.rotation = b2MakeRot(transform->GetWorldRotation() * Math::Constants<float>::Deg2Rad);
 	bodyDef.motionLocks.angularZ = m_fixedRotation;
 
-	m_bodyId = b2CreateBody(physicsWorld->GetWorldId(), &bodyDef);
+	bodyDef.isEnabled = GetGameObject()->IsActiveInHierarchy();
+
+	m_bodyId = physicsWorld->AcquireBody(bodyDef);
 	physicsWorld->RegisterBody(this);
+	if (m_interpolation == Interpolation::Interpolate) {
+		m_previousPose = m_stepPose = b2Body_GetTransform(m_bodyId);
+		m_transformInterpolated = false;
+		physicsWorld->RegisterInterpolatedBody(this);
+	}
 }
 
 void Rigidbody2D::DestroyBody() {
 	auto* physicsWorld = GetPhysicsWorld();
 	if (physicsWorld) {
 		physicsWorld->UnregisterBody(this);
+		physicsWorld->UnregisterInterpolatedBody(this);
 	}
 
 	if (b2Body_IsValid(m_bodyId)) {
-		b2DestroyBody(m_bodyId);
+		if (physicsWorld) {
+			physicsWorld->ReleaseBody(m_bodyId);
+		}
+		else {
+			b2DestroyBody(m_bodyId);
+		}
 		m_bodyId = b2_nullBodyId;
 	}
 }
 
+void Rigidbody2D::RefreshSimulation() {
+	if (!b2Body_IsValid(m_bodyId)) {
+		return;
+	}
+
+	const bool active = GetGameObject() && GetGameObject()->IsActiveInHierarchy();
+	if (active == b2Body_IsEnabled(m_bodyId)) {
+		return;
+	}
+
+	if (active) {
+		b2Body_Enable(m_bodyId);
+		return;
+	}
+
+	// Disabling drops the body's contacts; forget the cached pairs so no Stay outlives them.
+	if (auto* physicsWorld = GetPhysicsWorld()) {
+		for (const auto& collider : GetGameObject()->GetComponents<Collider2D>()) {
+			physicsWorld->ClearContactCacheFor(collider.get());
+		}
+	}
+	b2Body_Disable(m_bodyId);
+}
+
 void Rigidbody2D::AttachExistingColliders() {
 	auto colliders = GetGameObject()->GetComponents<Collider2D>();
 	for (const auto& collider : colliders) {
@@ -1,6 +1,7 @@
 #include "Scene.h"
 #include "MonoBehaviour.h"
 #include "GameMode.h"
+#include "SleeplessEngine.h"
 #include "Time.hpp"
 #include <algorithm>
 
@@ -45,6 +46,8 @@ void Scene::Start() {
 	}
 	m_isActive = true;
 	EnsureGameMode();
+	// Load everything the Scene declared before any behaviour can ask for it.
+	PreloadAssets();
 	// Give derived scenes a hook to initialize runtime state.
 	OnStart();
 	// Allow the GameMode to initialize after the Scene has created its initial objects.
@@ -64,6 +67,35 @@ void Scene::Start() {
 	ProcessLifecycleQueue();
 }
 
+void Scene::PreloadAssets() {
+	AssetManager* assets = SleeplessEngine::GetInstance().GetAssetManager();
+	if (!assets) {
+		return;
+	}
+
+	AssetManifest manifest;
+	OnDeclareAssets(manifest);
+	m_gameMode->OnDeclareAssets(manifest);
+	if (manifest.IsEmpty()) {
+		// Nothing declared, so lazy loads are expected here.
+		assets->SetReportLazyLoads(false);
+		return;
+	}
+
+	m_preloadedAssets = std::make_unique<AssetPreload>(assets->Preload(manifest));
+	assets->SetReportLazyLoads(true);
+}
+
+void Scene::ReleasePreloadedAssets() {
+	if (!m_preloadedAssets) {
+		return;
+	}
+	m_preloadedAssets.reset();
+	if (AssetManager* assets = SleeplessEngine::GetInstance().GetAssetManager()) {
+		assets->SetReportLazyLoads(false);
+	}
+}
+
 void Scene::Update() {
 	// Skip updates if the scene has not started or has been unloaded.
 	if (!m_isActive) {
@@ -182,6 +214,7 @@ void Scene::Unload() {
 	}
 	// Clear pooled references so Scene unload can destroy everything cleanly.
 	m_objectPool.Clear();
+	ReleasePreloadedAssets();
 
 
 	// Destroy all objects registered with this scene.
@@ -7,6 +7,7 @@
 #include "TextRenderer.h"
 #include "RenderQueue.h"
 #include "RenderSystem.h"
+#include "AnimationSystem.h"
 #include "UISystem.h"
 #include "Audio.h"
 #include <SDL3/SDL.h>
@@ -67,6 +68,7 @@ void SleeplessEngine::Initialize(Config config) {
 	Time::Initialize();
 	Time::SetFixedDeltaTime(m_config.fixedDeltaTime);
 	Time::SetMaxDeltaTime(m_config.maximumDeltaTime);
+	Time::SetMaxFixedStepsPerFrame(m_config.maxFixedStepsPerFrame);
 	Time::SetTargetFPS(m_config.targetFPS);
 
 
@@ -92,12 +94,24 @@ void SleeplessEngine::Initialize(Config config) {
 		m_renderer->SetLetterboxColor(m_config.letterboxColor);
 		SpriteRenderer::SetSortOptions(m_config.spriteSortOptions);
 		RenderQueue::SetSpriteSortOptions(ToQueueSortOptions(m_config.spriteSortOptions));
-		m_assetManager = std::make_unique<AssetManager>(*m_renderer);
+		m_jobSystem = std::make_unique<JobSystem>(m_config.jobWorkerCount);
+		m_assetManager = std::make_unique<AssetManager>(*m_renderer, m_jobSystem.get());
 		m_assetManager->SetBasePath(m_config.assetBasePath);
+		if (!m_config.assetPackPath.empty()) {
+			m_assetManager->MountPack(m_config.assetPackPath);
+		}
 		m_assetManager->SetDefaultTextureScaleMode(m_config.textureScaleMode);
+		m_assetManager->SetUploadBudgetBytes(m_config.textureUploadBudgetBytes);
+		m_assetManager->SetMemoryBudgetBytes(m_config.assetMemoryBudgetBytes);
 		Input::Initialize();
 
 		m_physicsWorld = std::make_unique<Physics2DWorld>();
+		if (m_config.physicsUseJobSystem) {
+			m_physicsWorld->SetJobSystem(m_jobSystem.get());
+		}
+		m_physicsWorld->SetCollisionLayers(m_config.collisionLayers);
+		m_physicsWorld->SetSubStepRange(m_config.physicsMinSubSteps, m_config.physicsMaxSubSteps, m_config.physicsContactsPerBodyForMaxSubSteps);
+		m_physicsWorld->SetBodyPoolCapacity(m_config.physicsBodyPoolCapacity);
 		m_physicsWorld->Initialize(Vector2(0, 0));
 
 		// GameInstance is created once per engine lifetime.
@@ -134,29 +148,43 @@ void SleeplessEngine::Run() {
 				Time::ToggleShowFPS();
 			}
 
-			// 3. Fixed update
+			// 3. Streaming assets (finish async loads within the upload budget)
+			m_assetManager->Update();
+
+			// 4. Fixed update
 			int steps = Time::CalculateFixedSteps();
+			m_physicsFrameStats = PhysicsFrameStats{};
+			m_physicsFrameStats.droppedSteps = Time::DroppedFixedSteps();
+			if (m_physicsFrameStats.droppedSteps > 0) {
+				LOG_WARN("Frame fell behind: dropped " + std::to_string(m_physicsFrameStats.droppedSteps) + " fixed steps");
+			}
 			for (int i = 0; i < steps; ++i) {
 				FixedUpdate();
 				Time::ConsumeFixedStep();
 			}
 
-			// 4. Variable update
+			// 5. Variable update
 			Update();
 			if (!m_isRunning) {
 				break;
 			}
 
-			// 5. Late update
+			// 6. Animation (every Animator in one pass, after gameplay set its parameters)
+			Animate();
+
+			// 7. Late update
 			LateUpdate();
 			if (!m_isRunning) {
 				break;
 			}
 
-			// 6. Garbage collection
+			// 8. Garbage collection
 			DestroyPending();
 
-			// 7. Render
+			// 9. Audio (flush any commands the mixer queue could not take yet)
+			Audio::Update();
+
+			// 10. Render
 			Render();
 
 			Time::WaitForTargetFPS();
@@ -187,6 +215,12 @@ void SleeplessEngine::SetScene(Scene* scene) {
 void SleeplessEngine::ResetPhysicsWorld(const Vector2f& gravity) {
 	if (!m_physicsWorld) {
 		m_physicsWorld = std::make_unique<Physics2DWorld>();
+		if (m_config.physicsUseJobSystem) {
+			m_physicsWorld->SetJobSystem(m_jobSystem.get());
+		}
+		m_physicsWorld->SetCollisionLayers(m_config.collisionLayers);
+		m_physicsWorld->SetSubStepRange(m_config.physicsMinSubSteps, m_config.physicsMaxSubSteps, m_config.physicsContactsPerBodyForMaxSubSteps);
+		m_physicsWorld->SetBodyPoolCapacity(m_config.physicsBodyPoolCapacity);
 	}
 	m_physicsWorld->Reset(gravity);
 }
@@ -274,7 +308,17 @@ void SleeplessEngine::FixedUpdate() {
 	}
 
 	if (m_physicsWorld) {
-		m_physicsWorld->Step(Time::FixedDeltaTime(), 20);
+		const int subSteps = m_physicsWorld->ChooseSubStepCount();
+		m_physicsWorld->Step(Time::FixedDeltaTime(), subSteps);
+		m_physicsFrameStats.fixedSteps++;
+		m_physicsFrameStats.subSteps += subSteps;
+	}
+}
+
+void SleeplessEngine::Animate() {
+	// Animation pauses with the scene, like the behaviours that drive it.
+	if (m_currentScene && m_currentScene->IsActive()) {
+		AnimationSystem::Get().Update(Time::DeltaTime(), m_jobSystem.get(), m_config.animationJobMinCount);
 	}
 }
 
@@ -288,8 +332,12 @@ void SleeplessEngine::Render() {
 	m_renderer->Clear();
 
 	if (m_currentScene && m_currentScene->IsActive()) {
+		if (m_physicsWorld) {
+			m_physicsWorld->Interpolate(Time::FixedStepAlpha());
+		}
+
 		RenderQueue queue;
-		RenderSystem::Get().BuildQueue(queue);
+		RenderSystem::Get().BuildQueue(queue, m_renderer->GetVirtualResolution());
 		queue.Execute(*m_renderer);
 		m_currentScene->Render();
 	}
@@ -302,6 +350,11 @@ void SleeplessEngine::Render() {
 	UISystem::Get().Render(*m_renderer);
 
 	m_renderer->Present();
+
+	// The blended poses were for drawing only; scripts run on the simulated ones.
+	if (m_physicsWorld) {
+		m_physicsWorld->RestoreSimulatedPoses();
+	}
 }
 
 void SleeplessEngine::DestroyPending() {
@@ -337,6 +390,8 @@ void SleeplessEngine::Shutdown() {
 		m_physicsWorld.reset();
 	}
 	m_assetManager.reset();
+	// Joins workers; must happen before SDL_Quit since jobs may still hold SDL surfaces.
+	m_jobSystem.reset();
 	m_renderer.reset();
 	m_window.reset();
 	SDL_Quit();
@@ -12,6 +12,7 @@
 #include <type_traits>
 
 #include "SpriteRenderer.h"
+#include "JobSystem.h"
 
 
 
@@ -23,6 +24,8 @@ struct Config {
 
 	// Asset base path
 	std::string assetBasePath = "Dist/graphics/";
+	// Optional asset pack built by AssetPacker. Used when the file exists; loose files are the fallback.
+	std::string assetPackPath;
 	WindowConfig windowConfig{};
 
 	// Virtual Resolution / Letterboxed Viewport
@@ -53,6 +56,41 @@ struct Config {
 	};
 
 	bool debugDrawColliders = false;
+
+	// Collision layers and the pairs of layers that may touch (default: everything collides)
+	CollisionLayerMatrix collisionLayers{};
+
+	// Worker threads for background jobs (asset decoding). 0 = hardware threads - 1.
+	int jobWorkerCount = 0;
+	// Max texture bytes uploaded per frame by async asset loads.
+	size_t textureUploadBudgetBytes = 8 * 1024 * 1024;
+	// Resident texture + audio memory before unreferenced assets are evicted (LRU). 0 = unlimited.
+	size_t assetMemoryBudgetBytes = 0;
+	// Enabled Animators needed before AnimationSystem splits its per-frame passes across the job
+	// workers. 0 = always animate on the main thread. The main thread waits for those jobs, so keep
+	// this high if the workers are usually busy decoding assets.
+	int animationJobMinCount = 0;
+	// Lets Box2D spread each physics step over the job workers (jobWorkerCount + main thread).
+	// Box2D's results do not depend on the thread count, so this only changes how fast a step runs.
+	bool physicsUseJobSystem = true;
+	// Most fixed steps one frame may run to catch up; owed steps beyond this are dropped so a
+	// long frame cannot snowball. 0 = no cap.
+	int maxFixedStepsPerFrame = 5;
+	// Box2D substeps per fixed step, picked each step between these bounds by how many contacts
+	// each awake body has (Physics2DWorld::SetSubStepRange).
+	int physicsMinSubSteps = 4;
+	int physicsMaxSubSteps = 20;
+	float physicsContactsPerBodyForMaxSubSteps = 2.0f;
+	// Destroyed rigidbodies park their Box2D body and shapes for the next spawn instead of
+	// freeing them. Most bodies kept parked; 0 = always create and destroy.
+	int physicsBodyPoolCapacity = 256;
+};
+
+// Fixed-step work done by the last frame
+struct PhysicsFrameStats {
+	int fixedSteps = 0;   // FixedUpdate + physics steps run
+	int subSteps = 0;     // Box2D substeps summed over those steps
+	int droppedSteps = 0; // owed steps discarded by Config::maxFixedStepsPerFrame
 };
 
 class SleeplessEngine {
@@ -90,6 +128,10 @@ public:
 
 	AssetManager* GetAssetManager() const { return m_assetManager.get(); }
 
+	JobSystem* GetJobSystem() const { return m_jobSystem.get(); }
+
+	const PhysicsFrameStats& GetPhysicsFrameStats() const { return m_physicsFrameStats; }
+
 private:
 	SleeplessEngine() = default;
 
@@ -99,6 +141,7 @@ private:
 	void CreateGameInstanceIfNeeded();
 
 	void FixedUpdate();
+	void Animate();
 	void LateUpdate();
 	void Render();
 	void DestroyPending();
@@ -109,9 +152,11 @@ private:
 	bool m_isRunning = false;
 
 	Config m_config{};
+	PhysicsFrameStats m_physicsFrameStats{};
 
 	std::unique_ptr<Window> m_window;
 	std::unique_ptr<Renderer> m_renderer;
+	std::unique_ptr<JobSystem> m_jobSystem;
 	std::unique_ptr<AssetManager> m_assetManager;
 	std::unique_ptr<Physics2DWorld> m_physicsWorld;
 
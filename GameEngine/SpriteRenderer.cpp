@@ -1,13 +1,20 @@
 #include "SpriteRenderer.h"
+#include "AssetManager.h"
 #include "GameObject.h"
 #include "Object.h"
 #include "Renderer.h"
+#include "SleeplessEngine.h"
 #include "Transform.h"
 #include <algorithm>
 #include <cmath>
 
 namespace {
 	SpriteRenderer::SortOptions g_sortOptions{};
+
+	AssetHandle<Texture> RetainTexture(Texture* texture) {
+		AssetManager* assets = SleeplessEngine::GetInstance().GetAssetManager();
+		return assets ? assets->Retain(texture) : AssetHandle<Texture>{};
+	}
 }
 
 SpriteRenderer::SpriteRenderer()
@@ -15,7 +22,7 @@ SpriteRenderer::SpriteRenderer()
 }
 
 SpriteRenderer::SpriteRenderer(Texture* texture)
-	: RenderableComponent("SpriteRenderer"), m_texture(texture) {
+	: RenderableComponent("SpriteRenderer"), m_texture(texture), m_textureHandle(RetainTexture(texture)) {
 	if (m_texture) {
 		m_frameSize = m_texture->GetSize();
 	}
@@ -23,6 +30,7 @@ SpriteRenderer::SpriteRenderer(Texture* texture)
 
 void SpriteRenderer::SetTexture(Texture* texture) {
 	m_texture = texture;
+	m_textureHandle = RetainTexture(texture);
 	if (m_texture && (m_frameSize.x <= 0 || m_frameSize.y <= 0)) {
 		m_frameSize = m_texture->GetSize();
 	}
@@ -207,6 +215,7 @@ void SpriteRenderer::Render(Renderer& renderer) const {
 std::shared_ptr<Component> SpriteRenderer::Clone() const {
 	auto clone = std::make_shared<SpriteRenderer>();
 	clone->m_texture = m_texture;
+	clone->m_textureHandle = m_textureHandle;
 	clone->m_frameSize = m_frameSize;
 	clone->m_frameIndex = m_frameIndex;
 	clone->m_layerOrder = m_layerOrder;
@@ -1,5 +1,68 @@
 #include "Surface.h"
+#include "PixelConvertKernels.h"
 #include <SDL3/SDL.h>
+#include <cstring>
+
+namespace {
+    template<typename T>
+    T ReadLE(const std::uint8_t* bytes) {
+        T value{};
+        std::memcpy(&value, bytes, sizeof(T));
+        return value;
+    }
+
+    // Uncompressed 24/32-bit BMP straight to an RGBA32 (or RGBX32 when nothing is transparent) surface.
+    // Returns null for anything else so the caller can fall back to SDL.
+    SDL_Surface* DecodeBmpFast(const void* data, size_t size, const Vector3i* colorKey) {
+        const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+        if (size < 54 || bytes[0] != 'B' || bytes[1] != 'M') return nullptr;
+
+        const std::uint32_t pixelOffset = ReadLE<std::uint32_t>(bytes + 10);
+        const std::uint32_t dibSize = ReadLE<std::uint32_t>(bytes + 14);
+        const std::int32_t width = ReadLE<std::int32_t>(bytes + 18);
+        const std::int32_t rawHeight = ReadLE<std::int32_t>(bytes + 22);
+        const std::uint16_t bpp = ReadLE<std::uint16_t>(bytes + 28);
+        const std::uint32_t compression = ReadLE<std::uint32_t>(bytes + 30);
+        if (dibSize < 40 || compression != 0 /* BI_RGB */ || (bpp != 24 && bpp != 32) || width <= 0 || rawHeight == 0) {
+            return nullptr;
+        }
+
+        const int height = rawHeight < 0 ? -rawHeight : rawHeight;
+        const bool topDown = rawHeight < 0;
+        const size_t stride = ((static_cast<size_t>(width) * bpp + 31) / 32) * 4;
+        if (pixelOffset > size || stride * static_cast<size_t>(height) > size - pixelOffset) return nullptr;
+        const std::uint8_t* pixels = bytes + pixelOffset;
+
+        // Like SDL, a 32-bit BI_RGB image whose alpha bytes are all zero is opaque (BGRX).
+        bool hasAlpha = false;
+        if (bpp == 32) {
+            for (int y = 0; y < height && !hasAlpha; ++y) {
+                const std::uint8_t* row = pixels + y * stride;
+                for (int x = 0; x < width; ++x) {
+                    if (row[x * 4 + 3] != 0) { hasAlpha = true; break; }
+                }
+            }
+        }
+
+        SDL_Surface* surface = SDL_CreateSurface(width, height, (colorKey || hasAlpha) ? SDL_PIXELFORMAT_RGBA32 : SDL_PIXELFORMAT_RGBX32);
+        if (!surface) return nullptr;
+
+        const PixelConvertKernels& kernels = SelectPixelConvertKernels();
+        const std::uint32_t key = colorKey ? PixelConvertKernels::PackKey(colorKey->x, colorKey->y, colorKey->z) : PixelConvertKernels::kNoColorKey;
+        for (int y = 0; y < height; ++y) {
+            // BMP rows are stored bottom-up unless the height is negative
+            const std::uint8_t* src = pixels + static_cast<size_t>(topDown ? y : height - 1 - y) * stride;
+            std::uint8_t* dst = static_cast<std::uint8_t*>(surface->pixels) + static_cast<size_t>(y) * surface->pitch;
+            if (bpp == 24) {
+                kernels.bgr24ToRgba(src, dst, width, key);
+            }
+            else {
+                kernels.bgra32ToRgba(src, dst, width, key, !hasAlpha);
+            }
+        }
+        return surface;
+    }
+}
 
 
 
@@ -10,6 +73,44 @@
         }
     }
 
+    Surface::Surface(const void* data, size_t size, const std::string& debugName) {
+        SDL_IOStream* io = SDL_IOFromConstMem(data, size);
+        m_surface = io ? (void*)SDL_LoadBMP_IO(io, true) : nullptr;
+        if (!m_surface) {
+            THROW_ENGINE_EXCEPTION("Failed to load BMP: ") << SDL_GetError() << " (Packed: " << debugName << ")";
+        }
+    }
+
+    Surface Surface::FromBmp(const void* data, size_t size, const Vector3i* colorKey, const std::string& debugName) {
+        if (SDL_Surface* fast = DecodeBmpFast(data, size, colorKey)) {
+            return Surface(static_cast<void*>(fast));
+        }
+
+        Surface surface(data, size, debugName);
+        if (colorKey) {
+            surface.SetColorKey(*colorKey);
+        }
+        return surface;
+    }
+
+    Surface Surface::FromBmpFile(const std::string& filePath, const Vector3i* colorKey) {
+        size_t size = 0;
+        void* data = SDL_LoadFile(filePath.c_str(), &size);
+        if (!data) {
+            THROW_ENGINE_EXCEPTION("Failed to load BMP: ") << SDL_GetError() << " (File: " << filePath << ")";
+        }
+
+        try {
+            Surface surface = FromBmp(data, size, colorKey, filePath);
+            SDL_free(data);
+            return surface;
+        }
+        catch (...) {
+            SDL_free(data);
+            throw;
+        }
+    }
+
     Surface::Surface(Surface&& other) noexcept
         : m_surface(other.m_surface) {
         other.m_surface = nullptr;
@@ -60,3 +161,11 @@
         SDL_Surface* s = static_cast<SDL_Surface*>(m_surface);
 		return Vector2i(s->w, s->h);
     }
+
+    size_t Surface::GetByteSize() const {
+        if (!m_surface) {
+            return 0;
+        }
+        SDL_Surface* s = static_cast<SDL_Surface*>(m_surface);
+        return static_cast<size_t>(s->pitch) * static_cast<size_t>(s->h);
+    }
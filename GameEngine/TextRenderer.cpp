@@ -1,17 +1,31 @@
 #include "TextRenderer.h"
+#include "AssetManager.h"
 #include "BitmapFont.h"
 #include "Object.h"
 #include "GameObject.h"
 #include "Transform.h"
 #include "Renderer.h"
+#include "SleeplessEngine.h"
 #include "Texture.h"
 #include <algorithm>
 #include <cmath>
 
+namespace {
+	AssetHandle<BitmapFont> RetainFont(BitmapFont* font) {
+		AssetManager* assets = SleeplessEngine::GetInstance().GetAssetManager();
+		return assets ? assets->Retain(font) : AssetHandle<BitmapFont>{};
+	}
+}
+
 TextRenderer::TextRenderer()
 	: RenderableComponent("TextRenderer") {
 }
 
+void TextRenderer::SetFont(BitmapFont* font) {
+	m_font = font;
+	m_fontHandle = RetainFont(font);
+}
+
 Vector2f TextRenderer::RotateDeg(const Vector2f& v, float deg) {
 	const float r = deg * Math::Constants<float>::Deg2Rad;
 	const float c = std::cos(r);
@@ -161,6 +175,7 @@ void TextRenderer::Render(Renderer& renderer) const {
 std::shared_ptr<Component> TextRenderer::Clone() const {
 	auto clone = std::make_shared<TextRenderer>();
 	clone->m_font = m_font;
+	clone->m_fontHandle = m_fontHandle;
 	clone->m_text = m_text;
 	clone->m_anchor = m_anchor;
 	clone->m_extraScale = m_extraScale;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "AssetHandle.h"
 #include "RenderableComponent.h"
 #include "Types.hpp"
 #include <memory>
@@ -20,7 +21,7 @@ class TextRenderer : public RenderableComponent {
 public:
 	TextRenderer();
 
-	void SetFont(BitmapFont* font) { m_font = font; }
+	void SetFont(BitmapFont* font);
 	void SetText(const std::string& text) { m_text = text; }
 	void SetAnchor(TextAnchor a) { m_anchor = a; }
 	void SetExtraScale(float s) { m_extraScale = s; } // multiplier on top of Transform scale
@@ -37,6 +38,8 @@ private:
 
 private:
 	BitmapFont* m_font = nullptr;
+	// Keeps an AssetManager font (and its texture) from being evicted while this text draws it
+	AssetHandle<BitmapFont> m_fontHandle;
 	std::string m_text = "Text";
 
 	TextAnchor m_anchor = TextAnchor::Center;
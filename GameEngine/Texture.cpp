@@ -6,14 +6,45 @@ struct Texture::Impl {
 	SDL_Texture* texture = nullptr;
 	Vector2i windowSize{};
 	TextureScaleMode scaleMode = TextureScaleMode::Linear;
+	bool premultiplied = false;
 
 	Impl(Renderer& renderer, const std::string& filePath, bool useColorKey, const Vector3i& colorKey) {
-		Surface surface(filePath);
+		Surface surface = Surface::FromBmpFile(filePath, useColorKey ? &colorKey : nullptr);
+		Upload(renderer, surface);
+	}
+
+	Impl(Renderer& renderer, const Surface& surface) {
+		Upload(renderer, surface);
+	}
+
+	Impl(Renderer& renderer, const void* rgbaPixels, const Vector2i& size, int pitch, bool premultipliedAlpha) {
+		texture = SDL_CreateTexture(
+			static_cast<SDL_Renderer*>(renderer.GetNative()),
+			SDL_PIXELFORMAT_RGBA32,
+			SDL_TEXTUREACCESS_STATIC,
+			size.x, size.y
+		);
 
-		if (useColorKey) {
-			surface.SetColorKey(colorKey);
+		if (!texture) {
+			THROW_ENGINE_EXCEPTION("Failed to create texture: ") << SDL_GetError();
+		}
+
+		if (!SDL_UpdateTexture(texture, nullptr, rgbaPixels, pitch)) {
+			SDL_DestroyTexture(texture);
+			texture = nullptr;
+			THROW_ENGINE_EXCEPTION("Failed to upload texture pixels: ") << SDL_GetError();
 		}
 
+		premultiplied = premultipliedAlpha;
+		SDL_SetTextureBlendMode(texture, premultiplied ? SDL_BLENDMODE_BLEND_PREMULTIPLIED : SDL_BLENDMODE_BLEND);
+		windowSize = size;
+
+		// Default filtering linear
+		SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_LINEAR);
+		scaleMode = TextureScaleMode::Linear;
+	}
+
+	void Upload(Renderer& renderer, const Surface& surface) {
 		texture = SDL_CreateTextureFromSurface(
 			static_cast<SDL_Renderer*>(renderer.GetNative()),
 			static_cast<SDL_Surface*>(surface.GetNative())
@@ -42,7 +73,8 @@ struct Texture::Impl {
 	Impl(Impl&& other) noexcept
 		: texture(other.texture),
 		  windowSize(other.windowSize),
-		  scaleMode(other.scaleMode) {
+		  scaleMode(other.scaleMode),
+		  premultiplied(other.premultiplied) {
 		other.texture = nullptr;
 	}
 
@@ -54,6 +86,7 @@ struct Texture::Impl {
 			texture = other.texture;
 			windowSize = other.windowSize;
 			scaleMode = other.scaleMode;
+			premultiplied = other.premultiplied;
 			other.texture = nullptr;
 		}
 		return *this;
@@ -74,6 +107,12 @@ Texture::Texture(Renderer& renderer, const std::string& filePath)
 Texture::Texture(Renderer& renderer, const std::string& filePath, bool useColorKey, const Vector3i& colorKey)
 	: impl(std::make_unique<Impl>(renderer, filePath, useColorKey, colorKey)) {}
 
+Texture::Texture(Renderer& renderer, const Surface& surface)
+	: impl(std::make_unique<Impl>(renderer, surface)) {}
+
+Texture::Texture(Renderer& renderer, const void* rgbaPixels, const Vector2i& size, int pitch, bool premultipliedAlpha)
+	: impl(std::make_unique<Impl>(renderer, rgbaPixels, size, pitch, premultipliedAlpha)) {}
+
 Texture::~Texture() = default;
 
 Texture::Texture(Texture&& other) noexcept = default;
@@ -91,6 +130,16 @@ bool Texture::IsValid() const {
 	return impl && impl->texture != nullptr;
 }
 
+bool Texture::IsPremultiplied() const {
+	return impl && impl->premultiplied;
+}
+
+size_t Texture::GetByteSize() const {
+	if (!impl || !impl->texture) return 0;
+	return static_cast<size_t>(SDL_BYTESPERPIXEL(impl->texture->format))
+		* static_cast<size_t>(impl->texture->w) * static_cast<size_t>(impl->texture->h);
+}
+
 void Texture::SetScaleMode(TextureScaleMode mode) {
 	if (!impl || !impl->texture) return;
 	SDL_SetTextureScaleMode(impl->texture, ToSDLScaleMode(mode));
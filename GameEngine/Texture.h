@@ -26,6 +26,13 @@ public:
 	// Constructor Vector3i color key
 	Texture(Renderer& renderer, const std::string& filePath, bool useColorKey, const Vector3i& colorKey);
 
+	// Upload an already decoded surface (e.g. one loaded on a worker thread). Must run on the render thread.
+	Texture(Renderer& renderer, const Surface& surface);
+
+	// Upload raw RGBA8 pixels (R first in memory) in one SDL_UpdateTexture, e.g. a baked texture from an asset pack.
+	// Premultiplied pixels are drawn with premultiplied blending. Must run on the render thread.
+	Texture(Renderer& renderer, const void* rgbaPixels, const Vector2i& size, int pitch, bool premultipliedAlpha);
+
 	// Destructor
 	~Texture();
 
@@ -41,6 +48,9 @@ public:
 	Vector2i GetSize() const;
 	void* GetNative() const;
 	bool IsValid() const;
+	bool IsPremultiplied() const;
+	// Estimated GPU memory: bytes per pixel of the texture format x width x height.
+	size_t GetByteSize() const;
 
 	// Filtering
 	void SetScaleMode(TextureScaleMode mode);
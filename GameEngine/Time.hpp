@@ -36,6 +36,7 @@ public:
 		instance.m_elapsedTime = 0.0f;
 		instance.m_elapsedFixedTime = 0.0f;
 		instance.m_accumulator = 0.0f;
+		instance.m_droppedFixedSteps = 0;
 
 		instance.m_frameCount = 0;
 		instance.m_fps = 0.0f;
@@ -73,6 +74,17 @@ public:
 			instance.m_accumulator += instance.m_deltaTime;
 		}
 
+		// Spiral-of-death guard: running every owed step after a long frame makes the next frame
+		// longer still, so whole steps beyond the cap are dropped (the partial step is kept).
+		instance.m_droppedFixedSteps = 0;
+		if (instance.m_maxFixedStepsPerFrame > 0 && instance.m_fixedDeltaTime > 0.0f) {
+			const int owed = static_cast<int>(instance.m_accumulator / instance.m_fixedDeltaTime);
+			if (owed > instance.m_maxFixedStepsPerFrame) {
+				instance.m_droppedFixedSteps = owed - instance.m_maxFixedStepsPerFrame;
+				instance.m_accumulator -= static_cast<float>(instance.m_droppedFixedSteps) * instance.m_fixedDeltaTime;
+			}
+		}
+
 		// FPS calculation uses unscaled time.
 		instance.m_frameCount++;
 		instance.m_fpsTimer += instance.m_unscaledDeltaTime;
@@ -97,6 +109,9 @@ public:
 		return static_cast<int>(instance.m_accumulator / instance.m_fixedDeltaTime);
 	}
 
+	// Whole fixed steps the cap discarded this frame (see SetMaxFixedStepsPerFrame)
+	static int DroppedFixedSteps() { return Instance().m_droppedFixedSteps; }
+
 	static void ConsumeFixedStep() {
 		Time& instance = Instance();
 		instance.m_accumulator -= instance.m_fixedDeltaTime;
@@ -117,6 +132,12 @@ public:
 	static float UnscaledElapsedTime() { return Instance().m_unscaledElapsedTime; }
 	static float ElapsedFixedTime() { return Instance().m_elapsedFixedTime; }
 	static float Accumulator() { return Instance().m_accumulator; }
+	// How far the frame is into the next fixed step [0, 1], for render interpolation
+	static float FixedStepAlpha() {
+		const Time& instance = Instance();
+		if (instance.m_fixedDeltaTime <= 0.0f) return 1.0f;
+		return std::clamp(instance.m_accumulator / instance.m_fixedDeltaTime, 0.0f, 1.0f);
+	}
 
 	static float FPS() { return Instance().m_fps; }
 	static float TargetFPS() { return Instance().m_targetFPS; }
@@ -169,6 +190,8 @@ public:
 	// --- Setters ---
 	static void SetFixedDeltaTime(float dt) { Instance().m_fixedDeltaTime = dt; }
 	static void SetMaxDeltaTime(float dt) { Instance().m_maxDeltaTime = dt; }
+	// Most fixed steps a single frame may run; 0 = no cap.
+	static void SetMaxFixedStepsPerFrame(int steps) { Instance().m_maxFixedStepsPerFrame = std::max(0, steps); }
 
 	static void SetTargetFPS(float fps) {
 		Time& instance = Instance();
@@ -227,6 +250,8 @@ private:
 	float m_elapsedTime = 0.0f;
 	float m_elapsedFixedTime = 0.0f;
 	float m_accumulator = 0.0f;
+	int m_maxFixedStepsPerFrame = 0;
+	int m_droppedFixedSteps = 0;
 
 	float m_timeScale = 1.0f;
 
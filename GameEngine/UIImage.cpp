@@ -1,11 +1,19 @@
 #include "UIImage.h"
 
+#include "AssetManager.h"
 #include "Renderer.h"
+#include "SleeplessEngine.h"
 #include "Texture.h"
 
 UIImage::UIImage() : UIElement() {
 }
 
+void UIImage::SetTexture(Texture* tex) {
+	m_texture = tex;
+	AssetManager* assets = SleeplessEngine::GetInstance().GetAssetManager();
+	m_textureHandle = assets ? assets->Retain(tex) : AssetHandle<Texture>{};
+}
+
 void UIImage::Render(Renderer& renderer) {
 	if (!m_texture) return;
 
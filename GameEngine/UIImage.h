@@ -1,5 +1,6 @@
 #pragma once
 
+#include "AssetHandle.h"
 #include "UIElement.h"
 #include "Types.hpp"
 
@@ -13,7 +14,7 @@ public:
 	UIImage();
 	~UIImage() override = default;
 
-	void SetTexture(Texture* tex) { m_texture = tex; }
+	void SetTexture(Texture* tex);
 	Texture* GetTexture() const { return m_texture; }
 
 	// Source rectangle in pixels inside the texture.
@@ -28,6 +29,7 @@ public:
 
 private:
 	Texture* m_texture = nullptr; // not owned
+	AssetHandle<Texture> m_textureHandle; // keeps an AssetManager texture from being evicted
 	bool m_hasSource = false;
 	Vector2f m_srcPos{ 0.0f, 0.0f };
 	Vector2f m_srcSize{ 0.0f, 0.0f };
@@ -1,12 +1,20 @@
 #include "UILabel.h"
 
+#include "AssetManager.h"
 #include "BitmapFont.h"
 #include "Renderer.h"
+#include "SleeplessEngine.h"
 
 UILabel::UILabel() : UIElement() {
 	SetInteractable(false);
 }
 
+void UILabel::SetFont(BitmapFont* font) {
+	m_font = font;
+	AssetManager* assets = SleeplessEngine::GetInstance().GetAssetManager();
+	m_fontHandle = assets ? assets->Retain(font) : AssetHandle<BitmapFont>{};
+}
+
 void UILabel::Render(Renderer& renderer) {
 	if (!m_font) return;
 
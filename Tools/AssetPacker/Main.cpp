@@ -0,0 +1,224 @@
+// AssetPacker: builds an asset pack (.pak) from a directory of loose files.
+//
+//   AssetPacker <inputDir> <output.pak> [--ext .bmp,.wav] [--bake-color-key r,g,b [--straight-alpha]]
+//
+// Entries are keyed by their path relative to <inputDir>, so AssetManager finds them with the
+// same relative paths it would use for loose files (e.g. "Ship2.bmp").
+//
+// --bake-color-key also stores every BMP as upload-ready RGBA (see BakedTextureFormat.h) with that
+// color key applied and alpha premultiplied (unless --straight-alpha). AssetManager uses the baked
+// entry for LoadTexture(path, colorKey) with the same key and falls back to the BMP otherwise.
+#include <GameEngine/AssetPackFormat.h>
+#include <GameEngine/BakedTextureFormat.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+using namespace AssetPackFormat;
+
+namespace {
+	struct PackInput {
+		fs::path file;
+		std::string key; // normalized relative path
+		std::uint64_t hash = 0;
+		std::uint64_t size = 0;
+		std::uint64_t offset = 0;
+		std::vector<char> data; // generated entries (baked textures); empty = copy 'file'
+	};
+
+	struct BakeOptions {
+		bool enabled = false;
+		int colorKey[3] = { 0, 0, 0 };
+		bool premultiply = true;
+	};
+
+	bool ReadFile(const fs::path& path, std::vector<char>& out) {
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file) return false;
+		out.resize(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+		return static_cast<bool>(file.read(out.data(), static_cast<std::streamsize>(out.size())));
+	}
+
+	// Baked entry for 'bmpInput', or false if the BMP can't be baked (it is still packed as-is).
+	bool BakeTexture(const PackInput& bmpInput, const BakeOptions& options, PackInput& out) {
+		std::vector<char> bmp;
+		std::vector<std::uint8_t> blob;
+		std::string error;
+		if (!ReadFile(bmpInput.file, bmp) || !BakedTextureFormat::Bake(std::span(reinterpret_cast<const std::uint8_t*>(bmp.data()), bmp.size()),
+				static_cast<std::uint8_t>(options.colorKey[0]), static_cast<std::uint8_t>(options.colorKey[1]), static_cast<std::uint8_t>(options.colorKey[2]),
+				options.premultiply, blob, error)) {
+			std::cerr << "  not baking " << bmpInput.key << ": " << (error.empty() ? "read failed" : error) << "\n";
+			return false;
+		}
+
+		out.file = bmpInput.file;
+		out.key = bmpInput.key + " [baked]";
+		out.hash = AssetIds::BakedTexture(AssetIds::WithColorKey(bmpInput.hash, options.colorKey[0], options.colorKey[1], options.colorKey[2]));
+		out.data.assign(blob.begin(), blob.end());
+		out.size = out.data.size();
+		return true;
+	}
+
+	bool ParseColorKey(const std::string& text, int (&rgb)[3]) {
+		return std::sscanf(text.c_str(), "%d,%d,%d", &rgb[0], &rgb[1], &rgb[2]) == 3
+			&& rgb[0] >= 0 && rgb[0] <= 255 && rgb[1] >= 0 && rgb[1] <= 255 && rgb[2] >= 0 && rgb[2] <= 255;
+	}
+
+	std::vector<std::string> SplitExtensions(const std::string& list) {
+		std::vector<std::string> out;
+		size_t start = 0;
+		while (start <= list.size()) {
+			const size_t comma = list.find(',', start);
+			std::string ext = NormalizePath(list.substr(start, comma == std::string::npos ? std::string::npos : comma - start));
+			if (!ext.empty()) {
+				if (ext.front() != '.') ext.insert(ext.begin(), '.');
+				out.push_back(ext);
+			}
+			if (comma == std::string::npos) break;
+			start = comma + 1;
+		}
+		return out;
+	}
+
+	int PrintUsage() {
+		std::cerr << "Usage: AssetPacker <inputDir> <output.pak> [--ext .bmp,.wav] [--bake-color-key r,g,b [--straight-alpha]]\n";
+		return 1;
+	}
+}
+
+int main(int argc, char** argv) {
+	if (argc < 3) {
+		return PrintUsage();
+	}
+
+	const fs::path inputDir = argv[1];
+	const fs::path outputPath = argv[2];
+	std::vector<std::string> extensions = { ".bmp", ".wav" };
+	BakeOptions bake;
+
+	for (int i = 3; i < argc; ++i) {
+		const std::string arg = argv[i];
+		if (arg == "--ext" && i + 1 < argc) {
+			extensions = SplitExtensions(argv[++i]);
+		}
+		else if (arg == "--bake-color-key" && i + 1 < argc) {
+			if (!ParseColorKey(argv[++i], bake.colorKey)) {
+				return PrintUsage();
+			}
+			bake.enabled = true;
+		}
+		else if (arg == "--straight-alpha") {
+			bake.premultiply = false;
+		}
+		else {
+			return PrintUsage();
+		}
+	}
+
+	if (!fs::is_directory(inputDir)) {
+		std::cerr << "Input directory not found: " << inputDir.string() << "\n";
+		return 1;
+	}
+
+	// Collect files
+	std::vector<PackInput> inputs;
+	for (const auto& entry : fs::recursive_directory_iterator(inputDir)) {
+		if (!entry.is_regular_file()) continue;
+
+		const std::string ext = NormalizePath(entry.path().extension().string());
+		if (std::find(extensions.begin(), extensions.end(), ext) == extensions.end()) continue;
+
+		PackInput in;
+		in.file = entry.path();
+		in.key = NormalizePath(fs::relative(entry.path(), inputDir).generic_string());
+		in.hash = AssetIds::FromPath(in.key);
+		in.size = static_cast<std::uint64_t>(entry.file_size());
+		inputs.push_back(std::move(in));
+
+		PackInput baked;
+		if (bake.enabled && ext == ".bmp" && BakeTexture(inputs.back(), bake, baked)) {
+			inputs.push_back(std::move(baked));
+		}
+	}
+
+	if (inputs.empty()) {
+		std::cerr << "No matching files in " << inputDir.string() << "\n";
+		return 1;
+	}
+
+	// Sorted table of contents; the reader binary-searches it.
+	std::sort(inputs.begin(), inputs.end(), [](const PackInput& a, const PackInput& b) { return a.hash < b.hash; });
+	for (size_t i = 1; i < inputs.size(); ++i) {
+		if (inputs[i - 1].hash == inputs[i].hash) {
+			std::cerr << "Path hash collision between '" << inputs[i - 1].key << "' and '" << inputs[i].key << "'\n";
+			return 1;
+		}
+	}
+
+	// Layout: header, TOC, aligned blobs
+	Header header;
+	header.entryCount = static_cast<std::uint32_t>(inputs.size());
+	header.tocOffset = sizeof(Header);
+
+	std::uint64_t cursor = AlignUp(header.tocOffset + inputs.size() * sizeof(TocEntry));
+	for (auto& in : inputs) {
+		in.offset = cursor;
+		cursor = AlignUp(cursor + in.size);
+	}
+
+	std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+	if (!out) {
+		std::cerr << "Cannot open output: " << outputPath.string() << "\n";
+		return 1;
+	}
+
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	for (const auto& in : inputs) {
+		TocEntry toc;
+		toc.pathHash = in.hash;
+		toc.offset = in.offset;
+		toc.size = in.size;
+		out.write(reinterpret_cast<const char*>(&toc), sizeof(toc));
+	}
+
+	std::vector<char> buffer;
+	for (const auto& in : inputs) {
+		// Pad up to the blob's aligned offset
+		const std::uint64_t pos = static_cast<std::uint64_t>(out.tellp());
+		if (pos < in.offset) {
+			const std::vector<char> zeros(static_cast<size_t>(in.offset - pos), 0);
+			out.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+		}
+
+		if (in.data.empty()) {
+			std::ifstream file(in.file, std::ios::binary);
+			buffer.resize(static_cast<size_t>(in.size));
+			if (!file || !file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
+				std::cerr << "Failed to read " << in.file.string() << "\n";
+				return 1;
+			}
+			out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+		}
+		else {
+			out.write(in.data.data(), static_cast<std::streamsize>(in.data.size()));
+		}
+		std::cout << "  " << in.key << " (" << in.size << " bytes)\n";
+	}
+
+	if (!out) {
+		std::cerr << "Failed writing " << outputPath.string() << "\n";
+		return 1;
+	}
+
+	std::cout << "Packed " << inputs.size() << " files into " << outputPath.string()
+		<< " (" << static_cast<std::uint64_t>(out.tellp()) << " bytes)\n";
+	return 0;
+}
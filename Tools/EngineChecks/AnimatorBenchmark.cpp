@@ -0,0 +1,197 @@
+// Runs 5000 Animators on one character-style controller (Idle / Run / Jump / Hit, with float, bool,
+// trigger and exit-time transitions), drives their parameters by cached id every frame the way
+// gameplay code does, and times AnimationSystem::Update: on the calling thread, then split across
+// a JobSystem. Afterwards every Animator is steered into a known state to check the transitions
+// were actually evaluated. Also compares a parameter set/get by name with one by cached id.
+#include "EngineChecks.h"
+
+#include <GameEngine/Animator.h>
+#include <GameEngine/JobSystem.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+	constexpr int kAnimators = 5000;
+	constexpr int kWarmupFrames = 60;
+	constexpr int kMeasuredFrames = 600;
+	constexpr float kDeltaTime = 1.0f / 60.0f;
+	constexpr int kLookups = 1000000;
+
+	enum State { Idle, Run, Jump, Hit, StateCount };
+
+	struct Params {
+		AnimParamId speed = kInvalidAnimParam;
+		AnimParamId grounded = kInvalidAnimParam;
+		AnimParamId hit = kInvalidAnimParam;
+	};
+
+	AnimationClip MakeClip(const char* name, int frameCount, bool loop) {
+		AnimationClip clip;
+		clip.name = name;
+		clip.loop = loop;
+		for (int i = 0; i < frameCount; ++i) clip.frames.push_back(i);
+		return clip;
+	}
+
+	AnimTransition MakeTransition(int from, int to, const char* param = nullptr, AnimCondOp op = AnimCondOp::BoolTrue, float f = 0.0f) {
+		AnimTransition tr;
+		tr.fromState = from;
+		tr.toState = to;
+		if (param) tr.conditions.push_back({ param, op, f });
+		return tr;
+	}
+
+	AnimatorController MakeController(const std::vector<AnimationClip>& clips) {
+		AnimatorController controller;
+		controller.parameters.push_back({ "speed", AnimParamType::Float });
+		controller.parameters.push_back({ "grounded", AnimParamType::Bool, 0.0f, 0, true });
+		controller.parameters.push_back({ "hit", AnimParamType::Trigger });
+
+		const char* names[StateCount] = { "Idle", "Run", "Jump", "Hit" };
+		for (int s = 0; s < StateCount; ++s) {
+			controller.states.push_back({ s, names[s], &clips[static_cast<size_t>(s)] });
+		}
+		controller.entryState = Idle;
+
+		controller.transitions.push_back(MakeTransition(-1, Hit, "hit", AnimCondOp::TriggerSet));
+		controller.transitions.push_back(MakeTransition(Idle, Run, "speed", AnimCondOp::FloatGreater, 0.5f));
+		controller.transitions.push_back(MakeTransition(Idle, Jump, "grounded", AnimCondOp::BoolFalse));
+		controller.transitions.push_back(MakeTransition(Run, Idle, "speed", AnimCondOp::FloatLessEq, 0.5f));
+		controller.transitions.push_back(MakeTransition(Run, Jump, "grounded", AnimCondOp::BoolFalse));
+		controller.transitions.push_back(MakeTransition(Jump, Idle, "grounded", AnimCondOp::BoolTrue));
+		AnimTransition recover = MakeTransition(Hit, Idle);
+		recover.hasExitTime = true;
+		recover.exitTimeNormalized = 1.0f;
+		controller.transitions.push_back(recover);
+		return controller;
+	}
+
+	// Staggered per Animator so every frame some of them run, stop, jump, land and get hit.
+	void Drive(const std::vector<std::shared_ptr<Animator>>& animators, const Params& params, int frame) {
+		for (int a = 0; a < static_cast<int>(animators.size()); ++a) {
+			Animator& animator = *animators[static_cast<size_t>(a)];
+			const int t = frame + a;
+			animator.SetFloat(params.speed, (t % 40) < 20 ? 1.0f : 0.0f);
+			animator.SetBool(params.grounded, (t % 120) >= 10);
+			if (t % 97 == 0) animator.SetTrigger(params.hit);
+		}
+	}
+
+	double TimeFrames(const std::vector<std::shared_ptr<Animator>>& animators, const Params& params, JobSystem* jobs, int& frame) {
+		for (int i = 0; i < kWarmupFrames; ++i, ++frame) {
+			Drive(animators, params, frame);
+			AnimationSystem::Get().Update(kDeltaTime, jobs, 1);
+		}
+		double totalMs = 0.0;
+		for (int i = 0; i < kMeasuredFrames; ++i, ++frame) {
+			Drive(animators, params, frame);
+			const auto start = std::chrono::steady_clock::now();
+			AnimationSystem::Get().Update(kDeltaTime, jobs, 1);
+			totalMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+		return totalMs / kMeasuredFrames;
+	}
+
+	// Settles everyone into Run (Hit waits out its exit time, Jump lands, Idle starts running), then
+	// fires the trigger on all of them with the speed dropped: the Any State transition must win.
+	bool CheckStates(const std::vector<std::shared_ptr<Animator>>& animators, const Params& params) {
+		for (int i = 0; i < 60; ++i) {
+			for (const auto& animator : animators) {
+				animator->SetFloat(params.speed, 1.0f);
+				animator->SetBool(params.grounded, true);
+			}
+			AnimationSystem::Get().Update(kDeltaTime, nullptr, 0);
+		}
+		const auto inState = [&](const char* name) {
+			return static_cast<int>(std::count_if(animators.begin(), animators.end(),
+				[name](const auto& animator) { return animator->GetCurrentStateName() == name; }));
+		};
+		const int running = inState("Run");
+
+		for (const auto& animator : animators) {
+			animator->SetFloat(params.speed, 0.0f);
+			animator->SetTrigger(params.hit);
+		}
+		AnimationSystem::Get().Update(kDeltaTime, nullptr, 0);
+		const int hit = inState("Hit");
+		const bool triggersCleared = std::none_of(animators.begin(), animators.end(),
+			[&](const auto& animator) { return animator->GetTrigger(params.hit); });
+
+		const bool ok = running == kAnimators && hit == kAnimators && triggersCleared;
+		std::printf("  transitions: %d/%d settled in Run, %d/%d took the Hit trigger, triggers %s: %s\n",
+			running, kAnimators, hit, kAnimators, triggersCleared ? "cleared" : "left set", ok ? "ok" : "MISMATCH");
+		return ok;
+	}
+
+	bool CheckParameterLookups(Animator& animator) {
+		const AnimParamId speed = animator.GetParameterId("speed");
+		if (speed == kInvalidAnimParam || animator.GetParameterId("missing") != kInvalidAnimParam) {
+			std::printf("  parameter ids: wrong id for a declared or unknown name\n");
+			return false;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+		float byName = 0.0f;
+		for (int i = 0; i < kLookups; ++i) {
+			animator.SetFloat("speed", static_cast<float>(i & 1));
+			byName += animator.GetFloat("speed");
+		}
+		const auto mid = std::chrono::steady_clock::now();
+		float byId = 0.0f;
+		for (int i = 0; i < kLookups; ++i) {
+			animator.SetFloat(speed, static_cast<float>(i & 1));
+			byId += animator.GetFloat(speed);
+		}
+		const auto end = std::chrono::steady_clock::now();
+
+		const double nameNs = std::chrono::duration<double, std::nano>(mid - start).count() / (2.0 * kLookups);
+		const double idNs = std::chrono::duration<double, std::nano>(end - mid).count() / (2.0 * kLookups);
+		std::printf("  parameter set/get: %.2f ns by name, %.2f ns by id\n", nameNs, idNs);
+		if (byName != byId) {
+			std::printf("  name and id loops disagree: %.0f vs %.0f\n", byName, byId);
+			return false;
+		}
+		return true;
+	}
+}
+
+bool RunAnimatorBenchmark() {
+	std::vector<AnimationClip> clips;
+	clips.push_back(MakeClip("Idle", 4, true));
+	clips.push_back(MakeClip("Run", 8, true));
+	clips.push_back(MakeClip("Jump", 6, true));
+	clips.push_back(MakeClip("Hit", 4, false));
+	AnimatorController controller = MakeController(clips);
+	controller.Compile();
+
+	std::vector<std::shared_ptr<Animator>> animators;
+	animators.reserve(kAnimators);
+	for (int i = 0; i < kAnimators; ++i) {
+		auto animator = std::make_shared<Animator>();
+		animator->SetController(&controller);
+		animator->OnEnable();
+		animators.push_back(std::move(animator));
+	}
+
+	Params params;
+	params.speed = controller.FindParameterId("speed");
+	params.grounded = controller.FindParameterId("grounded");
+	params.hit = controller.FindParameterId("hit");
+
+	int frame = 0;
+	const double serialMs = TimeFrames(animators, params, nullptr, frame);
+	JobSystem jobs;
+	const double jobsMs = TimeFrames(animators, params, &jobs, frame);
+	std::printf("  %d animators, %d frames: %.3f ms/frame on one thread (%.1f ns per animator)\n",
+		kAnimators, kMeasuredFrames, serialMs, serialMs * 1e6 / kAnimators);
+	std::printf("  with %d job worker(s): %.3f ms/frame\n", jobs.GetWorkerCount(), jobsMs);
+
+	const bool statesOk = CheckStates(animators, params);
+	const bool lookupsOk = CheckParameterLookups(*animators.front());
+	return statesOk && lookupsOk;
+}
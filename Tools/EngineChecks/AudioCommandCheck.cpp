@@ -0,0 +1,161 @@
+// Drives the Audio voice API from the game thread at a steady 100k commands/s, with a burst of three
+// queues' worth every half second so the mixer queue fills and commands spill into the overflow
+// that Audio::Update flushes. Every Play uses an empty clip, which the mixer reports finished as
+// soon as it applies the command, so the game thread can follow each voice's play serials: they
+// must never go backwards, and after each burst (once the next frame has posted behind the still
+// full overflow) every voice must end on the last Play posted to it. A command that overtook the
+// overflow would leave its voice on an older serial. Runs on SDL's dummy audio driver, so no sound
+// device is needed.
+#include "EngineChecks.h"
+
+#include <GameEngine/Audio.h>
+#include <GameEngine/AudioClip.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <thread>
+#include <vector>
+
+namespace {
+	constexpr double kCommandsPerSecond = 100000.0;
+	constexpr int kFrames = 180; // 3 s at 60 Hz
+	constexpr int kBurstEveryFrames = 30;
+	constexpr int kBurstCommands = 3 * 4096; // three times the mixer queue (kCommandQueueCapacity)
+	constexpr auto kFrameTime = std::chrono::microseconds(16667);
+	constexpr auto kSettleTimeout = std::chrono::seconds(1);
+
+	// Play serials posted to one voice that the mixer has not been seen to reach yet. The front is
+	// the last one seen; the voice's finished serial may only move towards the back.
+	struct VoiceTrack {
+		int voice = Audio::kInvalidVoice;
+		std::deque<std::uint32_t> pending;
+		bool seenAny = false;
+	};
+
+	// Returns false if the mixer's finished serial is not in the window: it went backwards.
+	bool Observe(VoiceTrack& track) {
+		for (size_t i = 0; i < track.pending.size(); ++i) {
+			if (!Audio::IsVoicePlaying(track.voice, track.pending[i])) {
+				track.pending.erase(track.pending.begin(), track.pending.begin() + static_cast<std::ptrdiff_t>(i));
+				track.seenAny = true;
+				return true;
+			}
+		}
+		return !track.seenAny;
+	}
+
+	void Post(VoiceTrack& track, const AudioClip& clip, std::uint64_t index) {
+		switch (index % 4) {
+		case 0:
+		case 2:
+			track.pending.push_back(Audio::PlayVoice(track.voice, &clip, false, 1.0f, 1.0f));
+			break;
+		case 1:
+			Audio::SetVoiceGain(track.voice, static_cast<float>(index % 7) / 7.0f);
+			break;
+		default:
+			Audio::SetVoicePan(track.voice, static_cast<float>(index % 5) / 2.0f - 1.0f);
+			break;
+		}
+	}
+
+	// Stops posting until every voice has reached the last Play posted to it (Update flushes the
+	// overflow meanwhile). False if the order check fails or a voice is still behind at the timeout.
+	bool Settle(std::vector<VoiceTrack>& tracks) {
+		const auto start = std::chrono::steady_clock::now();
+		while (std::chrono::steady_clock::now() - start < kSettleTimeout) {
+			Audio::Update();
+			bool settled = true;
+			for (VoiceTrack& track : tracks) {
+				if (!Observe(track)) return false;
+				settled = settled && track.pending.size() <= 1;
+			}
+			if (settled) return true;
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		return false;
+	}
+}
+
+bool RunAudioCommandCheck() {
+	SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+	if (!Audio::Initialize()) {
+		std::printf("  could not start audio on the dummy driver\n");
+		return false;
+	}
+
+	// Mixer format, no samples: applying the Play finishes it at once.
+	AudioClip clip;
+	clip.name = "empty";
+	clip.spec = Audio::GetMixSpec();
+
+	std::vector<VoiceTrack> tracks;
+	for (int voice = Audio::AcquireVoice(); voice != Audio::kInvalidVoice; voice = Audio::AcquireVoice()) {
+		tracks.push_back({ voice, {}, false });
+	}
+
+	bool ok = !tracks.empty();
+	std::uint64_t posted = 0;
+	std::uint64_t paced = 0;
+	size_t peakOverflow = 0;
+	int overflowFrames = 0;
+	int settles = 0;
+	const auto start = std::chrono::steady_clock::now();
+	for (int frame = 0; frame < kFrames && ok; ++frame) {
+		const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		std::uint64_t count = static_cast<std::uint64_t>(elapsed * kCommandsPerSecond) - paced;
+		paced += count;
+		if (frame % kBurstEveryFrames == kBurstEveryFrames - 1) {
+			count += kBurstCommands;
+		}
+		for (std::uint64_t i = 0; i < count; ++i, ++posted) {
+			Post(tracks[posted % tracks.size()], clip, posted / tracks.size());
+		}
+
+		Audio::Update();
+		const size_t overflow = Audio::GetPendingCommandCount();
+		peakOverflow = std::max(peakOverflow, overflow);
+		overflowFrames += overflow > 0 ? 1 : 0;
+
+		for (VoiceTrack& track : tracks) {
+			if (!Observe(track)) {
+				std::printf("  voice %d: finished serial went backwards (commands reordered)\n", track.voice);
+				ok = false;
+				break;
+			}
+		}
+
+		// The frame after a burst posted behind the overflow; the last posts must also land last.
+		if (ok && frame % kBurstEveryFrames == 0 && frame > 0) {
+			++settles;
+			if (!Settle(tracks)) {
+				std::printf("  frame %d: a voice did not end on its last Play (commands overtook the overflow)\n", frame);
+				ok = false;
+			}
+		}
+		std::this_thread::sleep_until(start + kFrameTime * (frame + 1));
+	}
+
+	// Everything posted must reach the mixer: each voice ends on its last Play.
+	const bool settled = ok && Settle(tracks);
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	for (const VoiceTrack& track : tracks) {
+		Audio::ReleaseVoice(track.voice);
+	}
+	Audio::Shutdown();
+
+	std::printf("  %llu commands over %zu voices in %.2f s (%.0f/s)\n", static_cast<unsigned long long>(posted),
+		tracks.size(), seconds, static_cast<double>(posted) / seconds);
+	std::printf("  overflow: used on %d/%d frames, peak %zu commands; %d post-burst order checks\n", overflowFrames, kFrames, peakOverflow, settles);
+	if (ok && !settled) {
+		std::printf("  the last commands never reached the mixer\n");
+	}
+	if (ok && overflowFrames == 0) {
+		std::printf("  the mixer queue never filled, so the overflow path was not exercised\n");
+	}
+	return ok && settled && overflowFrames > 0;
+}
@@ -0,0 +1,116 @@
+// Bakes color-keyed BMPs the way AssetPacker --bake-color-key does (BakedTextureFormat::Bake), once
+// with straight and once with premultiplied alpha, and compares the pixels with what the runtime
+// makes of the same file: Surface::FromBmp with the key, converted to RGBA32. The straight bake must
+// match byte for byte; the premultiplied one must match the runtime pixels put through
+// PremultiplyAlpha, which is what the premultiplied blend mode then draws.
+#include "EngineChecks.h"
+#include "TestBmp.h"
+
+#include <GameEngine/BakedTextureFormat.h>
+#include <GameEngine/Surface.h>
+#include <SDL3/SDL.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <vector>
+
+namespace {
+	struct BakeCase {
+		const char* name;
+		int bitsPerPixel;
+	};
+
+	constexpr BakeCase kBakeCases[] = {
+		{ "pal8", 8 },
+		{ "bgr24", 24 },
+	};
+
+	// Tightly packed RGBA8 of Surface::FromBmp(bmp, key), or empty if it failed.
+	std::vector<std::uint8_t> DecodeAtRuntime(const std::vector<std::uint8_t>& bmp, const char* what) {
+		const Vector3i magenta(255, 0, 255);
+		std::vector<std::uint8_t> rgba;
+		try {
+			Surface surface = Surface::FromBmp(bmp.data(), bmp.size(), &magenta, what);
+			SDL_Surface* converted = SDL_ConvertSurface(static_cast<SDL_Surface*>(surface.GetNative()), SDL_PIXELFORMAT_RGBA32);
+			if (!converted) {
+				std::printf("  %s: could not convert the runtime surface: %s\n", what, SDL_GetError());
+				return rgba;
+			}
+			const size_t rowBytes = static_cast<size_t>(converted->w) * 4;
+			rgba.resize(rowBytes * static_cast<size_t>(converted->h));
+			for (int y = 0; y < converted->h; ++y) {
+				std::memcpy(rgba.data() + y * rowBytes, static_cast<const std::uint8_t*>(converted->pixels) + static_cast<size_t>(y) * converted->pitch, rowBytes);
+			}
+			SDL_DestroySurface(converted);
+		}
+		catch (const std::exception& e) {
+			std::printf("  %s: Surface::FromBmp failed: %s\n", what, e.what());
+		}
+		return rgba;
+	}
+
+	bool CompareBake(const char* what, bool premultiply, int width, int height, const std::vector<std::uint8_t>& bmp, const std::vector<std::uint8_t>& expected) {
+		std::vector<std::uint8_t> blob;
+		std::string error;
+		if (!BakedTextureFormat::Bake(bmp, 255, 0, 255, premultiply, blob, error)) {
+			std::printf("  %s: bake failed: %s\n", what, error.c_str());
+			return false;
+		}
+
+		const BakedTextureFormat::Header* header = BakedTextureFormat::Parse(blob);
+		const std::uint32_t flags = premultiply ? static_cast<std::uint32_t>(BakedTextureFormat::kPremultipliedAlpha) : 0u;
+		if (!header || header->width != static_cast<std::uint32_t>(width) || header->height != static_cast<std::uint32_t>(height) || header->flags != flags) {
+			std::printf("  %s: baked header does not describe a %dx%d %s texture\n", what, width, height, premultiply ? "premultiplied" : "straight");
+			return false;
+		}
+
+		const std::uint8_t* pixels = BakedTextureFormat::Pixels(header);
+		for (int y = 0; y < height; ++y) {
+			const std::uint8_t* baked = pixels + static_cast<size_t>(y) * header->pitch;
+			const std::uint8_t* runtime = expected.data() + static_cast<size_t>(y) * width * 4;
+			for (int i = 0; i < width * 4; ++i) {
+				if (baked[i] != runtime[i]) {
+					std::printf("  %s %s: pixel (%d, %d) byte %d differs (runtime %u, baked %u)\n",
+						what, premultiply ? "premultiplied" : "straight", i / 4, y, i % 4, runtime[i], baked[i]);
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+}
+
+bool RunBmpBakeCheck() {
+	constexpr int kWidths[] = { 1, 37, 258 };
+	constexpr int kHeight = 23;
+	int files = 0;
+	for (const BakeCase& bakeCase : kBakeCases) {
+		for (const int width : kWidths) {
+			for (const bool topDown : { false, true }) {
+				const std::vector<std::uint8_t> bmp = MakeTestBmp(width, kHeight, bakeCase.bitsPerPixel, topDown, false,
+					static_cast<std::uint32_t>(width * 17 + bakeCase.bitsPerPixel));
+				char what[64];
+				std::snprintf(what, sizeof(what), "%s %dx%d %s", bakeCase.name, width, kHeight, topDown ? "top-down" : "bottom-up");
+
+				std::vector<std::uint8_t> runtime = DecodeAtRuntime(bmp, what);
+				if (runtime.size() != static_cast<size_t>(width) * kHeight * 4) {
+					if (!runtime.empty()) std::printf("  %s: runtime surface has the wrong size\n", what);
+					return false;
+				}
+				if (!CompareBake(what, false, width, kHeight, bmp, runtime)) {
+					return false;
+				}
+				BakedTextureFormat::PremultiplyAlpha(runtime.data(), runtime.size() / 4);
+				if (!CompareBake(what, true, width, kHeight, bmp, runtime)) {
+					return false;
+				}
+				++files;
+			}
+		}
+	}
+	std::printf("  straight and premultiplied bakes match Surface::FromBmp + key on %d files (8/24-bit, both row orders)\n", files);
+	return true;
+}
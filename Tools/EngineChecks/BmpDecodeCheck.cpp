@@ -0,0 +1,248 @@
+// Checks that every PixelConvertKernels set the CPU supports writes exactly the bytes of the scalar
+// reference for BMP rows (24-bit BGR and 32-bit BGRA/BGRX, with and without a color key), then
+// times each set on a 2048x2048 image. Rows are allocated to their exact size, so widths around
+// the vector lengths also exercise the overread guards (run under a sanitizer to catch any).
+// Whole files decoded by Surface::FromBmp's fast path must also match what SDL gives for the same
+// file (SDL_LoadBMP_IO, SDL_SetSurfaceColorKey, SDL_ConvertSurface to RGBA32), and both are timed.
+#include "EngineChecks.h"
+#include "TestBmp.h"
+
+#include <GameEngine/PixelConvertKernels.h>
+#include <GameEngine/Surface.h>
+#include <SDL3/SDL.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <vector>
+
+namespace {
+	constexpr int kMaxCheckedWidth = 67;
+	constexpr int kRowsPerWidth = 8;
+
+	struct Lcg {
+		std::uint32_t state = 0xC0FFEE11u;
+		std::uint8_t Next() {
+			state = state * 1664525u + 1013904223u;
+			return static_cast<std::uint8_t>(state >> 24);
+		}
+	};
+
+	// Random pixels with every few one painted the key color (magenta), so keyed and unkeyed
+	// pixels sit side by side in every vector.
+	std::vector<std::uint8_t> MakeRow(Lcg& rng, int pixels, int bytesPerPixel) {
+		std::vector<std::uint8_t> row(static_cast<size_t>(pixels) * bytesPerPixel);
+		for (int p = 0; p < pixels; ++p) {
+			std::uint8_t* px = row.data() + static_cast<size_t>(p) * bytesPerPixel;
+			for (int c = 0; c < bytesPerPixel; ++c) px[c] = rng.Next();
+			if (rng.Next() % 3 == 0) {
+				px[0] = 255; px[1] = 0; px[2] = 255; // BGR magenta
+			}
+		}
+		return row;
+	}
+
+	bool CompareRow(const char* what, const PixelConvertKernels& kernels, int width, const std::vector<std::uint8_t>& expected, const std::vector<std::uint8_t>& got) {
+		if (expected.empty() || std::memcmp(expected.data(), got.data(), expected.size()) == 0) {
+			return true;
+		}
+		for (size_t i = 0; i < expected.size(); ++i) {
+			if (expected[i] != got[i]) {
+				std::printf("  %s %s: width %d differs at pixel %zu byte %zu (scalar %u, got %u)\n",
+					kernels.name, what, width, i / 4, i % 4, expected[i], got[i]);
+				break;
+			}
+		}
+		return false;
+	}
+
+	bool CheckEquivalence(const PixelConvertKernels& scalar, const PixelConvertKernels& kernels) {
+		const std::uint32_t keys[] = { PixelConvertKernels::kNoColorKey, PixelConvertKernels::PackKey(255, 0, 255) };
+		Lcg rng;
+		int rows = 0;
+		for (int width = 0; width <= kMaxCheckedWidth; ++width) {
+			for (int r = 0; r < kRowsPerWidth; ++r) {
+				const std::vector<std::uint8_t> bgr = MakeRow(rng, width, 3);
+				const std::vector<std::uint8_t> bgra = MakeRow(rng, width, 4);
+				std::vector<std::uint8_t> expected(static_cast<size_t>(width) * 4);
+				std::vector<std::uint8_t> got(expected.size());
+
+				for (const std::uint32_t key : keys) {
+					scalar.bgr24ToRgba(bgr.data(), expected.data(), width, key);
+					kernels.bgr24ToRgba(bgr.data(), got.data(), width, key);
+					if (!CompareRow("bgr24", kernels, width, expected, got)) return false;
+
+					for (const bool opaque : { false, true }) {
+						scalar.bgra32ToRgba(bgra.data(), expected.data(), width, key, opaque);
+						kernels.bgra32ToRgba(bgra.data(), got.data(), width, key, opaque);
+						if (!CompareRow(opaque ? "bgrx32" : "bgra32", kernels, width, expected, got)) return false;
+					}
+					++rows;
+				}
+			}
+		}
+		std::printf("  %s matches scalar on %d rows of widths 0..%d\n", kernels.name, rows, kMaxCheckedWidth);
+		return true;
+	}
+
+	void Benchmark(const PixelConvertKernels& kernels) {
+		constexpr int kSize = 2048;
+		constexpr int kRepeats = 10;
+		Lcg rng;
+		const std::vector<std::uint8_t> bgr = MakeRow(rng, kSize * kSize, 3);
+		const std::vector<std::uint8_t> bgra = MakeRow(rng, kSize * kSize, 4);
+		std::vector<std::uint8_t> rgba(static_cast<size_t>(kSize) * kSize * 4);
+		const std::uint32_t key = PixelConvertKernels::PackKey(255, 0, 255);
+
+		auto time = [&](auto&& convertRow) {
+			const auto start = std::chrono::steady_clock::now();
+			for (int repeat = 0; repeat < kRepeats; ++repeat) {
+				for (int y = 0; y < kSize; ++y) convertRow(y);
+			}
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kRepeats;
+		};
+		const double bgrMs = time([&](int y) {
+			kernels.bgr24ToRgba(bgr.data() + static_cast<size_t>(y) * kSize * 3, rgba.data() + static_cast<size_t>(y) * kSize * 4, kSize, key);
+		});
+		const double bgraMs = time([&](int y) {
+			kernels.bgra32ToRgba(bgra.data() + static_cast<size_t>(y) * kSize * 4, rgba.data() + static_cast<size_t>(y) * kSize * 4, kSize, key, false);
+		});
+		std::printf("  %-6s %dx%d keyed: bgr24 %.3f ms, bgra32 %.3f ms\n", kernels.name, kSize, kSize, bgrMs, bgraMs);
+	}
+
+	struct BmpCase {
+		const char* name;
+		int bitsPerPixel;
+		bool withAlpha;
+	};
+
+	constexpr BmpCase kBmpCases[] = {
+		{ "bgr24", 24, false },
+		{ "bgrx32", 32, false },
+		{ "bgra32", 32, true },
+	};
+
+	// What SDL alone makes of the file: its loader, the key set on the surface, then RGBA32.
+	SDL_Surface* DecodeWithSdl(const std::vector<std::uint8_t>& bmp, bool keyed) {
+		SDL_IOStream* io = SDL_IOFromConstMem(bmp.data(), bmp.size());
+		SDL_Surface* loaded = io ? SDL_LoadBMP_IO(io, true) : nullptr;
+		if (!loaded) return nullptr;
+		if (keyed) {
+			SDL_SetSurfaceColorKey(loaded, true, SDL_MapSurfaceRGB(loaded, 255, 0, 255));
+		}
+		SDL_Surface* converted = SDL_ConvertSurface(loaded, SDL_PIXELFORMAT_RGBA32);
+		SDL_DestroySurface(loaded);
+		return converted;
+	}
+
+	// Both sides end up RGBA32: the fast path's RGBX32 for opaque images converts with alpha 255,
+	// the same as SDL's own opaque formats.
+	bool CompareWithSdl(const BmpCase& bmpCase, int width, int height, bool topDown, bool keyed) {
+		const std::vector<std::uint8_t> bmp = MakeTestBmp(width, height, bmpCase.bitsPerPixel, topDown, bmpCase.withAlpha,
+			static_cast<std::uint32_t>(width * 131 + height));
+		const Vector3i magenta(255, 0, 255);
+		char what[64];
+		std::snprintf(what, sizeof(what), "%s %dx%d %s%s", bmpCase.name, width, height, topDown ? "top-down" : "bottom-up", keyed ? " keyed" : "");
+
+		SDL_Surface* expected = DecodeWithSdl(bmp, keyed);
+		if (!expected) {
+			std::printf("  %s: SDL could not decode the file: %s\n", what, SDL_GetError());
+			return false;
+		}
+
+		SDL_Surface* got = nullptr;
+		bool fastPath = false;
+		try {
+			Surface surface = Surface::FromBmp(bmp.data(), bmp.size(), keyed ? &magenta : nullptr, what);
+			SDL_Surface* native = static_cast<SDL_Surface*>(surface.GetNative());
+			// The SDL fallback keys through the surface; the fast path bakes the key into alpha.
+			fastPath = !SDL_SurfaceHasColorKey(native);
+			got = SDL_ConvertSurface(native, SDL_PIXELFORMAT_RGBA32);
+		}
+		catch (const std::exception& e) {
+			std::printf("  %s: Surface::FromBmp failed: %s\n", what, e.what());
+		}
+
+		bool ok = got && (fastPath || !keyed) && got->w == expected->w && got->h == expected->h;
+		if (got && keyed && !fastPath) {
+			std::printf("  %s: Surface::FromBmp fell back to SDL\n", what);
+		}
+		for (int y = 0; ok && y < height; ++y) {
+			const std::uint8_t* e = static_cast<const std::uint8_t*>(expected->pixels) + static_cast<size_t>(y) * expected->pitch;
+			const std::uint8_t* g = static_cast<const std::uint8_t*>(got->pixels) + static_cast<size_t>(y) * got->pitch;
+			for (int i = 0; i < width * 4; ++i) {
+				if (e[i] != g[i]) {
+					std::printf("  %s: pixel (%d, %d) byte %d differs (SDL %u, FromBmp %u)\n", what, i / 4, y, i % 4, e[i], g[i]);
+					ok = false;
+					break;
+				}
+			}
+		}
+		SDL_DestroySurface(got);
+		SDL_DestroySurface(expected);
+		return ok;
+	}
+
+	bool CheckAgainstSdl() {
+		constexpr int kWidths[] = { 1, 37, 258 };
+		constexpr int kHeight = 19;
+		int files = 0;
+		for (const BmpCase& bmpCase : kBmpCases) {
+			for (const int width : kWidths) {
+				for (const bool topDown : { false, true }) {
+					for (const bool keyed : { false, true }) {
+						if (!CompareWithSdl(bmpCase, width, kHeight, topDown, keyed)) return false;
+						++files;
+					}
+				}
+			}
+		}
+		std::printf("  Surface::FromBmp matches SDL on %d files (24/32-bit, both row orders, with and without key)\n", files);
+		return true;
+	}
+
+	void BenchmarkAgainstSdl() {
+		constexpr int kSize = 2048;
+		constexpr int kRepeats = 5;
+		const Vector3i magenta(255, 0, 255);
+		for (const BmpCase& bmpCase : kBmpCases) {
+			const std::vector<std::uint8_t> bmp = MakeTestBmp(kSize, kSize, bmpCase.bitsPerPixel, false, bmpCase.withAlpha, 7u);
+
+			auto start = std::chrono::steady_clock::now();
+			for (int repeat = 0; repeat < kRepeats; ++repeat) {
+				Surface surface = Surface::FromBmp(bmp.data(), bmp.size(), &magenta, "benchmark");
+			}
+			const double fastMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kRepeats;
+
+			start = std::chrono::steady_clock::now();
+			for (int repeat = 0; repeat < kRepeats; ++repeat) {
+				SDL_DestroySurface(DecodeWithSdl(bmp, true));
+			}
+			const double sdlMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kRepeats;
+			std::printf("  %-6s %dx%d keyed file: FromBmp %.2f ms, SDL %.2f ms\n", bmpCase.name, kSize, kSize, fastMs, sdlMs);
+		}
+	}
+}
+
+bool RunBmpDecodeCheck() {
+	const auto sets = GetSupportedPixelConvertKernels();
+	const PixelConvertKernels& scalar = *sets[0];
+	if (sets.size() == 1) {
+		std::printf("  only the scalar kernels are supported here; nothing to compare\n");
+	}
+	for (size_t i = 1; i < sets.size(); ++i) {
+		if (!CheckEquivalence(scalar, *sets[i])) {
+			return false;
+		}
+	}
+	for (const PixelConvertKernels* kernels : sets) {
+		Benchmark(*kernels);
+	}
+	if (!CheckAgainstSdl()) {
+		return false;
+	}
+	BenchmarkAgainstSdl();
+	return true;
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+// Self-checks and micro-benchmarks for engine subsystems the game never exercises on demand.
+// Each prints its own results and returns false on failure (a benchmark fails only when the
+// output it verifies is wrong, never for being slow).
+bool RunAnimatorBenchmark();
+bool RunAudioCommandCheck();
+bool RunAudioMixBenchmark();
+bool RunBmpBakeCheck();
+bool RunBmpDecodeCheck();
+bool RunPackLoadBenchmark();
+bool RunPhysicsDeterminismCheck();
+bool RunSpscRingBufferCheck();
@@ -0,0 +1,75 @@
+// EngineChecks: runs engine self-checks and micro-benchmarks outside the game.
+//
+//   EngineChecks [name ...]     run the named checks (all of them when none are given)
+//   EngineChecks --list         print the check names
+//
+// Exits with 1 if any check fails. Build Release for meaningful benchmark numbers.
+#include "EngineChecks.h"
+
+#include <cstdio>
+#include <string_view>
+
+namespace {
+	struct Check {
+		const char* name;
+		const char* description;
+		bool (*run)();
+	};
+
+	constexpr Check kChecks[] = {
+		{ "animators", "5000 Animators with float/bool/trigger transitions through AnimationSystem::Update", RunAnimatorBenchmark },
+		{ "audio-commands", "Paced 100k/s Audio voice commands with bursts through the overflow; checks order and delivery", RunAudioCommandCheck },
+		{ "audio-mix", "64 voices x 10 s through the selected mix kernels, soft clip vs reference", RunAudioMixBenchmark },
+		{ "bmp-bake", "Straight and premultiplied AssetPacker bakes against Surface::FromBmp + color key", RunBmpBakeCheck },
+		{ "bmp-decode", "SIMD BMP row converters against scalar and Surface::FromBmp against SDL, plus timings", RunBmpDecodeCheck },
+		{ "pack-load", "Xenon asset set loaded from Dist/graphics.pak vs loose files, one at a time and preloaded", RunPackLoadBenchmark },
+		{ "physics-determinism", "Box2D stepped through the JobSystem bit-for-bit against single-threaded stepping", RunPhysicsDeterminismCheck },
+		{ "spsc-ring", "Concurrent producer/consumer stress of SpscRingBuffer (order, loss, tearing)", RunSpscRingBufferCheck },
+	};
+
+	const Check* FindCheck(std::string_view name) {
+		for (const Check& check : kChecks) {
+			if (name == check.name) return &check;
+		}
+		return nullptr;
+	}
+
+	bool Run(const Check& check) {
+		std::printf("== %s\n", check.name);
+		const bool ok = check.run();
+		std::printf("%s %s\n\n", ok ? "PASS" : "FAIL", check.name);
+		return ok;
+	}
+}
+
+int main(int argc, char** argv) {
+	if (argc == 2 && std::string_view(argv[1]) == "--list") {
+		for (const Check& check : kChecks) {
+			std::printf("%-20s %s\n", check.name, check.description);
+		}
+		return 0;
+	}
+
+	int failed = 0;
+	if (argc == 1) {
+		for (const Check& check : kChecks) {
+			failed += Run(check) ? 0 : 1;
+		}
+	}
+	else {
+		for (int i = 1; i < argc; ++i) {
+			const Check* check = FindCheck(argv[i]);
+			if (!check) {
+				std::fprintf(stderr, "Unknown check: %s (see --list)\n", argv[i]);
+				return 1;
+			}
+			failed += Run(*check) ? 0 : 1;
+		}
+	}
+
+	if (failed > 0) {
+		std::fprintf(stderr, "%d check(s) failed\n", failed);
+		return 1;
+	}
+	return 0;
+}
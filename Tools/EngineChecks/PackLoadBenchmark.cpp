@@ -0,0 +1,161 @@
+// Loads the Xenon asset set (every file AssetPacker packs from Dist/graphics: the BMPs with the
+// magenta key the pack is baked with, plus the audio) through AssetManager, once from loose files
+// and once with Dist/graphics.pak mounted, both one Load* at a time and through Preload on a
+// JobSystem. Each is run a few times on a fresh AssetManager and the fastest run is reported, so
+// the first read off a cold disk does not count against whichever mode goes first. Fails if either
+// mode cannot load every asset. Needs a window for the renderer, and graphics.pak built by the
+// AssetPacker project.
+#include "EngineChecks.h"
+
+#include <GameEngine/AssetManager.h>
+#include <GameEngine/Audio.h>
+#include <GameEngine/JobSystem.h>
+#include <GameEngine/Renderer.h>
+#include <GameEngine/Window.h>
+#include <SDL3/SDL.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace {
+	namespace fs = std::filesystem;
+
+	constexpr int kRuns = 3;
+
+	struct LoadTiming {
+		double ms = 0.0;
+		double decodeMs = 0.0; // summed over assets (overlaps across workers in a preload)
+		double uploadMs = 0.0;
+		size_t loaded = 0;
+	};
+
+	// The solution's Dist folder, seen from the exe (Build/bin/<platform>/<config>/), the project
+	// directory or the solution directory.
+	fs::path FindDist() {
+		std::vector<fs::path> candidates;
+		if (const char* base = SDL_GetBasePath()) {
+			candidates.push_back(fs::path(base) / "../../../../Dist");
+		}
+		candidates.push_back("../../Dist");
+		candidates.push_back("Dist");
+		for (const fs::path& candidate : candidates) {
+			std::error_code error;
+			if (fs::exists(candidate / "graphics.pak", error)) {
+				return candidate.lexically_normal();
+			}
+		}
+		return {};
+	}
+
+	// Same entries the pack holds, keyed the way AssetPacker bakes them.
+	AssetManifest MakeManifest(const fs::path& graphics) {
+		std::vector<fs::path> files;
+		for (const fs::directory_entry& entry : fs::directory_iterator(graphics)) {
+			if (entry.is_regular_file()) files.push_back(entry.path().filename());
+		}
+		std::sort(files.begin(), files.end());
+
+		const Vector3i magenta(255, 0, 255);
+		AssetManifest manifest;
+		for (const fs::path& file : files) {
+			if (file.extension() == ".bmp") manifest.AddTexture(file.string(), magenta);
+			else if (file.extension() == ".wav") manifest.AddAudioClip(file.string());
+		}
+		return manifest;
+	}
+
+	LoadTiming LoadOnce(Renderer& renderer, JobSystem* jobs, const fs::path& dist, bool usePack, const AssetManifest& manifest) {
+		LoadTiming timing;
+		AssetManager assets(renderer, jobs);
+		assets.SetBasePath((dist / "graphics").string());
+		if (usePack && !assets.MountPack((dist / "graphics.pak").string())) {
+			return timing;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+		if (jobs) {
+			const AssetPreload preload = assets.Preload(manifest);
+			timing.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			timing.loaded = preload.Size();
+		}
+		else {
+			for (const AssetManifest::TextureEntry& entry : manifest.GetTextures()) {
+				timing.loaded += assets.LoadTexture(entry.path, entry.colorKey) ? 1 : 0;
+			}
+			for (const std::string& path : manifest.GetAudioClips()) {
+				timing.loaded += assets.LoadAudioClip(path) ? 1 : 0;
+			}
+			timing.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		for (const AssetLoadStats& stats : assets.GetLoadStats()) {
+			timing.decodeMs += stats.decodeMs;
+			timing.uploadMs += stats.uploadMs;
+		}
+		return timing;
+	}
+
+	LoadTiming Fastest(Renderer& renderer, JobSystem* jobs, const fs::path& dist, bool usePack, const AssetManifest& manifest) {
+		LoadTiming best;
+		for (int run = 0; run < kRuns; ++run) {
+			const LoadTiming timing = LoadOnce(renderer, jobs, dist, usePack, manifest);
+			if (run == 0 || timing.ms < best.ms) best = timing;
+		}
+		return best;
+	}
+
+	bool Report(const char* mode, const LoadTiming& timing, size_t expected) {
+		std::printf("  %-22s %8.2f ms (decode %.2f ms, upload %.2f ms), %zu/%zu assets\n",
+			mode, timing.ms, timing.decodeMs, timing.uploadMs, timing.loaded, expected);
+		return timing.loaded == expected;
+	}
+}
+
+bool RunPackLoadBenchmark() {
+	const fs::path dist = FindDist();
+	if (dist.empty()) {
+		std::printf("  Dist/graphics.pak not found (build the AssetPacker project first)\n");
+		return false;
+	}
+	const AssetManifest manifest = MakeManifest(dist / "graphics");
+	std::printf("  %zu textures and %zu audio clips from %s\n", manifest.GetTextures().size(), manifest.GetAudioClips().size(), dist.string().c_str());
+
+	SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+	if (!Audio::Initialize()) {
+		std::printf("  could not start audio on the dummy driver\n");
+		return false;
+	}
+
+	bool ok = true;
+	try {
+		WindowConfig config;
+		config.title = "EngineChecks";
+		config.windowSize = Vector2i(320, 240);
+		config.resizable = false;
+		Window window(config);
+		Renderer renderer(window);
+		JobSystem jobs;
+
+		const size_t expected = manifest.Size();
+		const bool looseOk = Report("loose, one at a time", Fastest(renderer, nullptr, dist, false, manifest), expected);
+		const bool packOk = Report("pack, one at a time", Fastest(renderer, nullptr, dist, true, manifest), expected);
+		char preloadMode[32];
+		std::snprintf(preloadMode, sizeof(preloadMode), "loose, preload (%d)", jobs.GetWorkerCount());
+		const bool loosePreloadOk = Report(preloadMode, Fastest(renderer, &jobs, dist, false, manifest), expected);
+		std::snprintf(preloadMode, sizeof(preloadMode), "pack, preload (%d)", jobs.GetWorkerCount());
+		const bool packPreloadOk = Report(preloadMode, Fastest(renderer, &jobs, dist, true, manifest), expected);
+		ok = looseOk && packOk && loosePreloadOk && packPreloadOk;
+	}
+	catch (const std::exception& e) {
+		std::printf("  %s\n", e.what());
+		ok = false;
+	}
+
+	Audio::Shutdown();
+	return ok;
+}
@@ -0,0 +1,30 @@
+// Steps a 16x16 stack of boxes and circles once on the calling thread and once with Box2D's
+// parallel stages on a JobSystem, for several worker counts, and fails unless every body ends in
+// a bit-identical pose (Physics2DWorld::CheckJobSystemDeterminism). Replays, lockstep and the
+// fixed-step interpolation all assume the threaded solver matches the serial one exactly.
+#include "EngineChecks.h"
+
+#include <GameEngine/JobSystem.h>
+#include <GameEngine/Physics2D.h>
+
+#include <chrono>
+#include <cstdio>
+
+namespace {
+	constexpr int kSteps = 240;
+	// 1 worker still splits every stage between the pool and the stepping thread.
+	constexpr int kWorkerCounts[] = { 1, 3, 7 };
+}
+
+bool RunPhysicsDeterminismCheck() {
+	bool ok = true;
+	for (const int workers : kWorkerCounts) {
+		JobSystem jobs(workers);
+		const auto start = std::chrono::steady_clock::now();
+		const bool identical = Physics2DWorld::CheckJobSystemDeterminism(jobs, kSteps);
+		const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		std::printf("  %d job worker(s), %d steps: %s (%.1f ms)\n", workers, kSteps, identical ? "identical" : "DIVERGED", ms);
+		ok = ok && identical;
+	}
+	return ok;
+}
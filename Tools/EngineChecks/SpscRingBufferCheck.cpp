@@ -0,0 +1,95 @@
+// Stress test for SpscRingBuffer: one producer and one consumer thread hammer small buffers (lots
+// of wraparound and full/empty transitions). The consumer checks that every item arrives exactly
+// once, in order, and untorn.
+#include "EngineChecks.h"
+
+#include <GameEngine/SpscRingBuffer.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+namespace {
+	constexpr std::uint64_t kItemsPerRun = 2'000'000;
+
+	// Two words derived from one sequence number, so a torn copy shows up as a mismatch.
+	struct Item {
+		std::uint64_t sequence = 0;
+		std::uint64_t check = 0;
+	};
+
+	std::uint64_t CheckFor(std::uint64_t sequence) {
+		return sequence * 0x9E3779B97F4A7C15ull ^ 0xD1B54A32D192ED03ull;
+	}
+
+	bool StressOnce(size_t requestedCapacity) {
+		SpscRingBuffer<Item> ring(requestedCapacity);
+		std::uint64_t fullSpins = 0;
+
+		const auto start = std::chrono::steady_clock::now();
+		std::thread producer([&ring, &fullSpins] {
+			for (std::uint64_t i = 0; i < kItemsPerRun; ++i) {
+				const Item item{ i, CheckFor(i) };
+				while (!ring.TryPush(item)) {
+					++fullSpins;
+					std::this_thread::yield();
+				}
+			}
+		});
+
+		bool ok = true;
+		std::uint64_t expected = 0;
+		std::uint64_t emptySpins = 0;
+		size_t largestSize = 0;
+		while (expected < kItemsPerRun) {
+			Item item;
+			if (!ring.TryPop(item)) {
+				++emptySpins;
+				std::this_thread::yield();
+				continue;
+			}
+			if (item.sequence != expected || item.check != CheckFor(expected)) {
+				std::printf("  capacity %zu: expected item %llu, got %llu (check %s)\n", ring.Capacity(),
+					static_cast<unsigned long long>(expected), static_cast<unsigned long long>(item.sequence),
+					item.check == CheckFor(item.sequence) ? "ok" : "torn");
+				ok = false;
+				break;
+			}
+			++expected;
+			largestSize = std::max(largestSize, ring.Size());
+		}
+		producer.join();
+		const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		if (ok && !ring.IsEmpty()) {
+			std::printf("  capacity %zu: %zu items left over\n", ring.Capacity(), ring.Size());
+			ok = false;
+		}
+		if (ok && largestSize > ring.Capacity()) {
+			std::printf("  capacity %zu: Size() reported %zu\n", ring.Capacity(), largestSize);
+			ok = false;
+		}
+		if (ok) {
+			std::printf("  capacity %4zu (asked %4zu): %llu items in %.1f ms, %.1f M items/s, %llu full / %llu empty spins\n",
+				ring.Capacity(), requestedCapacity, static_cast<unsigned long long>(kItemsPerRun), seconds * 1000.0,
+				kItemsPerRun / seconds / 1e6, static_cast<unsigned long long>(fullSpins), static_cast<unsigned long long>(emptySpins));
+		}
+		return ok;
+	}
+}
+
+bool RunSpscRingBufferCheck() {
+	if (std::thread::hardware_concurrency() < 2) {
+		std::printf("  note: single hardware thread, producer and consumer will only interleave\n");
+	}
+
+	// 1 rounds up to a single slot (every push fills it); 100 checks the power-of-two rounding.
+	for (const size_t capacity : { size_t{ 1 }, size_t{ 2 }, size_t{ 100 }, size_t{ 1024 } }) {
+		if (!StressOnce(capacity)) {
+			return false;
+		}
+	}
+	return true;
+}
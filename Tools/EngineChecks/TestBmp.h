@@ -0,0 +1,62 @@
+#pragma once
+
+// In-memory BMP files for the decode checks: uncompressed BI_RGB, rows padded to 4 bytes, random
+// pixels with about a third of them the key color (magenta).
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// 8 (256-entry palette, entry 0 the key), 24 or 32 bits per pixel. A 32-bit image gets random
+// alpha when withAlpha is set (keyed pixels stay opaque: SDL compares its key against all four
+// channels) and zero alpha bytes otherwise, which BMP readers take as BGRX.
+inline std::vector<std::uint8_t> MakeTestBmp(int width, int height, int bitsPerPixel, bool topDown, bool withAlpha, std::uint32_t seed) {
+	const int bytesPerPixel = bitsPerPixel / 8;
+	const size_t stride = ((static_cast<size_t>(width) * bitsPerPixel + 31) / 32) * 4;
+	const std::uint32_t paletteSize = bitsPerPixel == 8 ? 256 : 0;
+	const std::uint32_t pixelOffset = 14 + 40 + paletteSize * 4;
+	std::vector<std::uint8_t> bmp(pixelOffset + stride * static_cast<size_t>(height), 0);
+
+	const auto put = [&bmp](size_t offset, auto value) { std::memcpy(bmp.data() + offset, &value, sizeof(value)); };
+	bmp[0] = 'B';
+	bmp[1] = 'M';
+	put(2, static_cast<std::uint32_t>(bmp.size()));
+	put(10, pixelOffset);
+	put(14, std::uint32_t{ 40 });
+	put(18, static_cast<std::int32_t>(width));
+	put(22, static_cast<std::int32_t>(topDown ? -height : height));
+	put(26, std::uint16_t{ 1 });
+	put(28, static_cast<std::uint16_t>(bitsPerPixel));
+	put(34, static_cast<std::uint32_t>(stride * static_cast<size_t>(height)));
+	put(46, paletteSize);
+
+	std::uint32_t state = seed;
+	const auto next = [&state] {
+		state = state * 1664525u + 1013904223u;
+		return static_cast<std::uint8_t>(state >> 24);
+	};
+	for (std::uint32_t i = 0; i < paletteSize; ++i) {
+		std::uint8_t* entry = bmp.data() + 54 + i * 4;
+		for (int c = 0; c < 3; ++c) entry[c] = next();
+		if (i == 0) {
+			entry[0] = 255; entry[1] = 0; entry[2] = 255;
+		}
+	}
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			if (bytesPerPixel == 1) {
+				bmp[pixelOffset + static_cast<size_t>(y) * stride + static_cast<size_t>(x)] = next() % 3 == 0 ? 0 : static_cast<std::uint8_t>(1 + next() % 255);
+				continue;
+			}
+			std::uint8_t* px = bmp.data() + pixelOffset + static_cast<size_t>(y) * stride + static_cast<size_t>(x) * bytesPerPixel;
+			const bool keyed = next() % 3 == 0;
+			for (int c = 0; c < 3; ++c) px[c] = next();
+			if (keyed) {
+				px[0] = 255; px[1] = 0; px[2] = 255; // BGR magenta
+			}
+			if (bytesPerPixel == 4) {
+				px[3] = withAlpha ? (keyed ? 255 : next()) : 0;
+			}
+		}
+	}
+	return bmp;
+}
@@ -4,19 +4,8 @@
 
 class AllyEntity : public Entity {
 public:
+	// The faction is fixed at construction so Entity::Awake puts the collider on the Player layer.
 	explicit AllyEntity()
-		: Entity() {
-		SetComponentName("AllyEntity");
+		: Entity("AllyEntity", 5, Faction::Player) {
 	}
-
-
-protected:
-	void Awake() override {
-		// call base Awake
-		Entity::Awake();
-		// set faction to Enemy
-		m_faction = Faction::Player;
-
-	}
-
 };
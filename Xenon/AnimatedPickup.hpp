@@ -31,6 +31,8 @@ public:
 	void SetLayerOrder(int order) { m_layerOrder = order; }
 	void SetColorKey(const Vector3i& colorKey) { m_useColorKey = true; m_colorKey = colorKey; }
 	void ClearColorKey() { m_useColorKey = false; }
+	// Loop only part of the sheet (default: every frame).
+	void SetFrameRange(int firstFrame, int frameCount) { m_firstFrame = firstFrame; m_frameCount = frameCount; }
 
 protected:
 	void Awake() override {
@@ -59,39 +61,14 @@ protected:
 		PickupBehaviour::Awake();
 
 		// Start looping.
-		animator->SetController(&m_controller);
+		animator->SetController(m_controller);
 		animator->Play("Loop", true);
 	}
 
-	// You can override this if you want a custom frame list (not all frames).
-	virtual void BuildFrames(std::vector<int>& outFrames) {
-		outFrames.clear();
-
-		if (!m_sheet || !m_sheet->IsValid()) return;
-		const Vector2i texSize = m_sheet->texture->GetSize();
-		const int cols = (m_frameSize.x > 0) ? (texSize.x / m_frameSize.x) : 0;
-		const int rows = (m_frameSize.y > 0) ? (texSize.y / m_frameSize.y) : 0;
-		const int total = std::max(0, cols * rows);
-		for (int i = 0; i < total; ++i) {
-			outFrames.push_back(i);
-		}
-	}
-
 protected:
 	Animator* animator = nullptr;
 
 private:
-	static std::string BuildPickupSheetKey(const std::string& path, const Vector2i& frame, bool useColorKey, const Vector3i& ck) {
-		// Stable-ish key for caching in AssetManager.
-		std::string k = "sheet.pickup.";
-		k += path;
-		k += "|" + std::to_string(frame.x) + "x" + std::to_string(frame.y);
-		if (useColorKey) {
-			k += "|ck=" + std::to_string(ck.x) + "," + std::to_string(ck.y) + "," + std::to_string(ck.z);
-		}
-		return k;
-	}
-
 	void BuildAssetsIfNeeded() {
 		if (m_built) return;
 
@@ -105,38 +82,17 @@ private:
 			m_fps = 12.0f;
 		}
 
-		const std::string sheetKey = BuildPickupSheetKey(m_sheetPath, m_frameSize, m_useColorKey, m_colorKey);
 		if (m_useColorKey) {
-			m_sheet = LoadSpriteSheet(sheetKey, m_sheetPath, m_frameSize, m_colorKey);
+			m_sheet = LoadSpriteSheet(m_sheetPath, m_frameSize, m_colorKey);
 		} else {
-			m_sheet = LoadSpriteSheet(sheetKey, m_sheetPath, m_frameSize);
+			m_sheet = LoadSpriteSheet(m_sheetPath, m_frameSize);
 		}
 		if (!m_sheet || !m_sheet->IsValid()) {
 			THROW_ENGINE_EXCEPTION("Failed to load pickup spritesheet: " + m_sheetPath);
 		}
 
-		// Build a looping clip.
-		m_clip = AnimationClip{};
-		m_clip.name = "Loop";
-		m_clip.sheet = m_sheet;
-		m_clip.fps = m_fps;
-		m_clip.loop = true;
-		BuildFrames(m_clip.frames);
-		if (m_clip.frames.empty()) {
-			// Fallback: show frame 0.
-			m_clip.frames.push_back(0);
-		}
-
-		// Build a controller with a single looping state.
-		m_controller = AnimatorController{};
-		AnimState st;
-		st.id = 0;
-		st.name = "Loop";
-		st.clip = &m_clip;
-		m_controller.states = { st };
-		m_controller.transitions.clear();
-		m_controller.parameters.clear();
-		m_controller.entryState = 0;
+		// Shared looping clip + single-state controller.
+		m_controller = GetSheetController(m_sheet, m_fps, true, "Loop", m_firstFrame, m_frameCount);
 
 		m_built = true;
 	}
@@ -146,14 +102,15 @@ private:
 	Vector2i m_frameSize = Vector2i(32, 32);
 	float m_fps = 12.0f;
 	int m_layerOrder = 2;
+	int m_firstFrame = 0;
+	int m_frameCount = AnimationLibrary::kAllFrames;
 
 	bool m_useColorKey = false;
 	Vector3i m_colorKey = Vector3i(255, 0, 255);
 
 	bool m_built = false;
 	SpriteSheet* m_sheet = nullptr;
-	AnimationClip m_clip{};
-	AnimatorController m_controller{};
+	std::shared_ptr<const AnimatorController> m_controller;
 };
 
 // GameObject base that includes Animator.
@@ -34,8 +34,6 @@ class DroneBehaviour : public EnemyEntity {
 	Animator* animator = nullptr;
 
 	SpriteSheet* m_sheet = nullptr;
-	AnimationClip m_clip{};
-	AnimatorController m_ctrl{};
 
 	// Movement params
 	float m_forwardSpeed = 140.0f;      // along -LocalUp
@@ -80,14 +78,16 @@ protected:
 		sprite->SetFrameIndex(0);
 		sprite->SetLayerOrder(-2);
 
-		BuildLoopAllFrames(m_sheet, 12.0f, m_clip, m_ctrl);
-		animator->SetController(&m_ctrl);
+		std::shared_ptr<const AnimatorController> ctrl = LoopAllFrames(m_sheet, 12.0f);
+		animator->SetController(ctrl);
+		// Spawns off-screen: keep the loop phase running but skip sprite writes until it shows up.
+		animator->SetCullingMode(AnimatorCullingMode::CullUpdate);
 		animator->Play("Loop", true);
 
 // Pack visual variation: each drone starts "frame-ahead" of the previous.
 // This is purely visual; it does not affect movement.
-if (!m_clip.frames.empty()) {
-	const int frameCount = (int)m_clip.frames.size();
+if (!ctrl->states.front().clip->frames.empty()) {
+	const int frameCount = (int)ctrl->states.front().clip->frames.size();
 	const float startN = (float)(m_packIndex % frameCount) / (float)frameCount;
 	animator->SeekNormalized(startN, 9999.0f);
 }
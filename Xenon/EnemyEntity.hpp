@@ -7,8 +7,7 @@
 class EnemyEntity : public Entity {
 public:
 	explicit EnemyEntity()
-		: Entity() {
-		SetComponentName("EnemyEntity");
+		: Entity("EnemyEntity", 5, Faction::Enemy) {
 	}
 
 
@@ -16,14 +15,6 @@ protected:
 
 	int m_points = 1000;
 	int m_damageOnContact = 25;
-	void Awake() override {
-		// call base Awake
-		Entity::Awake();
-		// set faction to Enemy
-		m_faction = Faction::Enemy;
-
-	}
-
 	void OnDeath(GameObject* instigator) override {
 		// Award points.
 		if (auto* scene = GetGameObject() ? GetGameObject()->GetScene() : nullptr) {
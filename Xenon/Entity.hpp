@@ -2,6 +2,8 @@
 
 #include "IDamageable.hpp"
 #include "Faction.hpp"
+#include "ProjectileSystem.hpp"
+#include "XenonCollisionLayers.hpp"
 #include <GameEngine/GameEngine.h>
 #include <string>
 
@@ -17,6 +19,13 @@ public:
 	// IDamageable implementation
 	// Get the faction of the entity
 	Faction GetFaction() const override { return m_faction; }
+	// Change sides; the collider follows onto the faction's collision layer
+	void SetFaction(Faction faction) {
+		m_faction = faction;
+		if (collider) {
+			collider->SetLayer(XenonCollisionLayers::ForFaction(m_faction));
+		}
+	}
 	// Check if the entity is alive
 	bool IsAlive() const override { return m_alive; }
 	// Get the current health of the entity
@@ -68,6 +77,7 @@ protected:
 			THROW_ENGINE_EXCEPTION("Entity " + GetGameObject()->GetName() + " (" + std::to_string(GetGameObject()->GetInstanceID()) + ")" + " is missing Rigidbody2D component");
 		}
 		if(collider = GetComponent<Collider2D>().get()) {
+			collider->SetLayer(XenonCollisionLayers::ForFaction(m_faction));
 			collider->SetTrigger(true);
 			collider->SetShouldSensorEvent(true);
 		} else {
@@ -81,6 +91,19 @@ protected:
 		transform = GetTransform();
 	}
 
+	// Bullets only see entities that are enabled.
+	void OnEnable() override {
+		if (auto* projectiles = ProjectileSystem::Current()) {
+			projectiles->RegisterTarget(this, collider);
+		}
+	}
+
+	void OnDisable() override {
+		if (auto* projectiles = ProjectileSystem::Current()) {
+			projectiles->UnregisterTarget(this);
+		}
+	}
+
 	void OnDamageTaken(int amount, GameObject* instigator) {
 		// Can be overridden in derived classes for custom behavior
 	}
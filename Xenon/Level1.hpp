@@ -18,6 +18,43 @@ public:
 		SetGameMode<XenonGameMode>();
 	}
 
+	// Everything the level and its spawners/prefabs load on first use, so no wave, explosion or
+	// pickup has to hit the disk mid-game. Keys and color keys must match the prefabs' Load* calls.
+	void OnDeclareAssets(AssetManifest& manifest) override {
+		const Vector3i magenta(255, 0, 255);
+
+		manifest.AddTexture(XenonAssetKeys::Files::GalaxyBmp);
+		manifest.AddTexture(XenonAssetKeys::Files::BlocksBmp, magenta);
+
+		// Player + companion
+		manifest.AddSpriteSheet(XenonAssetKeys::Sheets::Ship2, XenonAssetKeys::Files::Ship2Bmp, Vector2i(64, 64), magenta);
+		manifest.AddSpriteSheet(XenonAssetKeys::Sheets::CompanionClone, XenonAssetKeys::Files::CloneBmp, Vector2i(32, 32), magenta);
+		manifest.AddSpriteSheet(XenonAssetKeys::Sheets::Missiles, XenonAssetKeys::Files::MissileBmp, Vector2i(16, 16), magenta);
+		manifest.AddAudioClip(XenonAssetKeys::Audio::GunWav);
+
+		// Enemies
+		manifest.AddSpriteSheet(XenonAssetKeys::Sheets::Loner, XenonAssetKeys::Files::LonerABmp, Vector2i(64, 64), magenta);
+		manifest.AddSpriteSheet(XenonAssetKeys::Sheets::Rusher, XenonAssetKeys::Files::RusherBmp, Vector2i(64, 32), magenta);
+		manifest.AddSpriteSheet(XenonAssetKeys::Sheets::Drone, XenonAssetKeys::Files::DroneBmp, Vector2i(32, 32), magenta);
+		manifest.AddSpriteSheet(XenonAssetKeys::Sheets::EnemyProjectiles, XenonAssetKeys::Files::EnemyWeapBmp, Vector2i(16, 16), magenta);
+
+		// Asteroids, pickups and VFX build their sheet keys at runtime; the texture is the expensive part.
+		for (StoneAsteroidSize size : { StoneAsteroidSize::Large96, StoneAsteroidSize::Medium64, StoneAsteroidSize::Small32 }) {
+			manifest.AddTexture(StoneAsteroidSheetPath(size), magenta);
+		}
+		for (MetalAsteroidSize size : { MetalAsteroidSize::Large96, MetalAsteroidSize::Medium64, MetalAsteroidSize::Small32 }) {
+			manifest.AddTexture(MetalAsteroidSheetPathPrimary(size), magenta);
+		}
+		manifest.AddTexture(XenonAssetKeys::Files::ShieldPickupBmp, magenta);
+		manifest.AddTexture(XenonAssetKeys::Files::WeaponPickupBmp, magenta);
+		manifest.AddTexture(XenonAssetKeys::Files::Explode16Bmp, magenta);
+
+		// HUD (its life icons reuse the Ship2 texture) + score popups
+		manifest.AddFont(XenonAssetKeys::Files::Font8x8Bmp, XenonAssetKeys::Files::Font8x8Bmp, Vector2i(8, 8), magenta);
+		manifest.AddFont(XenonAssetKeys::Files::Font16x16Bmp, XenonAssetKeys::Files::Font16x16Bmp, Vector2i(16, 16), magenta);
+		manifest.AddFont(XenonAssetKeys::Fonts::Popup8x8, XenonAssetKeys::Files::Font8x8Bmp, Vector2i(8, 8), magenta);
+	}
+
 	void OnStart() override {
 		{
 			auto hud = CreateGameObject<GameObject>("HUDController");
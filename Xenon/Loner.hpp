@@ -14,11 +14,11 @@ class LonerBehaviour : public EnemyEntity {
 	Animator* animator = nullptr;
 
 	SpriteSheet* m_sheet = nullptr;
-	AnimationClip m_clip{};
-	AnimatorController m_ctrl{};
 
 	float m_speed = 120.0f;
 	float m_dir = 1.0f;
+	// Far enough to reach any corner of the 640x480 view.
+	float m_targetRange = 800.0f;
 
 protected:
 	void Awake() override {
@@ -28,6 +28,7 @@ protected:
 			rigidbody->SetBodyType(Rigidbody2D::BodyType::Kinematic);
 			rigidbody->SetGravityScale(0.0f);
 			rigidbody->SetFixedRotation(true);
+			rigidbody->SetInterpolation(Rigidbody2D::Interpolation::Interpolate);
 		}
 
 		launcher = GetComponent<EnemyProjectileLauncher>().get();
@@ -53,8 +54,8 @@ protected:
 		sprite->SetFrameIndex(0);
 		sprite->SetLayerOrder(-2);
 
-		BuildLoopAllFrames(m_sheet, 12.0f, m_clip, m_ctrl);
-		animator->SetController(&m_ctrl);
+		animator->SetController(LoopAllFrames(m_sheet, 12.0f));
+		animator->SetCullingMode(AnimatorCullingMode::CullUpdate);
 		animator->Play("Loop", true);
 
 		boxCol = dynamic_cast<BoxCollider2D*>(collider);
@@ -80,10 +81,15 @@ protected:
 
 	void Start() override {
 		InvokeRepeating([this]() {
-			if (!launcher) return;
-			auto ship = Scene::FindGameObject("SpaceShip");
-			if (ship && ship->IsActiveInHierarchy()) {
-				launcher->TryFireToward(ship->GetTransform()->GetWorldPosition());
+			if (!launcher || !transform) return;
+			auto* physics = SleeplessEngine::GetInstance().GetPhysicsWorld();
+			if (!physics) return;
+
+			// Nearest player-side collider: the ship or one of its companions.
+			Collider2D* target = physics->FindNearest(transform->GetWorldPosition(), m_targetRange,
+				CollisionLayerMatrix::GetCategoryBits(XenonCollisionLayers::Player), collider);
+			if (target && target->GetGameObject()) {
+				launcher->TryFireToward(target->GetGameObject()->GetTransform()->GetWorldPosition());
 			}
 			}, 1.0f, 2.0f, MonoBehaviour::InvokeTickPolicy::WhileBehaviourEnabled);
 	}
@@ -3,14 +3,18 @@
 #include <GameEngine/GameEngine.h>
 #include "Level1.hpp"
 #include "MainMenuScene.hpp"
+#include "ProjectileBenchmarkScene.hpp"
+#include "XenonCollisionLayers.hpp"
 #include "XenonGameInstance.hpp"
 #include <filesystem>
+#include <string_view>
 
 
 int main(int argc, char** argv) {
 	Config startConfig;
 
 	startConfig.assetBasePath = "..\\Dist\\graphics";
+	startConfig.assetPackPath = "..\\Dist\\graphics.pak";
 	startConfig.windowConfig.title = "Xenon 2000";
 	startConfig.windowConfig.windowSize = Vector2i(1280, 720);
 	startConfig.windowConfig.fullscreen = false;
@@ -19,6 +23,7 @@ int main(int argc, char** argv) {
 	startConfig.virtualResolution = Vector2(640, 480);
 	startConfig.integerScale = false;
 	startConfig.debugDrawColliders = true;
+	startConfig.collisionLayers = XenonCollisionLayers::Build();
 	startConfig.fitWindowToScale = true;
 	startConfig.viewportScaleMode = ViewportScaleMode::Letterbox;
 	startConfig.textureScaleMode = TextureScaleMode::Nearest;
@@ -29,13 +34,15 @@ int main(int argc, char** argv) {
 	// Scenes are stack-allocated and live for the duration of main.
 	MainMenuScene mainMenu;
 	Level1 level1;
+	ProjectileBenchmarkScene projectileBenchmark;
 
 	if (auto* gi = engine.GetGameInstanceAs<XenonGameInstance>()) {
 		gi->RegisterScenes(&mainMenu, &level1);
 		gi->ApplySettings();
 	}
 
-	engine.SetScene(&mainMenu);
+	const bool benchProjectiles = argc > 1 && std::string_view(argv[1]) == "--bench-projectiles";
+	engine.SetScene(benchProjectiles ? static_cast<Scene*>(&projectileBenchmark) : &mainMenu);
 	engine.Run();
 	return 0;
 
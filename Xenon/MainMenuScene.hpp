@@ -18,6 +18,14 @@ public:
 		// Menus don't need special game mode.
 	}
 
+	void OnDeclareAssets(AssetManifest& manifest) override {
+		manifest.AddTexture("galaxy2.bmp");
+		manifest.AddTexture("Xlogo.bmp", Vector3i(255, 0, 255));
+		manifest.AddFont("Font16x16.bmp", "Font16x16.bmp", Vector2i(16, 16), Vector3i(255, 0, 255));
+		// Options menu
+		manifest.AddFont("Font8x8.bmp", "Font8x8.bmp", Vector2i(8, 8), Vector3i(255, 0, 255));
+	}
+
 	void OnStart() override {
 		// Background (optional)
 		{
@@ -1,7 +1,6 @@
 #pragma once
 
-#include "ProjectileCommon.hpp"
-#include <GameEngine/Animator.h>
+#include "ProjectileSystem.hpp"
 #include "XenonAssetKeys.h"
 
 
@@ -27,7 +26,15 @@ namespace MissileAnim {
 		return LoadSpriteSheet(XenonAssetKeys::Sheets::Missiles, "missile.bmp", Vector2i(16, 16), Vector3i(255, 0, 255));
 	}
 
-	inline void BuildLoopForRow(MissileType type, AnimationClip& outClip, AnimatorController& outCtrl) {
+	// One projectile kind per missile type: the sheet row of that type, looped.
+	inline ProjectileSystem::KindId GetKind(ProjectileSystem& system, MissileType type) {
+		static constexpr const char* kNames[3] = { "missile.light", "missile.medium", "missile.heavy" };
+		const int row = static_cast<int>(type);
+		if (row < 0 || row > 2) return ProjectileSystem::kInvalidKind;
+
+		const ProjectileSystem::KindId existing = system.FindKind(kNames[row]);
+		if (existing != ProjectileSystem::kInvalidKind) return existing;
+
 		SpriteSheet* sheet = GetSheet();
 		if (!sheet || !sheet->IsValid()) {
 			THROW_ENGINE_EXCEPTION("Failed to load missile spritesheet (missile.bmp)");
@@ -39,102 +46,13 @@ namespace MissileAnim {
 			THROW_ENGINE_EXCEPTION("Missile spritesheet has invalid column count");
 		}
 
-		outClip = AnimationClip{};
-		outClip.name = "Loop";
-		outClip.sheet = sheet;
-		outClip.fps = 16.0f;
-		outClip.loop = true;
-		outClip.frames.clear();
-
-		const int row = static_cast<int>(type);
-		const int start = row * cols;
+		ProjectileSystem::Kind kind;
+		kind.sheet = sheet;
+		kind.fps = 16.0f;
 		for (int i = 0; i < cols; ++i) {
-			outClip.frames.push_back(start + i);
-		}
-
-		outCtrl = AnimatorController{};
-		AnimState st;
-		st.id = 0;
-		st.name = "Loop";
-		st.clip = &outClip;
-		outCtrl.states = { st };
-		outCtrl.transitions.clear();
-		outCtrl.parameters.clear();
-		outCtrl.entryState = 0;
-	}
-
-	// One controller+clip per missile type (shared templates). C++17 inline variables
-	// keep these singletons across translation units.
-	inline bool g_built[3] = { false, false, false };
-	inline AnimationClip g_clips[3]{};
-	inline AnimatorController g_ctrls[3]{};
-
-	inline AnimatorController* GetController(MissileType type, AnimationClip*& outClipPtr) {
-		// One controller+clip per missile type (shared templates).
-		// Runtime state is per Animator component instance.
-
-		const int idx = static_cast<int>(type);
-		if (idx < 0 || idx > 2) {
-			outClipPtr = nullptr;
-			return nullptr;
+			kind.frames.push_back(row * cols + i);
 		}
-
-		if (!g_built[idx]) {
-			BuildLoopForRow(type, g_clips[idx], g_ctrls[idx]);
-			g_built[idx] = true;
-		}
-
-		outClipPtr = &g_clips[idx];
-		return &g_ctrls[idx];
+		kind.halfExtents = Vector2f(sheet->frameSize.x * 0.5f, sheet->frameSize.y * 0.5f);
+		return system.AddKind(kNames[row], std::move(kind));
 	}
 }
-
-class MissileBehaviour : public ProjectileBehaviour {
-public:
-	MissileBehaviour()
-		: ProjectileBehaviour("MissileBehaviour") {
-		SetFaction(Faction::Player);
-		SetMissileType(MissileType::Light);
-	}
-
-	void SetMissileType(MissileType type) {
-		m_type = type;
-		SetDamage(MissileDamage(type));
-	}
-	MissileType GetMissileType() const { return m_type; }
-
-protected:
-	void Awake() override {
-		// Make sure sprite/rigidbody/collider exist and collider gets sized.
-		ProjectileBehaviour::Awake();
-
-		animator = GetComponent<Animator>().get();
-		if (!animator) {
-			THROW_ENGINE_EXCEPTION("Missile is missing Animator component");
-		}
-
-		// Hook Animator graph.
-		AnimationClip* clip = nullptr;
-		AnimatorController* ctrl = MissileAnim::GetController(m_type, clip);
-		if (!ctrl || !clip) {
-			THROW_ENGINE_EXCEPTION("Failed to build missile animator controller");
-		}
-		animator->SetController(ctrl);
-		animator->Play("Loop", true);
-	}
-
-	void ConfigureSprite() override {
-		// Requirement: show correct texture immediately on creation.
-		if (!sprite) return;
-		SpriteSheet* sheet = MissileAnim::GetSheet();
-		if (!sheet || !sheet->IsValid()) return;
-		sprite->SetTexture(sheet->texture);
-		sprite->SetFrameSize(sheet->frameSize);
-		sprite->SetFrameIndex(0);
-		sprite->SetLayerOrder(1);
-	}
-
-private:
-	MissileType m_type = MissileType::Light;
-	Animator* animator = nullptr;
-};
@@ -31,7 +31,9 @@ protected:
 
 		rigidbody->SetBodyType(Rigidbody2D::BodyType::Kinematic);
 		rigidbody->SetFixedRotation(true);
+		rigidbody->SetInterpolation(Rigidbody2D::Interpolation::Interpolate);
 
+		collider->SetLayer(XenonCollisionLayers::Pickup);
 		collider->SetTrigger(true);
 		collider->SetShouldSensorEvent(true);
 
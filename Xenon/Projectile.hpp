@@ -3,8 +3,8 @@
 // Umbrella include: keeps existing includes working while splitting the system
 // into smaller, easier-to-read headers.
 
+#include "ProjectileSystem.hpp"
 #include "ProjectileCommon.hpp"
 #include "Missiles.hpp"
 #include "EnemyProjectiles.hpp"
-#include "ProjectileObjects.hpp"
 #include "ProjectileLaunchers.hpp"
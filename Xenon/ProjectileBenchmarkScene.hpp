@@ -0,0 +1,126 @@
+#pragma once
+
+#include <GameEngine/GameEngine.h>
+#include "IDamageable.hpp"
+#include "Missiles.hpp"
+#include "ProjectileSystem.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+
+// -----------------------------------------------------------------------------
+// ProjectileBenchmarkScene
+// - Keeps 10k player bullets alive against a field of enemy boxes and circles,
+//   part of it well outside the view, and times ProjectileSystem::Update
+// - Logs the average and worst update after the measured frames, then quits
+// Started instead of the main menu with: Xenon --bench-projectiles
+// -----------------------------------------------------------------------------
+
+class BenchmarkTarget : public MonoBehaviour, public IDamageable {
+public:
+	Faction GetFaction() const override { return Faction::Enemy; }
+	bool IsAlive() const override { return true; }
+	int GetHealth() const override { return 1; }
+	int GetMaxHealth() const override { return 1; }
+	void ApplyDamage(int amount, GameObject* instigator = nullptr) override { (void)amount; (void)instigator; }
+	void Heal(int amount, GameObject* instigator = nullptr) override { (void)amount; (void)instigator; }
+};
+
+class ProjectileBenchmarkScene : public Scene {
+public:
+	static constexpr int kBulletCount = 10000;
+	static constexpr int kWarmupFrames = 60;
+	static constexpr int kMeasuredFrames = 600;
+
+	ProjectileBenchmarkScene()
+		: Scene("ProjectileBenchmark") {
+	}
+
+	void OnDeclareAssets(AssetManifest& manifest) override {
+		manifest.AddSpriteSheet(XenonAssetKeys::Sheets::Missiles, XenonAssetKeys::Files::MissileBmp, Vector2i(16, 16), Vector3i(255, 0, 255));
+	}
+
+	void OnStart() override {
+		m_kind = MissileAnim::GetKind(m_projectiles, MissileType::Light);
+
+		// 12 x 8 targets over a 2560 x 1440 field centered on the origin.
+		for (int y = 0; y < 8; ++y) {
+			for (int x = 0; x < 12; ++x) {
+				auto go = CreateGameObject<GameObject>("BenchmarkTarget");
+				go->GetTransform()->SetPosition(Vector2f(-1280.0f + 213.0f * x + 100.0f, -720.0f + 180.0f * y + 90.0f));
+				Collider2D* collider = nullptr;
+				if ((x + y) % 2 == 0) {
+					auto box = go->AddComponent<BoxCollider2D>();
+					box->SetSize(Vector2f(48.0f, 32.0f));
+					collider = box.get();
+				}
+				else {
+					auto circle = go->AddComponent<CircleCollider2D>();
+					circle->SetRadius(24.0f);
+					collider = circle.get();
+				}
+				collider->SetTrigger(true);
+				auto target = go->AddComponent<BenchmarkTarget>();
+				m_projectiles.RegisterTarget(target.get(), collider);
+			}
+		}
+	}
+
+	void OnUpdate() override {
+		Refill();
+
+		const auto start = std::chrono::steady_clock::now();
+		m_projectiles.Update(1.0f / 60.0f);
+		const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		++m_frame;
+		if (m_frame <= kWarmupFrames) return;
+
+		m_hits += static_cast<size_t>(kBulletCount) - m_projectiles.Size();
+		m_totalMs += ms;
+		m_worstMs = std::max(m_worstMs, ms);
+		if (m_frame == kWarmupFrames + kMeasuredFrames) {
+			LOG_INFO("ProjectileSystem benchmark: " + std::to_string(kBulletCount) + " bullets, "
+				+ std::to_string(m_totalMs / kMeasuredFrames) + " ms average, "
+				+ std::to_string(m_worstMs) + " ms worst, "
+				+ std::to_string(m_hits) + " bullets removed over " + std::to_string(kMeasuredFrames) + " frames");
+			SleeplessEngine::GetInstance().Shutdown();
+		}
+	}
+
+	void OnRender() override {
+		if (Renderer* renderer = GetRenderer()) {
+			m_projectiles.Render(*renderer);
+		}
+	}
+
+private:
+	// Tops the system back up to kBulletCount with bullets fanning out from a ring around the origin.
+	void Refill() {
+		while (m_projectiles.Size() < static_cast<size_t>(kBulletCount)) {
+			const float angle = static_cast<float>(m_spawned % 360) * Math::Constants<float>::Deg2Rad;
+			const float radius = 200.0f + static_cast<float>((m_spawned * 37) % 1000);
+			const Vector2f direction(std::cos(angle), std::sin(angle));
+
+			ProjectileSystem::SpawnParams params;
+			params.kind = m_kind;
+			params.faction = Faction::Player;
+			params.position = direction * radius;
+			params.velocity = direction * 400.0f;
+			params.damage = 0;
+			params.lifetime = 2.0f;
+			m_projectiles.Spawn(params);
+			++m_spawned;
+		}
+	}
+
+	ProjectileSystem m_projectiles;
+	ProjectileSystem::KindId m_kind = ProjectileSystem::kInvalidKind;
+	int m_spawned = 0;
+	int m_frame = 0;
+	size_t m_hits = 0;
+	double m_totalMs = 0.0;
+	double m_worstMs = 0.0;
+};
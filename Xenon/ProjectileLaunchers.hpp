@@ -1,14 +1,15 @@
 #pragma once
 
 #include <GameEngine/GameEngine.h>
-#include "ProjectileObjects.hpp"
+#include "Missiles.hpp"
+#include "EnemyProjectiles.hpp"
 
 #include <cmath>
 
 // -----------------------------------------------------------------------------
 // Launchers
 // - Behaviours added to shooters
-// - Spawns projectiles using:
+// - Spawns projectiles into ProjectileSystem::Current() using:
 //   - a local muzzle offset (rotates with shooter)
 //   - a local fire direction (rotates with shooter)
 // -----------------------------------------------------------------------------
@@ -85,24 +86,19 @@ public:
 	bool TryFireLocal(const Vector2f& localDirection) {
 		if (!CooldownReady()) return false;
 
-		Scene* scene = GetGameObject()->GetScene();
-		if (!scene) return false;
+		ProjectileSystem* projectiles = ProjectileSystem::Current();
+		if (!projectiles) return false;
 
-		auto proj = scene->CreateGameObject<PlayerProjectile>("PlayerProjectile");
-		proj->GetTransform()->SetPosition(GetMuzzleWorldPosition());
-
-		Vector2f worldDir = LocalDirToWorldDir(localDirection);
+		ProjectileSystem::SpawnParams p;
+		p.kind = MissileAnim::GetKind(*projectiles, m_missileType);
+		p.faction = Faction::Player;
+		p.position = GetMuzzleWorldPosition();
+		p.velocity = LocalDirToWorldDir(localDirection) * m_projectileSpeed;
 		// Missiles should inherit the shooter's orientation (ship faces up at rot 0).
-		proj->GetTransform()->SetRotation(GetTransform()->GetWorldRotation());
-
-		auto behaviour = proj->GetComponent<MissileBehaviour>().get();
-		if (behaviour) {
-			behaviour->SetMissileType(m_missileType);
-			behaviour->SetDirection(worldDir);
-			behaviour->SetSpeed(m_projectileSpeed);
-			// If you want to override missile-type damage, set m_damage > 0.
-			if (m_damage > 0) behaviour->SetDamage(m_damage);
-		}
+		p.angleDegrees = GetTransform()->GetWorldRotation();
+		// If you want to override missile-type damage, set m_damage > 0.
+		p.damage = m_damage > 0 ? m_damage : MissileDamage(m_missileType);
+		projectiles->Spawn(p);
 
 		MarkFired();
 		return true;
@@ -124,22 +120,7 @@ public:
 	// Fire in shooter LOCAL space.
 	bool TryFire(const Vector2f& localDirection) {
 		if (!CooldownReady()) return false;
-
-		Scene* scene = GetGameObject()->GetScene();
-		if (!scene) return false;
-
-		auto proj = scene->CreateGameObject<EnemyProjectile>("EnemyProjectile");
-		proj->GetTransform()->SetPosition(GetMuzzleWorldPosition());
-
-		Vector2f worldDir = LocalDirToWorldDir(localDirection);
-		proj->GetTransform()->SetRotation(DirToAngleDeg(worldDir));
-
-		auto behaviour = proj->GetComponent<EnemyProjectileSheetBehaviour>().get();
-		if (behaviour) {
-			behaviour->SetDirection(worldDir);
-			behaviour->SetSpeed(m_projectileSpeed);
-			behaviour->SetDamage(m_damage);
-		}
+		if (!SpawnShot(LocalDirToWorldDir(localDirection))) return false;
 
 		MarkFired();
 		return true;
@@ -159,25 +140,27 @@ public:
 	bool TryFireWorld(const Vector2f& worldDirection) {
 		if (!CooldownReady()) return false;
 
-		Scene* scene = GetGameObject()->GetScene();
-		if (!scene) return false;
-
-		auto proj = scene->CreateGameObject<EnemyProjectile>("EnemyProjectile");
-		proj->GetTransform()->SetPosition(GetMuzzleWorldPosition());
-
 		Vector2f worldDir = worldDirection;
 		if (worldDir.LengthSquared() <= 0.0001f) worldDir = Vector2f(1.0f, 0.0f);
-		worldDir = worldDir.Normalized();
-		proj->GetTransform()->SetRotation(DirToAngleDeg(worldDir));
-
-		auto behaviour = proj->GetComponent<EnemyProjectileSheetBehaviour>().get();
-		if (behaviour) {
-			behaviour->SetDirection(worldDir);
-			behaviour->SetSpeed(m_projectileSpeed);
-			behaviour->SetDamage(m_damage);
-		}
+		if (!SpawnShot(worldDir.Normalized())) return false;
 
 		MarkFired();
 		return true;
 	}
+
+private:
+	bool SpawnShot(const Vector2f& worldDir) {
+		ProjectileSystem* projectiles = ProjectileSystem::Current();
+		if (!projectiles) return false;
+
+		ProjectileSystem::SpawnParams p;
+		p.kind = EnemyProjAnim::GetKind(*projectiles);
+		p.faction = Faction::Enemy;
+		p.position = GetMuzzleWorldPosition();
+		p.velocity = worldDir * m_projectileSpeed;
+		p.angleDegrees = DirToAngleDeg(worldDir);
+		p.damage = m_damage;
+		projectiles->Spawn(p);
+		return true;
+	}
 };
@@ -0,0 +1,494 @@
+#pragma once
+
+#include <GameEngine/GameEngine.h>
+#include "Faction.hpp"
+#include "IDamageable.hpp"
+#include "VFX.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// ProjectileSystem
+// - Every live bullet is one row of parallel arrays: no GameObject, no Box2D body
+// - One loop moves, ages and animates all bullets, sweeping each against the
+//   registered targets (entity colliders) through a uniform grid
+// - Drawn with one DrawTextureBatch per sprite sheet
+// Owned by XenonGameMode (updated in OnUpdate, drawn in OnRender). Entities
+// register themselves as targets while enabled.
+// -----------------------------------------------------------------------------
+
+class ProjectileSystem {
+public:
+	using KindId = int;
+	static constexpr KindId kInvalidKind = -1;
+
+	// Look and hit box shared by every bullet of one kind.
+	struct Kind {
+		SpriteSheet* sheet = nullptr;
+		std::vector<int> frames; // sheet frame indices, looped at fps
+		float fps = 16.0f;
+		Vector2f halfExtents = Vector2f(8.0f, 8.0f); // hit box around the bullet center
+	};
+
+	struct SpawnParams {
+		KindId kind = kInvalidKind;
+		Faction faction = Faction::Neutral;
+		Vector2f position = Vector2f::Zero();
+		Vector2f velocity = Vector2f::Zero();
+		float angleDegrees = 0.0f; // sprite rotation only
+		int damage = 1;
+		float lifetime = 3.0f;
+	};
+
+	ProjectileSystem() {
+		Reserve(1024);
+	}
+
+	~ProjectileSystem() {
+		if (s_current == this) s_current = nullptr;
+	}
+
+	ProjectileSystem(const ProjectileSystem&) = delete;
+	ProjectileSystem& operator=(const ProjectileSystem&) = delete;
+
+	// The system launchers and entities talk to (set by the owning game mode).
+	static ProjectileSystem* Current() { return s_current; }
+	static void SetCurrent(ProjectileSystem* system) { s_current = system; }
+
+	// Scene that receives hit explosions.
+	void SetScene(Scene* scene) { m_scene = scene; }
+
+	// --- Kinds ---
+
+	KindId FindKind(std::string_view name) const {
+		for (size_t i = 0; i < m_kindNames.size(); ++i) {
+			if (m_kindNames[i] == name) return static_cast<KindId>(i);
+		}
+		return kInvalidKind;
+	}
+
+	KindId AddKind(std::string name, Kind kind) {
+		if (!kind.sheet || !kind.sheet->IsValid() || kind.frames.empty()) {
+			THROW_ENGINE_EXCEPTION("Projectile kind " + name + " needs a valid sheet and at least one frame");
+		}
+
+		KindData data;
+		data.kind = std::move(kind);
+		const Vector2i texSize = data.kind.sheet->texture->GetSize();
+		data.columns = std::max(1, texSize.x / std::max(1, data.kind.sheet->frameSize.x));
+
+		// Kinds cut from the same sheet share one draw batch.
+		data.batch = static_cast<int>(m_batchTextures.size());
+		for (size_t b = 0; b < m_batchTextures.size(); ++b) {
+			if (m_batchTextures[b] == data.kind.sheet->texture) {
+				data.batch = static_cast<int>(b);
+				break;
+			}
+		}
+		if (data.batch == static_cast<int>(m_batchTextures.size())) {
+			m_batchTextures.push_back(data.kind.sheet->texture);
+		}
+
+		m_kinds.push_back(std::move(data));
+		m_kindNames.push_back(std::move(name));
+		return static_cast<KindId>(m_kinds.size() - 1);
+	}
+
+	// --- Bullets ---
+
+	void Spawn(const SpawnParams& p) {
+		if (p.kind < 0 || p.kind >= static_cast<KindId>(m_kinds.size())) return;
+
+		m_positions.push_back(p.position);
+		m_velocities.push_back(p.velocity);
+		m_ages.push_back(0.0f);
+		m_lifetimes.push_back(p.lifetime);
+		m_angles.push_back(p.angleDegrees);
+		m_factions.push_back(p.faction);
+		m_damages.push_back(p.damage);
+		m_kindIds.push_back(static_cast<std::uint16_t>(p.kind));
+		m_frames.push_back(m_kinds[static_cast<size_t>(p.kind)].kind.frames.front());
+	}
+
+	size_t Size() const { return m_positions.size(); }
+
+	void Clear() {
+		m_positions.clear();
+		m_velocities.clear();
+		m_ages.clear();
+		m_lifetimes.clear();
+		m_angles.clear();
+		m_factions.clear();
+		m_damages.clear();
+		m_kindIds.clear();
+		m_frames.clear();
+	}
+
+	// --- Targets ---
+
+	void RegisterTarget(IDamageable* damageable, Collider2D* collider) {
+		if (!damageable || !collider) return;
+		for (const auto& t : m_targets) {
+			if (t.damageable == damageable) return;
+		}
+		m_targets.push_back({ damageable, collider });
+	}
+
+	void UnregisterTarget(IDamageable* damageable) {
+		for (size_t i = 0; i < m_targets.size(); ++i) {
+			if (m_targets[i].damageable == damageable) {
+				m_targets[i] = m_targets.back();
+				m_targets.pop_back();
+				return;
+			}
+		}
+	}
+
+	// --- Frame ---
+
+	void Update(float dt) {
+		if (m_positions.empty() || dt <= 0.0f) return;
+
+		BuildTargetGrid(dt);
+		m_hits.clear();
+
+		const size_t count = m_positions.size();
+		for (size_t i = 0; i < count; ++i) {
+			const Vector2f from = m_positions[i];
+			const Vector2f to = from + m_velocities[i] * dt;
+			m_positions[i] = to;
+			m_ages[i] += dt;
+
+			const KindData& kd = m_kinds[m_kindIds[i]];
+			const int local = static_cast<int>(m_ages[i] * kd.kind.fps) % static_cast<int>(kd.kind.frames.size());
+			m_frames[i] = kd.kind.frames[static_cast<size_t>(local)];
+
+			const int target = SweepTargets(i, from, to, kd.kind.halfExtents);
+			if (target >= 0) {
+				m_hits.push_back({ i, target });
+			}
+			else if (m_ages[i] >= m_lifetimes[i]) {
+				m_lifetimes[i] = -1.0f; // expired
+			}
+		}
+
+		// Damage after the sweep: deaths may spawn or disable entities, which edits the target list.
+		for (const Hit& hit : m_hits) {
+			IDamageable* damageable = m_shapes[static_cast<size_t>(hit.target)].damageable;
+			if (damageable->IsAlive() && m_damages[hit.bullet] > 0) {
+				damageable->ApplyDamage(m_damages[hit.bullet], nullptr);
+			}
+			SpawnExplosion(m_positions[hit.bullet]);
+			m_lifetimes[hit.bullet] = -1.0f;
+		}
+
+		RemoveExpired();
+	}
+
+	void Render(Renderer& renderer) {
+		if (m_positions.empty()) return;
+
+		for (size_t b = 0; b < m_batchTextures.size(); ++b) {
+			m_quads.clear();
+			for (size_t i = 0; i < m_positions.size(); ++i) {
+				const KindData& kd = m_kinds[m_kindIds[i]];
+				if (kd.batch != static_cast<int>(b)) continue;
+
+				const Vector2f frameSize(static_cast<float>(kd.kind.sheet->frameSize.x), static_cast<float>(kd.kind.sheet->frameSize.y));
+				const int frame = m_frames[i];
+				TextureQuad quad;
+				quad.center = m_positions[i];
+				quad.size = frameSize;
+				quad.sourcePosition = Vector2f(static_cast<float>(frame % kd.columns) * frameSize.x, static_cast<float>(frame / kd.columns) * frameSize.y);
+				quad.sourceSize = frameSize;
+				quad.angleDegrees = m_angles[i];
+				m_quads.push_back(quad);
+			}
+			if (!m_quads.empty()) {
+				renderer.DrawTextureBatch(*m_batchTextures[b], m_quads);
+			}
+		}
+	}
+
+private:
+	struct KindData {
+		Kind kind;
+		int columns = 1;
+		int batch = 0;
+	};
+
+	struct Target {
+		IDamageable* damageable = nullptr;
+		Collider2D* collider = nullptr;
+	};
+
+	// Target collider in world space for this frame. radius < 0 = box.
+	struct TargetShape {
+		IDamageable* damageable = nullptr;
+		Faction faction = Faction::Neutral;
+		Vector2f center = Vector2f::Zero();
+		Vector2f half = Vector2f::Zero();
+		float radius = -1.0f;
+	};
+
+	struct Hit {
+		size_t bullet = 0;
+		int target = 0;
+	};
+
+	static constexpr float kMinCellSize = 64.0f;
+	static constexpr int kMaxGridCellsPerAxis = 64;
+
+	void Reserve(size_t capacity) {
+		m_positions.reserve(capacity);
+		m_velocities.reserve(capacity);
+		m_ages.reserve(capacity);
+		m_lifetimes.reserve(capacity);
+		m_angles.reserve(capacity);
+		m_factions.reserve(capacity);
+		m_damages.reserve(capacity);
+		m_kindIds.reserve(capacity);
+		m_frames.reserve(capacity);
+	}
+
+	// Snapshot target shapes and bucket them into grid cells (counting sort).
+	void BuildTargetGrid(float dt) {
+		m_shapes.clear();
+		for (const auto& t : m_targets) {
+			if (!t.damageable->IsAlive()) continue;
+			Transform* transform = t.collider->GetTransform();
+			if (!transform) continue;
+
+			TargetShape shape;
+			shape.damageable = t.damageable;
+			shape.faction = t.damageable->GetFaction();
+
+			const float rad = transform->GetWorldRotation() * Math::Constants<float>::Deg2Rad;
+			const float cs = std::cos(rad);
+			const float sn = std::sin(rad);
+			const Vector2f offset = t.collider->GetOffset();
+			shape.center = transform->GetWorldPosition() + Vector2f(offset.x * cs - offset.y * sn, offset.x * sn + offset.y * cs);
+
+			switch (t.collider->GetShapeType()) {
+			case Collider2D::ShapeType::Circle:
+				shape.radius = static_cast<CircleCollider2D*>(t.collider)->GetRadius();
+				shape.half = Vector2f(shape.radius, shape.radius);
+				break;
+			case Collider2D::ShapeType::Box: {
+				// AABB of the rotated box.
+				const Vector2f h = static_cast<BoxCollider2D*>(t.collider)->GetSize() * 0.5f;
+				shape.half = Vector2f(std::abs(cs) * h.x + std::abs(sn) * h.y, std::abs(sn) * h.x + std::abs(cs) * h.y);
+				break;
+			}
+			}
+			m_shapes.push_back(shape);
+		}
+
+		// The grid covers where this frame's bullet sweeps and the targets overlap, wherever that
+		// is in the world; the cells grow when that area is large. Sweeps outside it cannot hit.
+		Vector2f lo(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+		Vector2f hi(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+		for (const auto& s : m_shapes) {
+			lo = Vector2f(std::min(lo.x, s.center.x - s.half.x), std::min(lo.y, s.center.y - s.half.y));
+			hi = Vector2f(std::max(hi.x, s.center.x + s.half.x), std::max(hi.y, s.center.y + s.half.y));
+		}
+		Vector2f bulletLo = lo;
+		Vector2f bulletHi = hi;
+		if (!m_shapes.empty()) {
+			bulletLo = Vector2f(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+			bulletHi = Vector2f(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+			for (size_t i = 0; i < m_positions.size(); ++i) {
+				const Vector2f from = m_positions[i];
+				const Vector2f to = from + m_velocities[i] * dt;
+				const Vector2f half = m_kinds[m_kindIds[i]].kind.halfExtents;
+				bulletLo = Vector2f(std::min(bulletLo.x, std::min(from.x, to.x) - half.x), std::min(bulletLo.y, std::min(from.y, to.y) - half.y));
+				bulletHi = Vector2f(std::max(bulletHi.x, std::max(from.x, to.x) + half.x), std::max(bulletHi.y, std::max(from.y, to.y) + half.y));
+			}
+		}
+		m_gridMin = Vector2f(std::max(lo.x, bulletLo.x), std::max(lo.y, bulletLo.y));
+		m_gridMax = Vector2f(std::min(hi.x, bulletHi.x), std::min(hi.y, bulletHi.y));
+		if (m_gridMin.x > m_gridMax.x || m_gridMin.y > m_gridMax.y) {
+			// Nothing can be hit this frame.
+			m_shapes.clear();
+			m_gridMin = m_gridMax = Vector2f::Zero();
+		}
+
+		const Vector2f extent = m_gridMax - m_gridMin;
+		m_cellSize = std::max({ kMinCellSize, extent.x / kMaxGridCellsPerAxis, extent.y / kMaxGridCellsPerAxis });
+		m_gridWidth = std::clamp(static_cast<int>(std::ceil(extent.x / m_cellSize)), 1, kMaxGridCellsPerAxis);
+		m_gridHeight = std::clamp(static_cast<int>(std::ceil(extent.y / m_cellSize)), 1, kMaxGridCellsPerAxis);
+
+		const size_t cellCount = static_cast<size_t>(m_gridWidth) * static_cast<size_t>(m_gridHeight);
+		m_cellStart.assign(cellCount + 1, 0);
+		for (const auto& s : m_shapes) {
+			ForEachCell(s.center - s.half, s.center + s.half, [this](size_t cell) { ++m_cellStart[cell + 1]; });
+		}
+		for (size_t c = 0; c < cellCount; ++c) {
+			m_cellStart[c + 1] += m_cellStart[c];
+		}
+		m_cellItems.resize(m_cellStart[cellCount]);
+		m_cellFill.assign(m_cellStart.begin(), m_cellStart.end() - 1);
+		for (size_t t = 0; t < m_shapes.size(); ++t) {
+			const auto& s = m_shapes[t];
+			ForEachCell(s.center - s.half, s.center + s.half, [this, t](size_t cell) { m_cellItems[m_cellFill[cell]++] = static_cast<int>(t); });
+		}
+		m_testedBy.assign(m_shapes.size(), static_cast<size_t>(-1));
+	}
+
+	template <typename Fn>
+	void ForEachCell(const Vector2f& min, const Vector2f& max, Fn&& fn) const {
+		auto cellX = [this](float x) { return std::clamp(static_cast<int>(std::floor((x - m_gridMin.x) / m_cellSize)), 0, m_gridWidth - 1); };
+		auto cellY = [this](float y) { return std::clamp(static_cast<int>(std::floor((y - m_gridMin.y) / m_cellSize)), 0, m_gridHeight - 1); };
+		const int x0 = cellX(min.x), x1 = cellX(max.x);
+		const int y0 = cellY(min.y), y1 = cellY(max.y);
+		for (int y = y0; y <= y1; ++y) {
+			for (int x = x0; x <= x1; ++x) {
+				fn(static_cast<size_t>(y) * static_cast<size_t>(m_gridWidth) + static_cast<size_t>(x));
+			}
+		}
+	}
+
+	// Swept test of one bullet's move against the grid; returns a shape index or -1.
+	int SweepTargets(size_t bullet, const Vector2f& from, const Vector2f& to, const Vector2f& half) {
+		if (m_shapes.empty()) return -1;
+
+		const Faction faction = m_factions[bullet];
+		const Vector2f min(std::min(from.x, to.x) - half.x, std::min(from.y, to.y) - half.y);
+		const Vector2f max(std::max(from.x, to.x) + half.x, std::max(from.y, to.y) + half.y);
+		if (max.x < m_gridMin.x || max.y < m_gridMin.y || min.x > m_gridMax.x || min.y > m_gridMax.y) return -1;
+
+		int hit = -1;
+		ForEachCell(min, max, [&](size_t cell) {
+			if (hit >= 0) return;
+			for (int k = m_cellStart[cell]; k < m_cellStart[cell + 1]; ++k) {
+				const int t = m_cellItems[static_cast<size_t>(k)];
+				if (m_testedBy[static_cast<size_t>(t)] == bullet) continue; // spans several cells
+				m_testedBy[static_cast<size_t>(t)] = bullet;
+
+				const TargetShape& s = m_shapes[static_cast<size_t>(t)];
+				if (s.faction == faction) continue; // no friendly fire
+				if (SegmentHits(s, from, to, half)) {
+					hit = t;
+					return;
+				}
+			}
+		});
+		return hit;
+	}
+
+	// Segment against the target grown by the bullet's half extents (Minkowski sum).
+	static bool SegmentHits(const TargetShape& s, const Vector2f& from, const Vector2f& to, const Vector2f& half) {
+		const Vector2f d = to - from;
+
+		if (s.radius >= 0.0f) {
+			const float r = s.radius + std::max(half.x, half.y);
+			const Vector2f m = s.center - from;
+			const float len2 = d.x * d.x + d.y * d.y;
+			const float u = len2 > 0.0f ? std::clamp((m.x * d.x + m.y * d.y) / len2, 0.0f, 1.0f) : 0.0f;
+			const Vector2f closest = from + d * u - s.center;
+			return closest.x * closest.x + closest.y * closest.y <= r * r;
+		}
+
+		// Slab test
+		const Vector2f lo = s.center - s.half - half;
+		const Vector2f hi = s.center + s.half + half;
+		float tMin = 0.0f;
+		float tMax = 1.0f;
+		const float start[2] = { from.x, from.y };
+		const float delta[2] = { d.x, d.y };
+		const float slabLo[2] = { lo.x, lo.y };
+		const float slabHi[2] = { hi.x, hi.y };
+		for (int axis = 0; axis < 2; ++axis) {
+			if (std::abs(delta[axis]) < 1e-6f) {
+				if (start[axis] < slabLo[axis] || start[axis] > slabHi[axis]) return false;
+				continue;
+			}
+			float t0 = (slabLo[axis] - start[axis]) / delta[axis];
+			float t1 = (slabHi[axis] - start[axis]) / delta[axis];
+			if (t0 > t1) std::swap(t0, t1);
+			tMin = std::max(tMin, t0);
+			tMax = std::min(tMax, t1);
+			if (tMin > tMax) return false;
+		}
+		return true;
+	}
+
+	void SpawnExplosion(const Vector2f& position) {
+		if (!m_scene) return;
+		auto vfx = m_scene->CreateGameObject<ExplosionVFX>("ExplosionVFX");
+		vfx->GetTransform()->SetPosition(position);
+	}
+
+	// Swap-remove every bullet marked with a negative lifetime.
+	void RemoveExpired() {
+		size_t i = 0;
+		while (i < m_positions.size()) {
+			if (m_lifetimes[i] >= 0.0f) {
+				++i;
+				continue;
+			}
+			const size_t last = m_positions.size() - 1;
+			if (i != last) {
+				m_positions[i] = m_positions[last];
+				m_velocities[i] = m_velocities[last];
+				m_ages[i] = m_ages[last];
+				m_lifetimes[i] = m_lifetimes[last];
+				m_angles[i] = m_angles[last];
+				m_factions[i] = m_factions[last];
+				m_damages[i] = m_damages[last];
+				m_kindIds[i] = m_kindIds[last];
+				m_frames[i] = m_frames[last];
+			}
+			m_positions.pop_back();
+			m_velocities.pop_back();
+			m_ages.pop_back();
+			m_lifetimes.pop_back();
+			m_angles.pop_back();
+			m_factions.pop_back();
+			m_damages.pop_back();
+			m_kindIds.pop_back();
+			m_frames.pop_back();
+		}
+	}
+
+	inline static ProjectileSystem* s_current = nullptr;
+
+	Scene* m_scene = nullptr;
+
+	// Bullets (SoA)
+	std::vector<Vector2f> m_positions;
+	std::vector<Vector2f> m_velocities;
+	std::vector<float> m_ages;
+	std::vector<float> m_lifetimes; // < 0 = remove this frame
+	std::vector<float> m_angles;
+	std::vector<Faction> m_factions;
+	std::vector<int> m_damages;
+	std::vector<std::uint16_t> m_kindIds;
+	std::vector<int> m_frames;
+
+	std::vector<KindData> m_kinds;
+	std::vector<std::string> m_kindNames;
+	std::vector<Texture*> m_batchTextures;
+
+	std::vector<Target> m_targets;
+
+	// Per-update scratch
+	std::vector<TargetShape> m_shapes;
+	std::vector<int> m_cellStart;
+	std::vector<int> m_cellFill;
+	std::vector<int> m_cellItems;
+	std::vector<size_t> m_testedBy;
+	Vector2f m_gridMin = Vector2f::Zero();
+	Vector2f m_gridMax = Vector2f::Zero();
+	float m_cellSize = kMinCellSize;
+	int m_gridWidth = 1;
+	int m_gridHeight = 1;
+	std::vector<Hit> m_hits;
+	std::vector<TextureQuad> m_quads;
+};
@@ -13,8 +13,6 @@ class RusherBehaviour : public EnemyEntity {
 	Animator* animator = nullptr;
 
 	SpriteSheet* m_sheet = nullptr;
-	AnimationClip m_clip{};
-	AnimatorController m_ctrl{};
 
 	float m_speed = 160.0f;
 
@@ -26,6 +24,7 @@ protected:
 			rigidbody->SetBodyType(Rigidbody2D::BodyType::Kinematic);
 			rigidbody->SetGravityScale(0.0f);
 			rigidbody->SetFixedRotation(true);
+			rigidbody->SetInterpolation(Rigidbody2D::Interpolation::Interpolate);
 		}
 
 		animator = GetComponent<Animator>().get();
@@ -49,8 +48,8 @@ protected:
 		sprite->SetFrameIndex(0);
 		sprite->SetLayerOrder(-2);
 
-		BuildLoopAllFrames(m_sheet, 12.0f, m_clip, m_ctrl);
-		animator->SetController(&m_ctrl);
+		animator->SetController(LoopAllFrames(m_sheet, 12.0f));
+		animator->SetCullingMode(AnimatorCullingMode::CullUpdate);
 		animator->Play("Loop", true);
 
 		boxCol = dynamic_cast<BoxCollider2D*>(collider);
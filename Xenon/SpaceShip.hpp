@@ -24,6 +24,8 @@ namespace ShipAnim {
 		AnimationClip* normalTurn = nullptr;
 		AnimationClip* invulnTurn = nullptr;
 		AnimationClip* death = nullptr;
+		AnimParamId invulnParam = kInvalidAnimParam;
+		AnimParamId dieParam = kInvalidAnimParam;
 	};
 
 	// NOTE: We keep templates in this header (ship-only), but avoid function-local statics
@@ -112,7 +114,11 @@ namespace ShipAnim {
 		g_ctrl.transitions.push_back(tr);
 			}
 
+		g_ctrl.Compile();
+
 		g_out.controller = &g_ctrl;
+		g_out.invulnParam = g_ctrl.FindParameterId("Invuln");
+		g_out.dieParam = g_ctrl.FindParameterId("Die");
 		g_out.normalTurn = &g_clipNormal;
 		g_out.invulnTurn = &g_clipInvuln;
 		g_out.death = &g_clipDeath;
@@ -134,8 +140,10 @@ protected:
 	BoxCollider2D* boxCol = nullptr;
 	PlayerProjectileLauncher* launcher = nullptr;
 	Animator* m_animator = nullptr;
+	AnimParamId m_invulnParam = kInvalidAnimParam;
+	AnimParamId m_dieParam = kInvalidAnimParam;
 	std::shared_ptr<AudioSource> m_gunAudio;
-	AudioClip* m_gunClip = nullptr;
+	AudioClipHandle m_gunClip;
 
 	// Invulnerability (Ship2.bmp row 1)
 	const float m_invulnDuration = 1.5f;
@@ -190,14 +198,14 @@ protected:
 		if (m_isDying) return;
 		seconds = std::max(0.01f, seconds);
 		m_isInvulnerable = true;
-		if (m_animator) m_animator->SetBool("Invuln", true);
+		if (m_animator) m_animator->SetBool(m_invulnParam, true);
 		if (m_invulnInvoke) CancelInvoke(m_invulnInvoke);
 		m_invulnInvoke = Invoke([this]() { EndInvulnerability(); }, seconds, MonoBehaviour::InvokeTickPolicy::WhileBehaviourEnabled);
 	}
 
 	void EndInvulnerability() {
 		m_isInvulnerable = false;
-		if (m_animator) m_animator->SetBool("Invuln", false);
+		if (m_animator) m_animator->SetBool(m_invulnParam, false);
 	}
 
 void FinishDeath() {
@@ -245,8 +253,10 @@ void KillCompanions() {
 			THROW_ENGINE_EXCEPTION("SpaceShip is missing Animator component");
 		}
 		m_animator->SetController(anim.controller);
+		m_invulnParam = anim.invulnParam;
+		m_dieParam = anim.dieParam;
 		m_animator->Play("Normal", true);
-		m_animator->SetBool("Invuln", false);
+		m_animator->SetBool(m_invulnParam, false);
 		// Try to start centered.
 		m_animator->SeekNormalized(0.5f, 2.0f);
 		m_deathLength = anim.death ? anim.death->GetLengthSeconds() : 0.0f;
@@ -254,9 +264,9 @@ void KillCompanions() {
 		// --- Audio ---
 		// Play gun.wav when the player fires.
 		m_gunAudio = GetComponent<AudioSource>();
-		m_gunClip = LoadAudioClip(XenonAssetKeys::Audio::GunWav);
+		m_gunClip = RetainAsset(LoadAudioClip(XenonAssetKeys::Audio::GunWav));
 		if (m_gunAudio && m_gunClip) {
-			m_gunAudio->SetClip(m_gunClip);
+			m_gunAudio->SetClip(m_gunClip.Get());
 			m_gunAudio->SetLoop(false);
 			m_gunAudio->SetGain(1.0f);
 		}
@@ -264,6 +274,8 @@ void KillCompanions() {
 
 		rigidbody->SetBodyType(Rigidbody2D::BodyType::Dynamic);
 		rigidbody->SetFixedRotation(true);
+		// Velocity-driven: blend between fixed steps so 60 Hz physics looks smooth at 144 FPS.
+		rigidbody->SetInterpolation(Rigidbody2D::Interpolation::Interpolate);
 		rigidbody->SetIsBullet(true);
 
 		boxCol = dynamic_cast<BoxCollider2D*>(collider);
@@ -375,8 +387,8 @@ void KillCompanions() {
 		}
 		// Play death animation.
 		if (m_animator) {
-			m_animator->SetBool("Invuln", false);
-			m_animator->SetTrigger("Die");
+			m_animator->SetBool(m_invulnParam, false);
+			m_animator->SetTrigger(m_dieParam);
 		}
 		if (m_deathInvoke) CancelInvoke(m_deathInvoke);
 		m_deathInvoke = Invoke([this]() { FinishDeath(); }, (m_deathLength > 0.0f ? m_deathLength : 0.01f), MonoBehaviour::InvokeTickPolicy::WhileBehaviourEnabled);
@@ -94,6 +94,7 @@ protected:
 			rigidbody->SetBodyType(Rigidbody2D::BodyType::Kinematic);
 			rigidbody->SetGravityScale(0.0f);
 			rigidbody->SetFixedRotation(true);
+			rigidbody->SetInterpolation(Rigidbody2D::Interpolation::Interpolate);
 		}
 
 		animator = GetComponent<Animator>().get();
@@ -113,8 +114,8 @@ protected:
 		sprite->SetFrameIndex(0);
 		sprite->SetLayerOrder(-2);
 
-		BuildLoopAllFrames(sheet, 12.0f, clip, ctrl);
-		animator->SetController(&ctrl);
+		animator->SetController(LoopAllFrames(sheet, 12.0f));
+		animator->SetCullingMode(AnimatorCullingMode::CullUpdate);
 		animator->Play("Loop", true);
 
 		box = dynamic_cast<BoxCollider2D*>(collider);
@@ -167,8 +168,6 @@ private:
 	BoxCollider2D* box = nullptr;
 	Animator* animator = nullptr;
 	SpriteSheet* sheet = nullptr;
-	AnimationClip clip{};
-	AnimatorController ctrl{};
 };
 
 class StoneAsteroid : public GameObject {
@@ -37,30 +37,18 @@ protected:
 			sprite->SetFrameIndex(0);
 		}
 
-		animator->SetController(&m_controller);
+		animator->SetController(m_controller);
 		animator->Play("Play", true);
 	}
 
 	void Start() override {
 		// Despawn exactly when the animation ends.
-		const float len = m_clip.GetLengthSeconds();
+		const float len = m_clip ? m_clip->GetLengthSeconds() : 0.0f;
 		Object::Destroy(GetGameObject(), len > 0.0f ? len : 0.1f);
 	}
 
-	static std::string BuildVfxSheetKey(const std::string& path, const Vector2i& frame, bool useColorKey, const Vector3i& ck) {
-		// Stable-ish key for caching. This still keeps the *cache* in AssetManager,
-		// but avoids forcing scenes to preload or to pass keys around.
-		std::string k = "sheet.vfx.";
-		k += path;
-		k += "|" + std::to_string(frame.x) + "x" + std::to_string(frame.y);
-		if (useColorKey) {
-			k += "|ck=" + std::to_string(ck.x) + "," + std::to_string(ck.y) + "," + std::to_string(ck.z);
-		}
-		return k;
-	}
-
 	void BuildAssetsIfNeeded() {
-		// Build per-instance controller/clip (cheap), but load the sheet through AssetManager's cache.
+		// Sheet and controller both come from engine caches; only the first instance builds them.
 		if (m_built) return;
 
 		if (m_sheetPath.empty()) {
@@ -73,42 +61,19 @@ protected:
 			m_fps = 16.0f;
 		}
 
-		const std::string sheetKey = BuildVfxSheetKey(m_sheetPath, m_frameSize, m_useColorKey, m_colorKey);
+		// Sheets without a key are cached by path + frame size + color key, hashed without building a string.
 		if (m_useColorKey) {
-			m_sheet = LoadSpriteSheet(sheetKey, m_sheetPath, m_frameSize, m_colorKey);
+			m_sheet = LoadSpriteSheet(m_sheetPath, m_frameSize, m_colorKey);
 		} else {
-			m_sheet = LoadSpriteSheet(sheetKey, m_sheetPath, m_frameSize);
+			m_sheet = LoadSpriteSheet(m_sheetPath, m_frameSize);
 		}
 		if (!m_sheet || !m_sheet->IsValid()) {
 			THROW_ENGINE_EXCEPTION("Failed to load VFX spritesheet: " + m_sheetPath);
 		}
 
-		// Build a simple non-looping clip that plays every frame in the sheet.
-		m_clip = AnimationClip{};
-		m_clip.name = "Play";
-		m_clip.sheet = m_sheet;
-		m_clip.fps = m_fps;
-		m_clip.loop = false;
-		m_clip.frames.clear();
-
-		const Vector2i texSize = m_sheet->texture->GetSize();
-		const int cols = (m_frameSize.x > 0) ? (texSize.x / m_frameSize.x) : 0;
-		const int rows = (m_frameSize.y > 0) ? (texSize.y / m_frameSize.y) : 0;
-		const int total = std::max(0, cols * rows);
-		for (int i = 0; i < total; ++i) {
-			m_clip.frames.push_back(i);
-		}
-
-		// Build a controller with a single state.
-		m_controller = AnimatorController{};
-		AnimState st;
-		st.id = 0;
-		st.name = "Play";
-		st.clip = &m_clip;
-		m_controller.states = { st };
-		m_controller.transitions.clear();
-		m_controller.parameters.clear();
-		m_controller.entryState = 0;
+		// Shared non-looping clip that plays every frame in the sheet.
+		m_controller = GetSheetController(m_sheet, m_fps, false, "Play");
+		m_clip = m_controller ? m_controller->states.front().clip : nullptr;
 
 		m_built = true;
 	}
@@ -124,8 +89,8 @@ protected:
 
 	bool m_built = false;
 	SpriteSheet* m_sheet = nullptr;
-	AnimationClip m_clip{};
-	AnimatorController m_controller{};
+	const AnimationClip* m_clip = nullptr;
+	std::shared_ptr<const AnimatorController> m_controller;
 };
 
 // Explosion VFX: a concrete one-shot VFX using explode16.bmp.
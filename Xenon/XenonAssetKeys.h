@@ -33,6 +33,11 @@ namespace XenonAssetKeys {
 		inline constexpr const char* EnemyWeapBmp = "EnWeap6.bmp";
 		inline constexpr const char* MissileBmp = "missile.bmp";
 
+		// Pickups / VFX
+		inline constexpr const char* ShieldPickupBmp = "PUShield.bmp";
+		inline constexpr const char* WeaponPickupBmp = "PUWeapon.bmp";
+		inline constexpr const char* Explode16Bmp = "explode16.bmp";
+
 		// Background / tiles
 		inline constexpr const char* GalaxyBmp = "galaxy2.bmp";
 		inline constexpr const char* BlocksBmp = "Blocks.bmp";
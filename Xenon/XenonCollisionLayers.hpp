@@ -0,0 +1,36 @@
+#pragma once
+
+#include <GameEngine/GameEngine.h>
+#include "Faction.hpp"
+
+// Collision layers for Xenon. Bullets are not on the list: ProjectileSystem tests them
+// against its own target grid, outside Box2D.
+namespace XenonCollisionLayers {
+
+	inline constexpr int Default = CollisionLayerMatrix::kDefaultLayer;
+	inline constexpr int Player = 1;
+	inline constexpr int Enemy = 2;
+	inline constexpr int Pickup = 3;
+
+	// Only the player side touches anything: enemies hurt it on contact and pickups are
+	// collected by it. Enemy-enemy, pickup-enemy and ship-companion overlaps never reach Box2D's
+	// narrowphase.
+	inline CollisionLayerMatrix Build() {
+		CollisionLayerMatrix layers;
+		layers.SetLayerName(Player, "Player")
+			.SetLayerName(Enemy, "Enemy")
+			.SetLayerName(Pickup, "Pickup")
+			.ClearCollisions()
+			.SetCollision(Player, Enemy, true)
+			.SetCollision(Player, Pickup, true);
+		return layers;
+	}
+
+	inline int ForFaction(Faction faction) {
+		switch (faction) {
+		case Faction::Player: return Player;
+		case Faction::Enemy: return Enemy;
+		default: return Default;
+		}
+	}
+}
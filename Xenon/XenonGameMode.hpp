@@ -37,10 +37,18 @@ public:
 
 	void OnAttach(Scene& scene) override {
 		m_scene = &scene;
+		m_projectiles.SetScene(&scene);
+		ProjectileSystem::SetCurrent(&m_projectiles);
 		LoadHighScores();
 		m_hiScore = m_highScores.empty() ? 0 : m_highScores.front();
 	}
 
+	// Fonts for the pause menu and the options menu it opens.
+	void OnDeclareAssets(AssetManifest& manifest) override {
+		manifest.AddFont("font16x16.bmp", "font16x16.bmp", Vector2i(16, 16), Vector3i(255, 0, 255));
+		manifest.AddFont("Font8x8.bmp", "Font8x8.bmp", Vector2i(8, 8), Vector3i(255, 0, 255));
+	}
+
 	void OnStart() override {
 		if (!m_scene) return;
 
@@ -51,6 +59,7 @@ public:
 	}
 
 	void OnUpdate() override {
+		m_projectiles.Update(Time::DeltaTime());
 		SyncPlayerHealth();
 
 		if (!HasPlayer()) {
@@ -88,7 +97,17 @@ public:
 		}
 	}
 
+	// Bullets are not GameObjects: draw them on top of the sprite queue.
+	void OnRender() override {
+		if (Renderer* renderer = GetRenderer()) {
+			m_projectiles.Render(*renderer);
+		}
+	}
+
 	void OnDestroy() override {
+		if (ProjectileSystem::Current() == &m_projectiles) {
+			ProjectileSystem::SetCurrent(nullptr);
+		}
 		m_highScores.push_back(m_score);
 		std::sort(m_highScores.begin(), m_highScores.end(), std::greater<int>());
 		if ((int)m_highScores.size() > 10) m_highScores.resize(10);
@@ -172,6 +191,7 @@ private:
 
 private:
 	Scene* m_scene = nullptr;
+	ProjectileSystem m_projectiles;
 
 	int m_lives = 3;
 	int m_score = 0;